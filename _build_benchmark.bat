@@ -0,0 +1 @@
+g++.exe -o ./bin/Release/benchmark.exe .\tools\benchmark.cpp .\src\simulation.cpp .\src\collisions.cpp .\src\constants.cpp -Iinclude -Isrc -O2 -DPROFILER_DISABLED
\ No newline at end of file
@@ -0,0 +1 @@
+g++.exe -o ./bin/Release/cooker.exe .\tools\cooker.cpp .\src\normals.cpp .\src\tiny_obj_loader.cpp .\src\stb_image.cpp -Iinclude -Isrc -O2 -DNORMALS_SERIAL
\ No newline at end of file
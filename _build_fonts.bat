@@ -0,0 +1,2 @@
+g++.exe -o ./bin/Release/sdfgen.exe .\tools\sdfgen.cpp -Iinclude -O2
+.\bin\Release\sdfgen.exe include\dejavufont_sdf.h
\ No newline at end of file
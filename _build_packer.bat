@@ -0,0 +1 @@
+g++.exe -o ./bin/Release/packer.exe .\tools\packer.cpp .\src\archive.cpp -Iinclude -Isrc -O0
\ No newline at end of file
@@ -0,0 +1,6 @@
+if not exist data\cooked mkdir data\cooked
+.\bin\Release\cooker.exe data\sphere.obj data\cooked\sphere.cmsh
+.\bin\Release\cooker.exe data\plane.obj data\cooked\plane.cmsh
+.\bin\Release\cooker.exe data\carrito.obj data\cooked\carrito.cmsh
+.\bin\Release\cooker.exe --bc1 data\grass.jpg data\cooked\grass.ctex
+.\bin\Release\cooker.exe --bc1 data\wall.jpg data\cooked\wall.ctex
\ No newline at end of file
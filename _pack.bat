@@ -0,0 +1 @@
+.\bin\Release\packer.exe assets.pak data\cooked\grass.ctex data\cooked\wall.ctex data\cooked\sphere.cmsh data\cooked\plane.cmsh data\cooked\carrito.cmsh src\shader_vertex.glsl src\shader_fragment.glsl
\ No newline at end of file
@@ -0,0 +1,2 @@
+set GALLIUM_DRIVER=llvmpipe
+cd bin\Release && carritos.exe --regression ..\..\data\golden
\ No newline at end of file
@@ -0,0 +1,142 @@
+#ifndef _ARCHIVE_H
+#define _ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// Pacote de assets: um único arquivo, aberto uma vez e mapeado em memória
+// (mmap / MapViewOfFile), contendo todos os shaders, texturas e modelos.
+//
+// Formato (little-endian):
+//
+//   ArchiveHeader
+//   blobs, cada um alinhado em ARCHIVE_ALIGNMENT bytes
+//   tabela de nomes (strings terminadas em '\0')
+//   ArchiveEntry[num_entries], ordenada por name_hash
+//
+// Os carregadores leem os bytes diretamente da região mapeada, sem cópias.
+// Se não houver pacote aberto (ou o nome não estiver nele), os arquivos são
+// lidos do disco normalmente.
+
+#define ARCHIVE_MAGIC     0x4B415043u // "CPAK"
+#define ARCHIVE_VERSION   1u
+#define ARCHIVE_ALIGNMENT 64u
+
+struct ArchiveHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_entries;
+    uint32_t reserved;
+    uint64_t toc_offset;   // Deslocamento do primeiro ArchiveEntry
+    uint64_t names_offset; // Deslocamento da tabela de nomes
+};
+
+struct ArchiveEntry
+{
+    uint64_t name_hash;    // FNV-1a do nome normalizado
+    uint64_t content_hash; // FNV-1a do conteúdo
+    uint64_t offset;       // Deslocamento do blob desde o início do arquivo
+    uint64_t size;         // Tamanho do blob em bytes
+    uint32_t name_offset;  // Deslocamento do nome dentro da tabela de nomes
+    uint32_t name_length;
+};
+
+// Conteúdo de um asset. "data" aponta para dentro do pacote mapeado ou, se o
+// asset veio do disco, para "storage".
+struct AssetFile
+{
+    const char*       data;
+    size_t            size;
+    std::vector<char> storage;
+};
+
+// Abre e mapeia o pacote. Retorna falso se o arquivo não existe ou é inválido.
+bool Archive_Open(const char* filename);
+void Archive_Close();
+bool Archive_IsOpen();
+
+// Recalcula o hash de conteúdo de todos os blobs. Retorna falso se algum não
+// confere com a tabela.
+bool Archive_Verify();
+
+// Escreve um pacote contendo os arquivos "paths" (usado pela ferramenta
+// "tools/packer.cpp"). Retorna falso em caso de erro.
+bool Archive_Write(const char* filename, const std::vector<std::string>& paths);
+
+// Normaliza um caminho para o nome usado no pacote: barras "/", sem os
+// prefixos "./" e "../" ("../../data/grass.jpg" -> "data/grass.jpg").
+std::string Archive_NormalizeName(const char* path);
+
+uint64_t Archive_Hash(const void* data, size_t size);
+
+// Obtém o conteúdo de um asset: do pacote, se aberto e contendo o nome, ou do
+// disco. Pode ser chamada por qualquer thread. Retorna falso se não existe.
+bool Asset_Load(const char* path, AssetFile* file);
+
+// Com "prefer" verdadeiro, Asset_Load() lê o arquivo do disco quando ele
+// existe, mesmo que o nome esteja no pacote. Usado ao recarregar os assets
+// (F5), para que arquivos editados sejam vistos sem refazer o pacote. Pode
+// ser chamada por qualquer thread; leituras já em andamento não mudam.
+void Archive_SetPreferLooseFiles(bool prefer);
+
+// Retorna verdadeiro se o asset existe no pacote ou no disco, sem lê-lo
+bool Asset_Exists(const char* path);
+
+// Data de modificação do arquivo no disco (em segundos), ou 0 se ele não
+// existe no disco. Assets que estão apenas no pacote retornam 0.
+int64_t Asset_GetModificationTime(const char* path);
+
+// std::istream sobre um AssetFile, para as bibliotecas que leem de streams
+// (tinyobjloader), sem copiar os bytes.
+class AssetStreamBuf : public std::streambuf
+{
+public:
+    AssetStreamBuf(const char* data, size_t size)
+    {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+    {
+        char* target;
+        if (dir == std::ios_base::beg)
+            target = eback() + off;
+        else if (dir == std::ios_base::cur)
+            target = gptr() + off;
+        else
+            target = egptr() + off;
+
+        if (!(which & std::ios_base::in) || target < eback() || target > egptr())
+            return pos_type(off_type(-1));
+
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+class AssetStream : public std::istream
+{
+public:
+    explicit AssetStream(const AssetFile& file)
+        : std::istream(NULL), m_buffer(file.data, file.size)
+    {
+        rdbuf(&m_buffer);
+    }
+
+private:
+    AssetStreamBuf m_buffer;
+};
+
+#endif // _ARCHIVE_H
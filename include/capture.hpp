@@ -0,0 +1,49 @@
+#ifndef _CAPTURE_H
+#define _CAPTURE_H
+
+#include <cstdint>
+#include <vector>
+
+// Captura de quadros: a cena é desenhada em um framebuffer fora da tela (cor e
+// profundidade) e cada quadro é copiado para um anel de pixel buffers
+// (GL_PIXEL_PACK_BUFFER). glReadPixels() apenas agenda a cópia; os pixels de
+// um quadro só são lidos CAPTURE_PBO_COUNT quadros depois, quando a GPU
+// já terminou, de modo que a leitura não interrompe o pipeline.
+//
+// A conversão e a escrita dos arquivos são feitas pelas threads auxiliares
+// (veja "jobs.hpp"). O formato de saída depende do nome passado:
+//
+//   "clipe.y4m"            vídeo YUV 4:2:0 (ffmpeg -i clipe.y4m clipe.mp4)
+//   "clipe.rgb"            vídeo sem cabeçalho, RGB de 8 bits por canal
+//   "quadros/q_%05d.png"   uma imagem PNG por quadro (o número do quadro
+//                          entra no lugar de "%d" ou "%0Nd"; "%%" é um '%')
+
+#define CAPTURE_PBO_COUNT   3  // Profundidade do anel de leitura
+#define CAPTURE_MAX_PENDING 8  // Quadros sendo escritos ao mesmo tempo
+#define CAPTURE_FRAME_RATE  60 // Quadros por segundo do vídeo gerado
+
+// Cria o framebuffer e os pixel buffers e abre a saída. Deve ser chamada na
+// thread do contexto OpenGL. Com output = NULL apenas o framebuffer é criado,
+// e os quadros são lidos sob demanda com Capture_ReadPixels(). Retorna falso
+// em caso de erro.
+bool Capture_Init(int width, int height, const char* output, int frame_rate);
+bool Capture_IsActive();
+
+// Direciona a renderização para o framebuffer fora da tela
+void Capture_BeginFrame();
+
+// Agenda a leitura do quadro desenhado e entrega às threads auxiliares os
+// quadros cuja leitura já terminou
+void Capture_EndFrame();
+
+// Lê os quadros restantes, espera a escrita terminar e libera os recursos
+void Capture_Shutdown();
+
+// Lê o quadro atual do framebuffer fora da tela, esperando pela GPU, como RGB
+// de cima para baixo
+void Capture_ReadPixels(std::vector<uint8_t>* rgb, int* width, int* height);
+
+// Escreve uma imagem PNG RGB (sem compressão). Retorna falso em caso de erro.
+bool Capture_WritePng(const char* filename, const uint8_t* rgb, int width, int height);
+
+#endif // _CAPTURE_H
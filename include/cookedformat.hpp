@@ -0,0 +1,86 @@
+#ifndef _COOKEDFORMAT_H
+#define _COOKEDFORMAT_H
+
+#include <cstdint>
+
+// Formatos binários gerados pela ferramenta "tools/cooker.cpp" a partir dos
+// arquivos ".obj" e das imagens em "data/". Estes arquivos já estão no layout
+// final da GPU: em tempo de execução, basta copiá-los para os buffers.
+//
+// Todos os valores são little-endian.
+
+#define COOKED_MESH_MAGIC    0x48534D43u // "CMSH"
+#define COOKED_TEXTURE_MAGIC 0x58455443u // "CTEX"
+#define COOKED_VERSION       1u
+
+// Vértice quantizado (20 bytes, contra 40 de StreamedVertex):
+//
+//   position - 3 floats; o "w" = 1 é preenchido pelo OpenGL
+//   normal   - GL_INT_2_10_10_10_REV normalizado (x, y, z com 10 bits)
+//   texcoord - 2 GL_HALF_FLOAT
+struct CookedVertex
+{
+    float    position[3]; // (location = 0) vec4 model_coefficients
+    uint32_t normal;      // (location = 1) vec4 normal_coefficients
+    uint16_t texcoord[2]; // (location = 2) vec2 texture_coefficients
+};
+
+// Arquivo ".cmsh":
+//
+//   CookedMeshHeader
+//   CookedShape[num_shapes]
+//   CookedVertex[num_vertices]
+//   uint32_t[num_indices]
+//
+// Os índices de cada shape já estão ordenados para o cache de vértices e
+// para reduzir overdraw, e os vértices na ordem do primeiro uso.
+struct CookedMeshHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_vertices;
+    uint32_t num_indices;
+    uint32_t num_shapes;
+    uint32_t reserved;
+};
+
+struct CookedShape
+{
+    char     name[56]; // Terminado em '\0'
+    uint32_t first_index;
+    uint32_t num_indices;
+};
+
+// Formato dos texels de uma textura pré-processada
+enum CookedTextureFormat
+{
+    COOKED_FORMAT_SRGB8    = 1, // 3 bytes por texel, linhas sem alinhamento
+    COOKED_FORMAT_BC1_SRGB = 2, // Blocos BC1 (DXT1) de 4x4 texels, 8 bytes cada
+};
+
+// Arquivo ".ctex":
+//
+//   CookedTextureHeader
+//   CookedTextureLevel[num_levels]
+//   dados de cada nível, começando em "offset" (relativo ao início do arquivo)
+//
+// A cadeia de mipmaps completa já vem pronta, até o nível 1x1.
+struct CookedTextureHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_levels;
+    uint32_t format; // CookedTextureFormat
+};
+
+struct CookedTextureLevel
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t offset;
+    uint32_t size;
+};
+
+#endif // _COOKEDFORMAT_H
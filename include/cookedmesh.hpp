@@ -0,0 +1,18 @@
+#ifndef _COOKEDMESH_H
+#define _COOKEDMESH_H
+
+#include "./objstream.hpp"
+
+// Carregamento de modelos pré-processados por "tools/cooker.cpp" (arquivos
+// ".cmsh", veja "cookedformat.hpp"). Os vértices e índices já estão no
+// formato final, então não há nenhum processamento em tempo de execução:
+//
+//   CookedMesh_Read()   - qualquer thread: obtém e valida o arquivo
+//   CookedMesh_Upload() - thread OpenGL: copia os dados para a GPU e
+//                         configura o VAO. Lança std::runtime_error se o
+//                         arquivo não existe ou é inválido.
+struct CookedMeshLoad;
+CookedMeshLoad* CookedMesh_Read(const char* filename);
+void CookedMesh_Upload(CookedMeshLoad* load, StreamedMesh* mesh);
+
+#endif // _COOKEDMESH_H
@@ -0,0 +1,2198 @@
+// Arquivo gerado por "tools/sdfgen.cpp" a partir de "dejavufont.h".
+// Não edite manualmente; execute _build_fonts.bat.
+//
+// Atlas de campos de distância com sinal: 0.5 é a borda do glifo, e cada
+// unidade de 0.5 corresponde a 4 texels. As métricas seguem o formato da
+// freetype-gl, como em "dejavufont.h", incluindo a margem de cada glifo.
+#ifndef _DEJAVUFONT_SDF_H
+#define _DEJAVUFONT_SDF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DEJAVUFONT_SDF_SPREAD 4
+
+typedef struct
+{
+    uint32_t codepoint;
+    float kerning;
+} sdf_kerning_t;
+
+typedef struct
+{
+    uint32_t codepoint;
+    int width, height;
+    int offset_x, offset_y;
+    float advance_x, advance_y;
+    float s0, t0, s1, t1;
+    size_t kerning_count;
+    sdf_kerning_t kerning[1];
+} sdf_glyph_t;
+
+typedef struct
+{
+    size_t tex_width;
+    size_t tex_height;
+    unsigned char tex_data[65536];
+    float size;
+    float height;
+    float linegap;
+    float ascender;
+    float descender;
+    size_t glyphs_count;
+    sdf_glyph_t glyphs[96];
+} sdf_font_t;
+
+static const sdf_font_t dejavufont_sdf = {
+ 256, 256,
+ {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,
+  7,17,20,17,10,17,20,13,0,0,0,0,0,0,0,0,0,0,0,8,17,20,13,17,20,15,3,0,0,0,0,0,
+  0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,8,17,20,20,20,15,3,0,0,0,0,0,0,0,0,0,0,7,17,20,
+  15,3,0,0,0,0,0,0,0,0,0,3,15,20,15,3,0,0,0,0,0,0,0,10,12,12,8,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,15,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,10,19,20,17,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,8,17,20,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,35,48,52,46,29,8,0,0,0,0,0,13,
+  34,48,52,48,41,48,51,42,24,2,0,0,0,0,0,0,0,2,23,38,48,51,42,48,52,46,32,13,0,0,0,0,
+  0,0,0,0,0,8,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,10,19,20,20,17,8,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,2,23,38,48,52,52,52,46,32,13,0,0,0,0,0,0,0,0,18,35,48,52,
+  46,29,8,0,0,0,0,0,0,0,8,29,46,52,46,32,13,0,0,0,0,8,28,41,44,44,38,23,2,0,0,0,
+  0,0,0,0,0,0,0,13,34,48,52,46,29,8,0,0,0,0,0,0,0,0,0,0,0,0,18,35,48,52,46,29,
+  8,0,0,0,0,0,0,0,0,0,2,23,39,50,52,48,35,18,0,0,0,0,0,7,17,20,20,20,20,19,10,0,
+  0,0,0,0,2,23,38,48,51,42,32,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,41,63,78,84,74,53,29,3,0,0,0,7,34,
+  58,78,84,78,71,78,83,69,47,23,0,0,0,0,0,0,0,21,47,67,78,83,69,78,84,74,58,34,7,0,0,0,
+  0,0,0,0,3,29,53,71,76,67,47,23,5,0,0,0,0,0,0,0,2,23,39,50,52,52,48,38,23,2,0,0,
+  0,0,0,0,0,0,0,0,0,2,24,47,67,78,84,84,84,74,58,36,10,0,0,0,0,0,0,14,41,63,78,84,
+  74,53,28,0,0,0,0,0,0,3,29,53,74,84,74,58,36,10,0,0,0,28,53,71,76,76,67,47,23,0,0,0,
+  0,0,0,0,0,7,17,34,58,78,84,74,53,28,15,3,0,0,0,0,0,0,0,0,0,14,41,63,78,84,74,53,
+  28,0,0,0,0,0,0,0,0,0,23,47,67,81,84,78,63,41,17,0,0,0,13,34,48,52,52,52,52,50,39,23,
+  2,0,0,0,23,47,67,78,83,73,58,34,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,56,85,106,116,98,74,46,15,0,0,0,17,48,
+  78,103,116,103,98,108,114,92,67,38,8,0,0,0,0,0,5,35,63,92,108,114,92,103,116,103,78,48,17,0,0,0,
+  0,0,0,8,28,46,74,98,108,92,67,46,35,18,0,0,0,0,0,0,23,47,67,81,84,84,78,67,47,21,0,0,
+  0,0,0,0,0,0,0,0,0,23,47,69,92,108,116,116,116,103,80,53,23,0,0,0,0,0,0,25,56,85,106,116,
+  98,71,41,10,0,0,0,0,0,18,46,74,98,116,103,80,53,23,0,0,10,41,71,98,108,108,92,67,38,8,0,0,
+  0,0,0,0,13,34,48,52,78,103,116,98,71,52,46,29,8,0,0,0,0,0,0,0,0,25,56,85,106,116,98,71,
+  41,10,0,0,0,0,0,0,0,8,38,67,92,109,116,106,86,60,31,0,0,3,32,58,78,84,84,84,84,81,67,47,
+  21,0,0,8,38,67,92,108,114,103,78,49,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,141,116,84,52,20,0,0,0,20,52,
+  84,116,146,124,108,139,135,108,76,44,12,0,0,0,0,7,17,43,75,106,131,135,108,116,141,116,84,52,20,0,0,0,
+  0,0,8,30,53,71,84,116,135,108,84,75,63,41,17,0,0,0,0,17,41,67,92,109,116,116,108,92,64,41,17,0,
+  0,0,0,0,0,0,0,0,8,38,67,92,114,135,146,147,141,124,92,60,28,0,0,0,0,0,0,28,60,92,124,139,
+  108,76,44,12,0,0,0,0,7,35,63,89,116,141,124,92,60,28,0,0,12,44,76,108,135,135,108,78,52,25,0,0,
+  0,0,0,7,34,58,78,84,84,116,139,108,83,84,74,53,28,0,0,0,0,0,0,7,17,28,60,92,124,139,108,76,
+  44,20,15,3,0,0,0,0,0,12,44,76,108,135,146,131,100,68,36,4,0,11,42,73,103,116,116,116,116,109,92,63,
+  33,2,0,12,44,76,108,135,139,120,91,59,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,20,52,
+  84,116,147,124,108,139,139,108,76,44,12,0,0,0,13,34,48,52,83,114,139,131,100,124,139,114,83,51,24,2,0,0,
+  0,3,29,53,75,98,109,120,139,116,116,106,86,60,31,0,0,0,0,31,60,86,109,135,147,146,131,109,86,60,31,17,
+  7,0,0,0,0,0,0,0,17,48,78,108,135,146,124,116,124,120,91,59,28,0,0,0,0,0,0,28,60,92,124,139,
+  108,76,44,12,0,0,0,0,17,48,78,106,131,139,108,80,53,23,0,0,8,38,67,92,120,146,120,96,67,38,8,0,
+  0,0,0,17,48,78,103,116,106,116,139,108,114,116,98,71,41,10,0,0,0,0,13,34,48,52,60,92,124,139,108,76,
+  52,52,46,29,8,0,0,0,0,15,46,76,108,139,152,124,99,67,36,4,0,12,44,76,108,139,147,147,141,131,100,68,
+  36,4,0,12,44,76,108,139,155,124,92,60,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,20,52,
+  84,116,147,124,108,139,139,108,76,44,12,0,0,7,34,58,78,84,85,116,147,120,103,131,139,108,83,69,47,21,0,0,
+  0,15,46,74,98,120,139,147,157,147,141,131,100,71,41,10,0,0,10,41,71,100,131,141,120,120,141,131,100,71,52,48,
+  35,18,0,0,0,0,0,0,20,52,84,116,146,131,103,89,92,91,75,49,20,5,0,0,0,0,0,28,60,92,124,139,
+  108,76,44,12,0,0,0,3,32,58,89,116,146,124,99,71,41,10,0,0,0,23,50,81,109,139,135,108,76,46,17,0,
+  0,0,0,20,52,84,116,135,131,124,139,116,139,131,106,75,43,12,0,0,0,7,34,58,78,84,84,92,124,139,108,84,
+  84,84,74,53,28,0,0,0,0,20,52,84,116,141,139,114,85,56,28,0,0,10,41,71,98,109,116,116,116,106,86,60,
+  31,0,0,12,44,76,108,131,139,124,92,60,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,20,52,
+  84,116,147,124,108,139,139,108,76,44,12,0,0,17,48,78,103,116,116,124,147,124,120,141,139,116,114,92,63,33,2,0,
+  0,23,53,84,116,141,141,124,141,120,131,131,106,75,43,12,0,0,12,44,76,108,139,131,103,103,124,135,108,78,84,78,
+  63,41,14,0,0,0,0,0,17,48,78,108,135,135,108,80,60,59,49,52,46,35,18,0,0,0,0,28,60,92,124,139,
+  108,76,44,12,0,0,0,13,42,73,103,124,139,114,85,56,28,0,0,0,0,10,41,71,98,124,141,116,86,60,31,0,
+  0,0,0,15,46,74,96,108,124,147,157,147,116,106,86,63,35,5,0,0,0,17,48,78,103,116,116,116,131,141,120,116,
+  116,116,98,71,41,10,0,0,0,27,58,89,116,147,131,103,73,42,14,0,0,0,28,53,71,81,84,84,84,75,63,41,
+  17,0,0,8,38,67,92,106,108,99,80,53,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,20,52,
+  84,116,139,120,108,131,131,106,75,43,12,0,0,20,52,84,116,141,147,152,157,147,147,163,147,146,131,100,68,36,4,0,
+  0,28,60,92,124,147,120,116,139,108,100,106,86,63,35,5,0,0,10,41,71,99,124,141,120,124,141,131,100,108,116,106,
+  85,56,25,0,0,0,0,0,28,53,74,103,124,146,124,103,74,53,74,84,75,63,41,14,0,0,0,28,60,92,124,135,
+  108,76,44,12,0,0,0,20,51,83,114,139,139,108,76,44,14,0,0,0,0,0,28,58,89,116,147,131,100,68,38,8,
+  0,0,0,17,48,78,103,116,124,139,152,139,116,114,92,63,33,2,0,0,0,20,52,84,116,141,147,147,152,163,147,147,
+  147,135,108,76,44,12,0,0,0,28,60,92,124,135,114,86,60,32,3,0,0,0,8,28,41,50,52,52,52,46,35,18,
+  0,0,0,0,23,47,63,75,76,71,56,36,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,15,46,
+  74,98,108,98,92,100,106,86,63,35,5,0,0,15,46,74,98,116,120,147,135,116,124,146,120,116,108,92,63,33,2,0,
+  0,28,60,92,124,147,120,116,139,108,76,75,63,41,18,0,0,0,0,28,56,85,114,131,139,147,139,116,114,131,135,124,
+  92,60,28,0,0,0,0,13,42,71,98,116,141,139,141,116,98,74,98,116,106,85,56,25,0,0,0,23,53,80,99,108,
+  92,67,38,8,0,0,0,20,52,84,116,147,131,100,71,41,10,0,0,0,0,0,20,52,84,116,146,135,108,76,44,12,
+  0,0,0,20,52,84,116,139,124,120,139,109,131,131,100,68,36,4,0,0,0,17,48,78,103,116,116,116,131,147,120,116,
+  116,114,92,67,38,8,0,0,0,23,53,80,99,108,92,69,42,17,0,0,0,0,0,0,10,19,20,20,20,15,5,0,
+  0,0,0,0,2,21,35,43,44,41,28,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,3,29,
+  53,71,76,71,63,71,75,63,41,18,0,0,7,34,58,78,84,89,116,147,120,103,131,139,108,84,78,67,47,21,0,0,
+  0,23,53,84,116,141,141,124,139,114,99,85,69,47,23,0,0,0,0,14,42,69,92,106,116,116,131,139,139,124,116,99,
+  80,53,28,0,0,0,0,23,53,83,114,139,131,114,135,139,114,92,116,141,124,92,60,28,0,0,0,10,36,56,71,76,
+  67,47,23,0,0,0,0,25,56,85,116,147,124,99,67,36,4,0,0,0,0,0,17,48,78,108,139,139,108,76,44,12,
+  0,0,0,15,46,74,98,108,99,116,139,108,103,108,92,63,33,2,0,0,0,7,34,58,74,84,84,92,124,139,109,84,
+  84,83,69,47,23,0,0,0,0,10,36,56,71,76,67,47,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,5,12,12,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,0,8,
+  28,41,44,41,33,41,43,35,18,0,0,0,17,48,78,103,116,116,124,147,124,120,141,139,116,114,92,63,33,2,0,0,
+  0,15,46,74,98,120,139,147,157,139,124,114,92,67,41,14,0,0,0,0,24,52,84,116,135,131,114,116,147,147,141,120,
+  98,71,41,10,0,0,0,31,60,92,124,141,116,92,116,141,135,109,116,147,124,92,60,28,0,0,0,0,12,28,41,44,
+  38,23,2,0,0,0,0,28,60,92,124,152,124,92,60,28,0,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,
+  0,0,0,3,29,53,71,76,84,116,135,108,76,76,67,47,21,0,0,0,0,0,13,32,46,52,60,92,124,139,108,76,
+  52,51,42,24,2,0,0,0,0,0,12,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,60,92,124,135,114,83,51,20,0,0,0,0,0,
+  0,10,12,10,2,10,12,5,0,0,0,0,20,52,84,116,141,147,155,157,147,147,163,147,146,131,100,68,36,4,0,0,
+  0,3,29,53,75,98,109,124,149,139,147,135,109,85,56,28,0,0,0,0,15,46,74,98,108,100,109,139,135,116,131,139,
+  109,81,50,19,0,0,4,36,68,100,131,139,108,78,98,120,146,131,120,141,116,84,53,23,0,0,0,0,0,0,10,12,
+  8,0,0,0,0,0,0,28,59,91,120,147,124,92,60,31,0,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,
+  0,0,0,0,8,28,41,46,74,98,108,92,67,44,38,23,2,0,0,0,0,0,0,3,15,28,60,92,124,135,108,76,
+  44,20,13,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,53,80,99,108,92,69,42,13,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,15,46,74,98,116,120,147,135,116,131,146,120,116,108,92,63,33,2,0,0,
+  0,0,18,35,53,71,84,116,139,109,124,149,124,99,67,36,4,0,0,0,3,29,53,71,76,84,116,147,116,92,114,139,
+  116,84,52,20,0,0,4,36,67,99,124,146,116,92,78,106,131,152,147,135,108,76,46,15,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,19,50,81,109,139,139,108,76,44,12,
+  0,0,0,0,0,0,10,29,53,71,76,67,47,23,8,0,0,0,0,0,0,0,0,0,0,23,53,80,99,108,92,67,
+  38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,60,86,109,116,103,78,48,17,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,3,29,53,74,85,116,147,116,103,131,139,108,84,78,67,47,21,0,0,0,
+  0,14,41,63,78,84,84,116,139,108,116,147,131,100,68,36,4,0,0,0,0,8,28,41,52,84,116,146,120,103,116,141,
+  116,84,52,20,0,0,0,28,59,91,120,146,135,116,103,103,116,147,155,124,96,67,38,8,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,20,52,84,116,147,131,103,73,42,11,0,0,0,0,0,20,52,84,116,147,131,106,75,43,12,
+  0,0,0,0,0,0,0,8,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,10,36,56,71,76,67,47,
+  23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,36,68,100,131,146,116,84,52,20,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,8,33,63,92,124,139,109,114,139,131,100,71,48,38,23,2,0,0,0,
+  0,25,56,85,106,116,108,116,139,109,120,147,131,100,68,36,4,0,0,0,0,0,0,17,48,78,108,131,141,131,139,135,
+  109,81,50,19,0,0,0,20,49,78,106,131,146,141,131,124,139,147,149,135,108,78,48,17,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,19,50,81,109,139,139,108,76,46,17,0,0,0,0,3,32,60,91,120,147,124,99,67,36,5,
+  0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,44,38,23,
+  2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,36,67,99,124,135,114,83,51,20,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,4,36,67,99,124,131,106,116,135,120,92,63,33,8,0,0,0,0,0,
+  0,28,60,92,124,146,135,131,149,131,146,135,114,86,60,31,0,0,0,0,0,0,0,8,38,67,92,109,131,139,131,114,
+  92,67,39,10,0,0,0,7,35,63,86,106,124,135,139,139,131,116,124,135,116,84,52,20,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,10,41,71,98,124,141,116,89,60,32,3,0,0,0,15,46,74,103,131,139,114,83,56,28,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,8,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,56,80,103,108,92,69,42,13,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,56,80,99,106,86,98,108,96,75,49,21,0,0,0,0,0,0,
+  0,23,53,80,103,124,131,139,152,139,131,114,92,69,42,17,0,0,0,0,0,0,0,0,23,47,67,92,103,108,106,92,
+  69,47,23,0,0,0,0,0,18,41,63,80,96,108,108,108,103,86,99,108,96,74,46,15,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,28,56,85,116,141,131,103,73,42,14,0,0,0,28,53,84,116,141,131,106,75,43,13,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,36,58,73,76,67,47,24,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,36,56,71,75,63,71,76,67,52,30,5,0,0,0,0,0,0,
+  0,10,36,58,80,99,106,116,139,109,103,86,69,47,24,0,0,0,0,0,0,0,0,0,2,23,47,63,73,76,75,63,
+  47,24,2,0,0,0,0,0,0,18,36,53,67,76,76,76,73,60,71,76,67,52,29,3,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,15,46,74,103,124,139,109,85,56,25,0,0,10,41,71,98,124,141,116,92,63,35,5,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,32,42,44,38,23,2,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,43,35,41,44,38,25,7,0,0,0,0,0,0,0,
+  0,0,13,36,56,67,83,114,131,106,75,60,42,24,2,0,0,0,0,0,0,0,0,0,0,2,21,33,42,44,43,35,
+  21,2,0,0,0,0,0,0,0,0,10,25,38,44,44,44,42,32,41,44,38,25,7,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,3,32,58,85,114,135,124,92,60,28,0,0,12,44,76,108,131,131,106,75,47,21,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,11,12,8,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,5,10,12,8,0,0,0,0,0,0,0,0,0,
+  0,0,0,12,28,42,69,92,100,86,63,35,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,11,12,12,5,
+  0,0,0,0,0,0,0,0,0,0,0,0,8,12,12,12,11,3,10,12,8,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,14,42,69,92,108,99,80,53,23,0,0,8,38,67,92,100,100,86,63,35,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,24,47,63,68,60,41,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,24,47,67,76,67,56,36,10,0,0,0,23,47,63,68,68,60,41,18,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,2,21,33,36,31,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,2,23,38,44,38,28,12,0,0,0,0,2,21,33,36,36,31,17,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,2,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,8,12,8,0,0,0,0,0,0,0,0,2,4,4,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,0,0,7,17,20,20,20,13,0,0,
+  0,0,0,0,0,0,0,0,0,10,17,20,20,20,13,0,0,0,0,0,0,0,0,0,0,0,8,15,20,20,20,19,
+  10,0,0,0,0,0,0,0,0,0,0,0,10,17,20,20,20,20,13,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,7,17,20,20,15,3,0,0,0,0,0,0,0,0,7,17,20,20,20,20,20,20,15,3,0,0,0,0,0,0,
+  0,0,0,0,0,13,20,20,20,20,13,3,0,0,0,0,0,0,0,3,15,20,20,20,20,20,20,20,20,17,7,0,
+  0,0,0,0,0,0,0,0,10,17,20,20,20,15,5,0,0,0,0,0,0,0,0,0,0,0,10,19,20,20,20,13,
+  0,0,0,0,0,0,0,0,0,0,13,20,20,17,7,0,0,0,0,0,0,0,0,8,17,20,13,3,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,3,11,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,18,35,48,52,46,29,8,0,0,0,0,0,0,2,21,35,48,52,52,51,42,28,12,
+  0,0,0,0,0,0,0,12,28,41,48,52,52,51,42,24,2,0,0,0,0,0,0,0,2,23,38,46,52,52,52,50,
+  41,28,10,0,0,0,0,0,0,0,8,28,41,48,52,52,52,51,42,28,12,0,0,0,0,0,0,0,0,0,0,0,
+  0,13,34,48,52,52,46,29,8,0,0,0,0,0,0,13,34,48,52,52,52,52,52,52,46,32,13,0,0,0,0,0,
+  0,0,0,10,28,42,51,52,52,51,42,32,13,0,0,0,0,0,8,29,46,52,52,52,52,52,52,52,52,48,34,13,
+  0,0,0,0,0,0,10,28,41,48,52,52,52,46,35,18,3,0,0,0,0,0,0,0,10,28,41,50,52,52,51,42,
+  28,12,0,0,0,0,0,0,8,28,42,51,52,48,35,18,0,0,0,0,0,2,23,38,48,51,42,32,13,0,0,0,
+  0,0,0,0,0,0,0,0,0,10,19,32,42,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,18,41,63,78,84,74,53,28,0,0,0,0,0,2,24,47,63,78,84,84,83,71,56,36,
+  13,0,0,0,0,0,13,36,56,71,78,84,84,83,69,47,23,0,0,0,0,0,0,2,24,47,67,76,84,84,84,81,
+  71,53,36,13,0,0,0,0,0,3,29,53,71,78,84,84,84,83,71,56,39,23,2,0,0,0,0,0,0,0,0,0,
+  10,36,58,78,84,84,74,53,29,3,0,0,0,0,7,34,58,78,84,84,84,84,84,84,74,58,34,7,0,0,0,0,
+  0,0,19,39,53,71,83,84,84,83,73,58,36,10,0,0,0,0,28,53,74,84,84,84,84,84,84,84,84,78,58,36,
+  10,0,0,0,0,13,36,53,71,78,84,84,84,75,63,46,29,8,0,0,0,0,0,13,36,53,71,81,84,84,83,71,
+  56,36,13,0,0,0,0,0,28,53,71,83,84,78,63,41,14,0,0,0,0,23,47,67,78,83,73,58,34,7,0,0,
+  0,0,0,0,0,0,3,15,23,39,50,58,73,76,67,47,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,7,35,63,86,106,116,98,71,41,10,0,0,0,0,24,47,69,92,106,116,116,114,99,80,58,
+  36,12,0,0,0,3,32,58,80,99,108,116,116,114,92,67,38,8,0,0,0,0,0,21,47,69,92,108,116,116,116,109,
+  98,80,58,36,12,0,0,0,0,15,46,74,98,108,116,116,116,114,99,81,67,47,21,0,0,0,0,0,0,0,0,3,
+  29,53,80,103,116,116,98,74,46,15,0,0,0,0,17,48,78,103,116,116,116,116,116,116,103,78,48,17,0,0,0,0,
+  0,18,41,64,81,98,114,116,116,114,103,80,53,23,0,0,0,10,41,71,98,116,116,116,116,116,116,116,116,103,80,53,
+  23,0,0,0,7,34,58,80,98,108,116,116,116,106,89,74,53,28,0,0,0,0,10,36,58,80,98,109,116,116,114,99,
+  80,58,36,12,0,0,0,10,41,71,98,114,116,106,85,56,25,0,0,0,8,38,67,92,108,114,103,78,49,20,0,0,
+  0,0,0,0,10,19,32,46,53,67,81,89,103,108,92,63,35,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,17,48,78,106,131,139,108,76,44,12,0,0,0,13,42,69,92,114,131,146,147,139,124,103,80,
+  56,28,0,0,0,11,42,73,103,124,139,146,147,135,108,76,44,12,0,0,0,0,2,33,63,92,114,135,141,147,147,139,
+  124,103,80,56,28,0,0,0,0,20,52,84,116,139,146,147,147,139,124,109,92,63,35,5,0,0,0,0,0,0,0,18,
+  46,74,98,124,146,141,116,84,52,20,0,0,0,0,20,52,84,116,146,147,147,147,147,141,116,84,52,20,0,0,0,0,
+  7,35,63,86,109,124,139,147,147,139,124,92,60,28,0,0,0,12,44,76,108,139,147,147,147,147,147,147,146,124,92,60,
+  28,0,0,0,20,49,78,103,124,139,146,147,141,131,116,98,71,41,10,0,0,0,28,53,80,103,124,139,147,147,139,124,
+  103,80,56,28,0,0,0,12,44,76,108,139,146,124,92,60,28,0,0,0,12,44,76,108,135,139,120,91,59,28,0,0,
+  0,0,2,23,39,50,60,74,84,92,109,116,124,131,106,75,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,3,32,60,89,116,146,131,106,75,43,12,0,0,0,23,53,83,114,135,146,131,124,135,146,124,99,
+  71,41,10,0,0,12,44,76,108,135,139,135,157,139,108,76,44,12,0,0,0,0,4,36,68,100,131,139,131,116,124,139,
+  146,124,99,71,41,10,0,0,0,20,52,84,116,131,124,116,124,135,149,131,106,75,43,12,0,0,0,0,0,0,7,35,
+  63,85,116,141,163,147,116,84,52,20,0,0,0,0,20,52,84,116,147,135,116,116,116,116,103,78,48,17,0,0,0,0,
+  17,48,78,106,131,146,131,124,120,124,120,91,59,28,0,0,0,10,41,71,98,114,116,116,116,116,120,147,139,114,83,53,
+  23,0,0,0,31,60,91,120,146,141,124,120,131,152,139,108,78,48,17,0,0,10,41,71,98,124,146,139,124,124,135,146,
+  124,99,71,41,10,0,0,12,44,76,108,139,155,124,92,60,28,0,0,0,12,44,76,108,139,155,124,92,60,28,0,0,
+  0,0,24,47,67,81,89,103,116,124,135,147,139,131,106,75,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,15,46,74,103,131,141,116,92,63,35,5,0,0,5,35,63,92,124,149,131,103,96,114,139,139,109,
+  81,50,19,0,0,8,38,67,92,108,108,116,147,139,108,76,44,12,0,0,0,0,0,31,60,86,103,108,100,89,99,116,
+  146,139,108,76,44,12,0,0,0,15,46,74,96,100,96,89,96,114,139,139,108,76,44,12,0,0,0,0,0,0,23,48,
+  78,106,124,147,159,147,116,84,52,20,0,0,0,0,20,52,84,116,147,124,92,84,84,84,74,58,34,7,0,0,0,3,
+  32,60,89,116,146,131,106,96,91,92,91,75,49,20,0,0,0,0,28,53,71,83,84,84,84,89,116,147,131,106,75,43,
+  13,0,0,4,36,68,100,131,147,120,99,91,109,131,146,116,84,52,20,0,0,17,48,78,108,139,139,114,98,96,114,139,
+  139,108,78,48,17,0,0,12,43,75,106,131,131,116,89,58,27,0,0,0,12,44,76,108,131,139,124,92,60,28,0,0,
+  0,13,42,69,92,109,116,131,141,141,139,124,114,106,86,63,35,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,3,32,58,85,116,141,131,106,75,47,21,0,0,0,12,43,75,106,131,141,116,86,84,103,124,147,116,
+  89,58,27,0,0,0,23,47,67,76,84,116,147,139,108,76,44,12,0,0,0,0,0,17,41,60,73,76,71,60,78,108,
+  139,139,108,76,44,12,0,0,0,3,29,52,66,68,81,84,91,114,139,139,108,76,44,12,0,0,0,0,0,13,39,67,
+  92,116,141,120,139,147,116,84,52,20,0,0,0,0,20,52,84,116,147,124,116,116,114,98,80,58,36,12,0,0,0,11,
+  42,73,103,131,139,114,116,116,116,109,92,74,52,25,0,0,0,0,8,28,42,51,52,52,73,103,124,146,120,92,63,35,
+  5,0,0,4,36,67,99,124,147,120,98,89,109,131,141,116,84,52,20,0,0,20,52,84,116,146,139,108,76,71,100,131,
+  146,116,85,56,25,0,0,5,35,63,86,100,106,96,74,46,17,0,0,0,8,38,67,92,106,108,99,80,53,23,0,0,
+  0,20,51,83,114,135,147,141,131,116,108,99,85,75,63,41,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,15,46,74,103,124,141,116,92,63,35,5,0,0,0,13,44,76,108,139,139,108,106,116,98,124,152,124,
+  96,66,35,3,0,0,2,23,38,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,17,32,42,44,41,58,83,114,
+  139,139,108,76,44,12,0,0,0,0,7,33,63,92,109,116,120,131,146,131,103,73,42,11,0,0,0,0,3,32,58,81,
+  109,135,131,106,131,147,116,84,52,20,0,0,0,0,20,52,84,116,147,147,147,147,139,124,103,80,56,28,0,0,0,12,
+  44,76,108,139,141,124,141,147,147,135,116,96,67,39,10,0,0,0,0,0,13,20,21,51,83,114,139,139,108,78,49,21,
+  0,0,0,0,28,56,85,116,139,141,124,116,124,146,131,106,75,46,15,0,0,20,52,84,116,146,139,108,76,71,99,124,
+  152,124,92,60,28,0,0,0,23,47,67,78,83,73,58,34,7,0,0,0,0,23,47,63,75,76,71,56,36,10,0,0,
+  0,20,52,84,116,146,147,124,116,103,89,83,71,56,46,29,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,3,32,58,85,116,141,135,108,76,47,21,0,0,0,0,20,51,83,114,139,139,108,131,141,116,116,147,131,
+  100,68,36,4,0,0,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,3,11,29,53,78,103,124,
+  149,131,103,73,42,11,0,0,0,0,4,36,68,100,131,146,147,155,124,103,86,60,32,3,0,0,0,0,18,46,74,103,
+  124,139,114,100,131,147,116,84,52,20,0,0,0,0,20,51,83,114,131,120,116,124,139,146,124,99,71,41,10,0,0,19,
+  50,81,109,139,163,146,124,116,131,146,135,109,81,50,20,0,0,0,0,0,0,7,35,63,92,120,147,131,100,71,41,10,
+  0,0,0,0,21,47,74,98,120,147,149,147,155,131,109,86,63,35,7,0,0,17,48,78,108,139,139,114,92,91,114,139,
+  155,124,99,67,36,4,0,8,38,67,92,108,114,103,78,49,20,0,0,0,0,23,47,67,81,84,78,63,41,17,0,0,
+  0,17,48,78,103,124,135,141,141,131,116,114,99,85,74,53,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,15,46,74,103,124,146,120,92,67,38,8,0,0,0,0,20,52,84,116,147,139,108,131,139,116,116,147,131,
+  100,68,36,4,0,0,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,2,28,53,74,98,120,146,
+  135,109,86,60,32,3,0,0,0,0,0,31,60,86,106,116,120,135,146,124,103,73,42,13,0,0,0,7,35,63,89,116,
+  141,131,103,100,131,147,116,84,52,29,8,0,0,0,13,42,69,92,100,92,84,99,116,146,139,108,78,48,17,0,0,20,
+  52,84,116,147,152,124,103,89,103,131,147,120,91,60,31,0,0,0,0,0,0,17,48,78,106,131,141,116,86,60,31,0,
+  0,0,0,5,35,63,92,116,141,139,124,116,131,146,131,106,78,49,21,0,0,10,41,71,98,124,146,135,124,120,131,147,
+  159,131,100,68,36,4,0,12,44,76,108,135,139,120,91,59,28,0,0,0,8,38,67,92,109,116,106,86,60,31,0,0,
+  0,7,34,58,80,96,108,116,131,139,147,139,124,116,98,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,28,53,84,116,141,135,108,78,49,23,0,0,0,0,0,19,50,81,109,139,139,108,103,108,98,116,147,131,
+  100,68,36,4,0,0,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,2,24,47,71,98,116,141,139,
+  114,92,67,41,17,0,0,0,0,0,3,17,41,63,78,84,96,109,139,139,114,83,51,20,0,0,0,17,48,78,106,131,
+  139,109,86,106,131,147,116,85,74,53,28,0,0,0,0,24,47,63,68,63,56,78,106,131,146,116,84,52,20,0,0,19,
+  50,81,109,139,146,116,85,60,91,120,147,131,100,68,36,4,0,0,0,0,0,28,56,85,116,146,135,108,76,46,17,0,
+  0,0,0,12,43,75,106,131,141,116,98,89,103,124,146,120,92,63,33,2,0,0,28,53,80,103,124,139,141,139,135,124,
+  155,124,92,63,33,2,0,12,44,76,108,139,155,124,92,60,28,0,0,0,12,44,76,108,135,146,131,100,68,36,4,0,
+  0,0,13,36,53,67,76,89,103,109,120,135,141,139,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,13,42,71,98,124,146,120,96,67,38,8,0,0,0,0,0,12,44,76,108,139,139,108,78,76,92,124,152,124,
+  92,63,33,2,0,0,0,5,21,52,84,116,147,139,108,76,44,17,1,0,0,0,0,1,24,47,69,92,114,139,139,114,
+  98,71,47,23,0,0,0,0,0,8,29,46,52,48,48,52,71,98,124,147,116,89,58,27,0,0,0,20,52,84,116,146,
+  131,116,116,120,139,147,124,116,98,71,41,10,0,0,8,28,41,44,44,42,39,68,100,131,147,116,84,52,20,0,0,12,
+  44,76,108,139,139,109,81,53,84,116,147,131,100,68,36,4,0,0,0,0,13,42,71,99,124,149,124,96,67,38,8,0,
+  0,0,0,17,48,78,108,139,139,108,76,60,89,116,147,131,100,68,36,4,0,0,10,36,58,80,99,108,116,114,108,124,
+  147,120,91,59,28,0,0,12,44,76,108,131,139,124,92,60,28,0,0,0,15,46,76,108,139,152,124,99,67,36,4,0,
+  0,0,0,10,25,38,46,60,73,81,96,108,116,124,99,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,28,53,83,114,139,135,108,78,52,25,0,0,0,0,0,0,11,42,73,103,131,146,116,92,75,103,131,146,116,
+  85,56,25,0,0,0,8,30,49,63,84,116,147,139,108,76,60,45,24,2,0,0,0,17,45,69,92,114,135,141,116,98,
+  71,60,53,36,13,0,0,0,0,28,53,74,84,78,73,66,75,103,124,147,120,91,59,28,0,0,0,20,52,84,116,141,
+  147,147,147,147,159,163,149,135,108,76,44,12,0,0,28,53,71,76,76,73,67,81,109,135,141,116,84,52,20,0,0,11,
+  42,73,103,131,147,116,92,71,92,124,149,124,99,67,36,4,0,0,0,0,21,51,83,114,139,139,109,81,53,25,0,0,
+  0,0,0,20,51,83,114,139,139,109,81,71,92,124,149,131,100,68,36,4,0,0,0,28,53,71,76,76,84,83,109,131,
+  139,114,83,51,20,0,0,8,38,67,92,106,108,99,80,53,23,0,0,0,20,52,84,116,141,139,114,85,56,28,0,0,
+  0,0,0,0,0,8,17,32,42,52,67,76,85,92,80,56,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,13,42,71,98,124,146,120,96,67,38,8,0,0,0,0,0,0,3,32,60,91,120,147,131,109,103,120,141,135,108,
+  78,48,17,0,0,0,28,53,75,92,100,116,147,139,109,100,89,69,47,21,0,0,3,32,60,89,114,135,147,120,98,92,
+  92,92,80,58,34,7,0,0,10,41,71,98,116,108,103,96,106,120,141,139,114,83,51,20,0,0,0,15,46,74,98,116,
+  116,116,116,120,141,147,124,114,92,67,38,8,0,10,41,71,98,108,108,103,99,106,120,147,135,108,76,46,15,0,0,3,
+  32,60,91,120,147,131,109,99,114,135,141,116,85,56,28,0,0,0,0,7,35,63,92,120,147,131,103,73,42,11,0,0,
+  0,0,0,13,43,75,106,131,147,124,106,99,114,131,146,120,92,63,33,2,0,0,10,41,71,98,108,103,96,109,120,147,
+  131,106,75,43,13,0,0,0,23,47,63,75,76,71,56,36,10,0,0,0,27,58,89,116,147,131,103,73,42,14,0,0,
+  0,0,0,0,0,0,0,3,11,25,38,46,56,60,53,36,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,28,53,83,114,139,139,108,78,52,25,0,0,0,0,0,0,0,0,20,50,81,109,131,152,135,124,141,141,120,96,
+  67,38,8,0,0,10,41,71,98,120,131,131,156,149,131,131,114,92,63,33,2,0,11,42,73,103,131,156,147,124,124,124,
+  124,124,103,78,48,17,0,0,12,44,76,108,139,139,131,124,131,141,141,131,103,73,42,13,0,0,0,3,29,53,74,84,
+  84,84,84,103,131,147,116,84,69,47,23,0,0,12,44,76,108,139,139,131,124,131,146,139,120,96,67,38,8,0,0,0,
+  20,50,81,109,131,152,135,124,139,146,131,106,75,46,15,0,0,0,0,17,48,78,106,131,146,116,92,63,33,3,0,0,
+  0,0,0,5,35,63,92,116,139,146,131,124,139,149,135,108,78,49,21,0,0,0,12,44,76,108,139,131,124,131,147,135,
+  114,92,63,35,5,0,0,0,2,21,35,43,44,41,28,12,0,0,0,0,28,60,92,124,135,114,86,60,32,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,8,15,25,28,23,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,10,41,71,98,124,149,124,99,71,41,10,0,0,0,0,0,0,0,0,10,39,64,86,109,124,139,139,131,120,98,75,
+  52,25,0,0,0,12,43,75,106,131,139,139,139,139,139,139,124,99,67,36,4,0,12,44,76,108,131,139,139,139,139,139,
+  139,135,114,83,51,20,0,0,10,41,71,98,120,131,139,139,139,131,120,103,86,60,32,3,0,0,0,0,8,29,46,52,
+  52,52,68,100,131,135,114,83,51,24,2,0,0,10,41,71,99,124,135,139,139,139,131,114,98,75,52,25,0,0,0,0,
+  10,39,67,92,109,124,139,139,135,124,106,86,63,35,5,0,0,0,0,20,51,83,114,135,135,108,78,48,21,0,0,0,
+  0,0,0,0,21,47,74,98,114,131,139,139,135,124,109,92,67,38,8,0,0,0,12,43,75,106,131,139,139,139,131,109,
+  92,69,47,21,0,0,0,0,0,0,5,12,12,10,0,0,0,0,0,0,23,53,80,99,108,92,69,42,17,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,44,76,108,139,135,109,81,56,28,0,0,0,0,0,0,0,0,0,0,19,41,64,85,99,108,108,106,96,75,53,
+  30,7,0,0,0,5,35,63,86,103,108,108,108,108,108,108,99,80,56,28,0,0,8,38,67,92,103,108,108,108,108,108,
+  108,108,92,69,42,13,0,0,0,28,53,75,96,103,108,108,108,106,96,75,60,41,17,0,0,0,0,0,0,3,15,20,
+  20,31,60,86,103,108,92,69,42,13,0,0,0,0,28,56,80,99,108,108,108,108,103,89,71,53,30,7,0,0,0,0,
+  0,23,47,64,85,99,108,108,108,99,80,63,41,18,0,0,0,0,0,13,42,69,92,108,108,92,67,38,8,0,0,0,
+  0,0,0,0,3,29,53,71,92,103,108,108,108,99,81,67,47,23,0,0,0,0,5,35,63,86,100,108,108,108,100,86,
+  67,47,24,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,36,56,71,76,67,47,24,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,10,41,71,98,116,116,96,67,39,12,0,0,0,0,0,0,0,0,0,0,0,19,41,56,71,76,76,75,66,52,30,
+  8,0,0,0,0,0,18,41,60,73,76,76,76,76,76,76,71,56,36,12,0,0,0,23,47,63,73,76,76,76,76,76,
+  76,76,67,47,24,0,0,0,0,8,30,52,66,73,76,76,76,75,66,52,32,17,0,0,0,0,0,0,0,0,0,0,
+  0,17,41,60,73,76,67,47,24,0,0,0,0,0,12,36,56,67,76,76,76,76,73,60,45,28,8,0,0,0,0,0,
+  0,2,21,41,56,71,76,76,76,67,56,36,18,0,0,0,0,0,0,0,24,47,67,76,76,67,47,23,0,0,0,0,
+  0,0,0,0,0,8,28,47,63,73,76,76,76,67,56,39,23,2,0,0,0,0,0,18,41,60,71,76,76,76,71,60,
+  41,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,44,38,23,2,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,28,53,74,84,84,74,52,25,0,0,0,0,0,0,0,0,0,0,0,0,0,14,28,41,44,44,43,35,25,7,
+  0,0,0,0,0,0,0,17,32,42,44,44,44,44,44,44,41,28,12,0,0,0,0,2,21,33,42,44,44,44,44,44,
+  44,44,38,23,2,0,0,0,0,0,7,25,35,42,44,44,44,43,35,25,7,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,17,32,42,44,38,23,2,0,0,0,0,0,0,12,28,38,44,44,44,44,42,32,17,1,0,0,0,0,0,0,
+  0,0,0,14,28,41,44,44,44,38,28,12,0,0,0,0,0,0,0,0,2,23,38,44,44,38,23,2,0,0,0,0,
+  0,0,0,0,0,0,2,21,33,42,44,44,44,38,28,12,0,0,0,0,0,0,0,0,17,31,41,44,44,44,41,31,
+  17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,29,46,52,52,46,29,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,5,0,0,
+  0,0,0,0,0,0,0,0,3,11,12,12,12,12,12,12,10,0,0,0,0,0,0,0,0,3,11,12,12,12,12,12,
+  12,12,8,0,0,0,0,0,0,0,0,0,3,11,12,12,12,12,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,3,11,12,8,0,0,0,0,0,0,0,0,0,0,8,12,12,12,12,11,3,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,10,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,8,12,12,8,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,3,11,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,10,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,3,15,20,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,10,17,20,20,20,15,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,15,20,20,17,8,0,0,0,0,0,0,0,
+  0,0,0,0,10,19,20,20,20,20,20,15,5,0,0,0,0,0,0,0,0,0,0,0,0,8,17,20,20,20,17,8,
+  0,0,0,0,0,0,0,3,15,20,20,20,20,20,15,5,0,0,0,0,0,0,0,0,0,0,7,17,20,20,20,20,
+  20,20,20,17,7,0,0,0,0,0,0,7,17,20,20,20,20,20,20,20,19,10,0,0,0,0,0,0,0,0,0,0,
+  0,13,20,20,20,20,13,3,0,0,0,0,0,0,0,3,15,20,20,15,3,0,7,17,20,17,7,0,0,0,0,0,
+  0,0,7,17,20,20,20,20,20,20,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,7,17,20,20,20,20,20,20,20,20,20,15,3,0,0,0,0,0,0,8,28,41,44,38,25,15,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,8,28,41,48,52,52,52,46,35,18,0,0,0,0,0,0,0,0,0,0,0,3,
+  15,20,20,20,20,15,3,0,0,0,0,0,0,0,0,0,0,0,8,29,46,52,52,48,38,23,2,0,0,0,0,0,
+  0,0,2,23,39,50,52,52,52,52,52,46,35,21,3,0,0,0,0,0,0,0,0,7,23,38,48,52,52,52,48,38,
+  23,2,0,0,0,0,8,29,46,52,52,52,52,52,46,35,18,3,0,0,0,0,0,0,0,13,34,48,52,52,52,52,
+  52,52,52,48,35,18,0,0,0,0,13,34,48,52,52,52,52,52,52,52,50,39,23,2,0,0,0,0,0,0,0,14,
+  28,42,51,52,52,51,42,32,13,0,0,0,0,0,8,29,46,52,52,46,29,13,34,48,52,48,35,18,0,0,0,0,
+  0,13,34,48,52,52,52,52,52,52,52,46,29,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,13,34,48,52,52,52,52,52,52,52,52,52,46,29,8,0,0,0,0,3,29,53,71,76,67,53,46,32,19,10,
+  0,0,0,0,0,0,0,0,0,13,34,53,71,78,84,84,84,75,63,41,23,2,0,0,0,0,0,0,0,0,14,32,
+  46,52,52,52,52,46,32,13,0,0,0,0,0,0,0,0,0,3,29,53,74,84,84,78,67,47,21,0,0,0,0,0,
+  0,0,21,47,67,81,84,84,84,84,84,75,63,47,29,8,0,0,0,0,0,0,13,34,49,67,78,84,84,84,78,67,
+  47,21,0,0,0,3,29,53,74,84,84,84,84,84,75,63,46,29,8,0,0,0,0,0,10,36,58,78,84,84,84,84,
+  84,84,84,78,63,41,14,0,0,7,34,58,78,84,84,84,84,84,84,84,81,67,47,21,0,0,0,0,0,0,19,41,
+  56,71,83,84,84,83,73,58,36,13,0,0,0,3,29,53,74,84,84,74,53,34,58,78,84,78,63,41,17,0,0,0,
+  7,34,58,78,84,84,84,84,84,84,84,74,53,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,34,58,78,84,84,84,84,84,84,84,84,84,74,53,28,0,0,0,0,15,46,74,98,108,96,84,74,60,50,41,
+  28,15,5,0,0,0,0,0,3,32,58,78,98,108,116,116,116,106,86,67,47,21,0,0,0,0,0,0,2,24,42,58,
+  74,84,84,84,84,74,58,39,19,0,0,0,0,0,0,0,0,15,46,74,98,116,116,108,92,63,33,3,0,0,0,0,
+  0,2,33,63,92,109,116,116,116,116,116,106,92,74,53,28,0,0,0,0,0,13,36,58,78,92,108,116,116,116,108,92,
+  63,35,7,0,0,15,46,74,98,116,116,116,116,116,106,89,74,53,30,7,0,0,0,0,23,53,80,103,116,116,116,116,
+  116,116,116,106,85,56,25,0,0,17,48,78,103,116,116,116,116,116,116,116,109,92,63,33,2,0,0,0,0,19,41,64,
+  85,99,114,116,116,114,103,80,58,32,3,0,0,15,46,74,98,116,116,98,71,48,78,103,116,106,86,60,31,0,0,0,
+  17,48,78,103,116,116,116,116,116,116,116,98,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,116,116,116,116,116,116,116,116,116,98,71,41,10,0,0,0,20,52,84,116,135,124,116,103,89,81,71,
+  53,46,35,18,0,0,0,0,11,42,73,103,120,139,146,147,141,131,109,92,63,35,5,0,0,0,0,0,24,47,69,85,
+  103,116,116,116,116,103,81,64,41,17,0,0,0,0,0,0,0,20,52,84,116,141,146,131,103,73,42,11,0,0,0,0,
+  0,4,36,68,100,131,147,147,147,147,141,131,116,98,71,42,13,0,0,0,3,32,58,80,103,120,135,146,147,146,131,106,
+  78,48,17,0,0,20,52,84,116,141,147,147,147,141,131,116,98,75,52,25,0,0,0,0,28,60,92,124,146,147,147,147,
+  147,147,141,124,92,60,28,0,0,20,52,84,116,146,147,147,147,147,147,147,131,100,68,36,4,0,0,0,10,39,64,86,
+  109,124,139,147,147,139,124,103,73,42,11,0,0,20,52,84,116,141,139,108,76,52,84,116,146,131,100,68,36,4,0,0,
+  20,52,84,116,146,147,147,147,147,147,135,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,141,147,147,147,147,147,147,147,135,108,76,44,12,0,0,0,20,52,84,116,139,146,141,131,116,109,98,
+  84,75,63,41,17,0,0,0,12,44,76,108,139,131,124,124,135,152,131,106,75,43,12,0,0,0,0,18,42,69,92,114,
+  124,141,147,147,141,124,109,86,60,32,3,0,0,0,0,0,3,32,60,91,120,147,155,139,108,78,48,17,0,0,0,0,
+  0,4,36,68,100,131,149,124,116,116,131,146,139,114,83,53,23,0,0,0,15,46,74,103,124,146,139,124,116,124,131,116,
+  84,52,20,0,0,20,52,84,116,147,146,120,120,131,141,141,120,96,67,38,8,0,0,0,28,60,92,124,155,135,116,116,
+  116,116,116,103,80,53,23,0,0,20,52,84,116,147,141,116,116,116,116,116,109,92,63,33,2,0,0,0,28,53,81,109,
+  131,152,131,124,120,131,135,108,76,44,12,0,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  17,48,78,103,116,120,141,152,124,116,116,96,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,116,116,116,116,116,116,116,116,114,92,67,38,8,0,0,0,15,46,74,98,108,116,131,139,147,139,124,
+  116,106,86,60,32,3,0,0,10,41,71,98,108,106,96,96,114,139,139,108,76,44,12,0,0,0,7,35,63,86,114,135,
+  141,131,116,116,131,149,131,103,73,42,11,0,0,0,0,0,13,42,73,103,131,146,124,146,116,89,60,31,0,0,0,0,
+  0,4,36,68,100,131,147,116,85,89,103,124,149,124,92,60,28,0,0,0,25,56,85,116,141,139,114,99,89,99,100,96,
+  74,46,15,0,0,20,52,84,116,147,139,108,91,103,120,146,135,108,78,48,17,0,0,0,28,60,92,124,155,124,96,84,
+  84,84,84,74,58,36,10,0,0,20,52,84,116,147,139,108,84,84,84,84,81,67,47,21,0,0,0,10,41,71,98,124,
+  149,131,109,96,91,103,108,92,67,38,8,0,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  7,34,58,78,84,103,131,147,116,89,84,74,52,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,34,58,78,84,84,84,84,84,84,84,84,84,74,53,28,0,0,0,0,3,29,53,71,78,92,103,109,124,135,149,
+  141,131,103,73,42,11,0,0,0,28,53,71,76,75,66,85,116,141,139,108,76,44,12,0,0,0,17,48,78,106,131,141,
+  116,103,89,89,109,131,139,108,78,48,17,0,0,0,0,0,20,51,83,114,139,135,116,147,131,100,71,41,10,0,0,0,
+  0,4,36,68,100,131,147,116,85,85,103,124,147,120,91,59,28,0,0,8,38,67,96,124,149,124,99,71,58,67,68,66,
+  52,29,3,0,0,20,52,84,116,147,139,108,76,78,106,131,146,116,89,58,28,0,0,0,28,60,92,124,155,124,92,84,
+  84,84,84,74,53,28,0,0,0,20,52,84,116,147,139,108,84,84,84,84,74,53,28,2,0,0,0,19,50,81,109,139,
+  139,114,86,66,60,73,76,67,47,23,2,0,0,20,52,84,116,147,139,108,84,84,85,116,147,131,100,68,36,4,0,0,
+  0,13,34,48,68,100,131,147,116,84,52,46,29,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,116,116,116,116,116,116,116,116,116,98,71,41,10,0,0,0,0,13,34,49,63,75,84,96,109,116,131,
+  157,135,108,76,44,12,0,0,0,8,28,41,44,64,86,109,124,146,131,100,71,41,10,0,0,0,27,58,89,116,146,124,
+  98,98,114,116,116,120,146,116,84,52,20,0,0,0,0,0,28,58,89,116,147,124,109,139,139,108,76,46,15,0,0,0,
+  0,4,36,68,100,131,147,124,116,116,124,146,135,109,81,50,20,0,0,12,44,76,108,135,146,116,84,56,28,36,36,35,
+  25,7,0,0,0,20,52,84,116,147,139,108,76,63,92,124,155,124,99,67,36,4,0,0,28,60,92,124,155,131,116,116,
+  116,116,116,98,71,41,10,0,0,20,52,84,116,147,139,116,116,116,116,116,98,71,41,10,0,0,0,20,52,84,116,147,
+  139,108,76,78,84,84,84,81,67,47,21,0,0,20,52,84,116,147,139,116,116,116,116,124,152,131,100,68,36,4,0,0,
+  0,0,7,36,68,100,131,147,116,84,52,20,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,141,147,147,147,147,147,147,147,135,108,76,44,12,0,0,0,7,34,58,78,91,106,116,124,135,147,139,
+  131,116,96,67,38,8,0,0,0,0,0,23,53,81,109,131,152,131,106,86,60,31,0,0,0,8,38,67,96,124,139,109,
+  98,120,139,147,146,135,147,116,84,52,20,0,0,0,0,10,41,71,99,124,141,116,99,124,141,116,85,56,28,0,0,0,
+  0,4,36,68,100,131,163,147,147,147,152,139,116,98,71,42,17,0,0,12,44,76,108,139,139,108,78,48,17,4,4,3,
+  0,0,0,0,0,20,52,84,116,147,139,108,76,59,91,120,147,131,100,68,36,4,0,0,28,60,92,124,155,152,147,147,
+  147,147,139,108,76,44,12,0,0,20,52,84,116,147,157,147,147,147,147,139,108,76,44,12,0,0,0,20,52,84,116,147,
+  131,106,78,103,116,116,116,109,92,63,33,2,0,20,52,84,116,147,157,147,147,147,147,149,163,131,100,68,36,4,0,0,
+  0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,116,116,116,116,116,116,116,116,114,92,67,38,8,0,0,0,17,48,78,103,120,131,141,141,135,124,109,
+  103,92,74,52,25,0,0,0,0,0,8,38,67,92,124,149,131,109,86,63,41,17,0,0,0,12,44,76,108,135,131,103,
+  116,141,135,120,120,139,147,116,84,52,20,0,0,0,0,19,50,81,109,139,139,108,89,116,147,124,99,67,38,8,0,0,
+  0,4,36,68,100,131,147,120,116,116,124,141,139,114,86,60,31,0,0,12,44,76,108,139,139,108,76,44,12,0,0,0,
+  0,0,0,0,0,20,52,84,116,147,139,108,76,53,84,116,147,131,100,68,36,4,0,0,28,60,92,124,155,131,116,116,
+  116,116,114,98,71,41,10,0,0,20,52,84,116,147,139,116,116,116,116,114,98,71,41,10,0,0,0,20,52,84,116,147,
+  131,100,84,116,139,147,147,131,100,68,36,4,0,20,52,84,116,147,141,116,116,116,116,124,155,131,100,68,36,4,0,0,
+  0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,34,58,74,84,84,84,84,84,84,84,84,83,69,47,23,0,0,0,0,20,52,84,116,146,139,131,116,108,96,81,
+  73,63,47,29,7,0,0,0,0,0,12,44,76,108,135,139,114,86,64,41,18,0,0,0,0,12,44,76,108,139,131,100,
+  124,141,116,96,98,120,147,116,84,52,20,0,0,0,0,25,56,85,116,147,139,116,116,124,147,135,108,76,44,13,0,0,
+  0,4,36,68,100,131,147,116,84,85,103,120,147,131,100,71,41,10,0,12,44,76,108,139,139,109,81,50,19,12,12,11,
+  3,0,0,0,0,20,52,84,116,147,139,108,76,60,92,124,149,131,100,68,36,4,0,0,28,60,92,124,155,124,96,84,
+  84,84,83,71,53,28,0,0,0,20,52,84,116,147,139,108,84,84,84,83,71,53,28,0,0,0,0,20,52,84,116,147,
+  135,108,76,98,114,124,149,131,100,68,36,4,0,20,52,84,116,147,139,108,84,84,89,116,147,131,100,68,36,4,0,0,
+  0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,13,32,46,52,52,52,52,52,52,52,52,51,42,24,2,0,0,0,0,17,48,78,103,124,109,103,89,76,67,53,
+  42,33,21,3,0,0,0,0,0,0,12,44,76,108,135,139,108,76,44,19,0,0,0,0,0,12,44,76,108,139,124,99,
+  124,139,108,76,84,116,147,116,84,52,20,0,0,0,8,38,67,96,124,152,147,147,147,147,149,139,114,83,53,25,0,0,
+  0,4,36,68,100,131,147,116,84,58,84,116,147,139,108,76,44,12,0,12,43,75,106,131,147,116,86,60,35,43,44,42,
+  32,13,0,0,0,20,52,84,116,147,139,108,76,67,96,124,152,124,96,66,35,3,0,0,28,60,92,124,155,124,92,60,
+  52,52,51,42,28,8,0,0,0,20,52,84,116,147,139,108,76,52,52,51,42,28,8,0,0,0,0,20,52,84,116,146,
+  139,108,76,71,84,116,147,131,100,68,36,4,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  0,0,14,36,68,100,131,147,116,84,52,23,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,3,15,20,20,20,20,20,20,20,20,20,13,0,0,0,0,0,0,7,34,58,80,92,81,73,60,46,38,25,
+  11,3,0,0,0,0,0,0,0,0,8,38,67,96,116,124,99,71,41,10,0,0,0,0,0,12,44,76,108,139,131,100,
+  120,141,116,98,98,120,147,116,84,52,20,0,0,0,17,48,78,108,135,141,116,116,116,116,124,149,124,96,66,35,5,0,
+  0,4,36,68,100,131,147,116,84,66,84,116,147,139,108,76,44,12,0,5,35,63,92,124,149,131,103,78,66,75,76,73,
+  58,34,7,0,0,20,52,84,116,147,139,108,76,81,109,135,141,116,85,56,25,0,0,0,28,60,92,124,155,124,92,60,
+  60,60,60,56,42,24,2,0,0,20,52,84,116,147,139,108,76,44,20,20,13,0,0,0,0,0,0,17,48,78,108,135,
+  141,116,92,71,84,116,147,131,100,68,36,4,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  0,19,41,56,68,100,131,147,116,84,60,53,36,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,36,53,60,53,42,32,17,8,0,
+  0,0,0,0,0,0,0,0,0,0,10,41,71,98,116,116,98,71,41,10,0,0,0,0,0,12,43,75,106,131,131,106,
+  114,139,139,120,124,141,147,116,84,52,20,0,0,0,23,53,84,116,146,131,106,84,84,85,116,147,131,106,75,43,12,0,
+  0,4,36,68,100,131,147,116,92,96,109,124,149,131,106,75,43,12,0,0,23,53,84,116,141,141,116,106,96,106,108,103,
+  78,48,17,0,0,20,52,84,116,147,139,109,99,109,124,149,135,108,76,46,15,0,0,0,28,60,92,124,155,124,99,92,
+  92,92,92,85,69,47,21,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,0,8,38,67,92,120,
+  146,131,114,99,103,120,147,131,100,68,36,4,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  10,39,64,85,92,106,131,147,116,96,92,80,56,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,23,28,23,11,3,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,0,0,0,0,0,5,35,63,92,124,139,114,
+  98,120,139,141,139,131,139,116,84,52,20,0,0,2,33,63,92,124,149,124,99,67,52,81,109,139,139,109,81,50,19,0,
+  0,4,36,68,100,131,152,131,124,124,131,147,139,114,92,63,35,5,0,0,15,46,74,98,120,139,146,131,124,131,139,116,
+  84,52,20,0,0,20,52,84,116,147,149,124,124,135,149,135,114,92,67,38,8,0,0,0,28,60,92,124,155,141,124,124,
+  124,124,124,114,92,63,33,2,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,0,0,23,49,78,103,
+  124,146,139,124,131,141,146,131,100,68,36,4,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,
+  19,50,81,109,124,124,146,156,131,124,124,99,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,12,44,76,108,131,135,108,76,44,12,0,0,0,0,0,0,25,56,85,116,141,131,
+  103,98,108,116,108,106,108,98,74,46,15,0,0,4,36,68,100,131,135,114,85,56,41,71,99,124,135,116,84,52,20,0,
+  0,4,36,68,100,131,139,139,139,139,139,131,114,98,71,47,21,0,0,0,3,29,53,75,98,114,131,139,139,139,131,106,
+  78,48,17,0,0,20,51,83,114,135,139,139,139,135,124,109,92,69,47,23,0,0,0,0,28,59,91,120,139,139,139,139,
+  139,139,139,131,100,68,36,4,0,20,52,84,116,139,131,106,75,43,12,0,0,0,0,0,0,0,0,0,7,34,58,80,
+  103,120,131,139,139,131,124,103,86,60,31,0,0,20,51,83,114,135,135,108,76,52,84,116,139,124,99,67,36,4,0,0,
+  20,52,84,116,139,139,139,139,139,139,135,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,8,38,67,92,106,108,92,67,38,8,0,0,0,0,0,0,15,46,74,103,124,146,
+  124,109,92,85,89,91,76,71,53,29,3,0,0,0,31,60,86,103,108,92,69,42,28,56,80,99,108,96,74,46,15,0,
+  0,0,31,60,86,103,108,108,108,108,108,100,86,71,53,28,2,0,0,0,0,8,30,53,71,89,100,108,108,108,100,86,
+  63,35,7,0,0,13,42,69,92,108,108,108,108,108,99,81,67,47,24,2,0,0,0,0,20,49,75,98,108,108,108,108,
+  108,108,108,103,86,60,31,0,0,15,46,74,98,108,106,86,63,35,5,0,0,0,0,0,0,0,0,0,0,13,36,58,
+  78,96,106,108,108,106,96,80,60,41,17,0,0,13,42,69,92,108,108,92,67,46,74,98,108,99,80,56,28,0,0,0,
+  15,46,74,98,108,108,108,108,108,108,108,92,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,23,47,63,75,76,67,47,23,0,0,0,0,0,0,0,3,32,58,81,109,131,
+  146,135,124,116,116,120,98,71,41,10,0,0,0,0,17,41,60,73,76,67,47,24,12,36,56,71,76,67,52,29,3,0,
+  0,0,17,41,60,73,76,76,76,76,76,71,60,42,28,8,0,0,0,0,0,0,8,28,45,60,71,76,76,76,71,60,
+  41,18,0,0,0,0,24,47,67,76,76,76,76,76,67,56,39,23,2,0,0,0,0,0,5,30,53,71,76,76,76,76,
+  76,76,76,73,60,41,17,0,0,3,29,53,71,76,75,63,41,18,0,0,0,0,0,0,0,0,0,0,0,0,13,34,
+  52,66,75,76,76,75,66,53,36,17,0,0,0,0,24,47,67,76,76,67,47,29,53,71,76,71,56,36,12,0,0,0,
+  3,29,53,71,76,76,76,76,76,76,76,67,47,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,2,21,35,43,44,38,23,2,0,0,0,0,0,0,0,0,13,39,64,86,106,
+  120,135,139,146,139,135,108,76,44,12,0,0,0,0,0,17,32,42,44,38,23,2,0,12,28,41,44,38,25,7,0,0,
+  0,0,0,17,32,42,44,44,44,44,44,41,31,17,0,0,0,0,0,0,0,0,0,1,17,31,41,44,44,44,41,31,
+  17,0,0,0,0,0,2,23,38,44,44,44,44,44,38,28,12,0,0,0,0,0,0,0,0,8,28,41,44,44,44,44,
+  44,44,44,42,32,17,0,0,0,0,8,28,41,44,43,35,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+  25,35,43,44,44,43,35,25,10,0,0,0,0,0,2,23,38,44,44,38,23,8,28,41,44,41,28,12,0,0,0,0,
+  0,8,28,41,44,44,44,44,44,44,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,12,12,8,0,0,0,0,0,0,0,0,0,0,0,19,41,63,78,
+  96,108,108,116,114,108,92,67,38,8,0,0,0,0,0,0,3,11,12,8,0,0,0,0,0,10,12,8,0,0,0,0,
+  0,0,0,0,3,11,12,12,12,12,12,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,10,0,
+  0,0,0,0,0,0,0,0,8,12,12,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,12,
+  12,12,12,11,3,0,0,0,0,0,0,0,10,12,12,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,5,12,12,12,12,5,0,0,0,0,0,0,0,0,0,8,12,12,8,0,0,0,10,12,10,0,0,0,0,0,0,
+  0,0,0,10,12,12,12,12,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,35,52,
+  67,76,78,84,83,76,67,47,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,25,
+  38,44,48,52,51,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  8,12,17,20,20,13,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,13,20,20,20,20,20,15,3,0,0,0,0,0,0,3,15,20,20,15,3,0,3,15,20,20,15,
+  3,0,0,0,0,0,0,0,7,17,20,17,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,20,15,
+  3,0,10,19,20,20,15,3,0,0,0,0,0,0,3,15,20,20,17,8,0,7,17,20,17,7,0,0,0,0,0,0,
+  0,0,0,8,17,20,20,20,15,3,0,0,0,0,0,0,0,0,0,7,17,20,20,20,20,20,19,10,0,0,0,0,
+  0,0,0,0,0,0,0,0,8,17,20,20,20,15,3,0,0,0,0,0,0,0,0,0,13,20,20,20,20,20,20,13,
+  3,0,0,0,0,0,0,0,0,0,0,0,0,8,17,20,20,20,19,10,0,0,0,0,0,0,0,0,0,10,19,20,
+  20,20,20,20,20,20,20,20,15,3,0,0,0,0,0,0,0,13,20,20,15,3,0,7,17,20,17,7,0,0,0,0,
+  0,0,0,7,17,20,17,7,0,0,0,10,19,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,28,42,51,52,52,52,52,46,32,13,0,0,0,0,8,29,46,52,52,46,29,8,29,46,52,52,46,
+  29,8,0,0,0,0,0,13,34,48,52,48,38,23,2,0,0,0,0,0,0,0,0,0,0,0,13,34,48,52,52,46,
+  29,19,39,50,52,52,46,29,8,0,0,0,0,8,29,46,52,52,48,38,23,34,48,52,48,35,18,0,0,0,0,0,
+  0,3,23,38,48,52,52,52,46,32,14,0,0,0,0,0,0,0,13,34,48,52,52,52,52,52,50,41,28,10,0,0,
+  0,0,0,0,0,0,3,23,38,48,52,52,52,46,32,14,0,0,0,0,0,0,8,28,42,51,52,52,52,52,51,42,
+  32,14,0,0,0,0,0,0,0,0,0,7,23,38,48,52,52,52,50,41,28,12,0,0,0,0,0,2,23,39,50,52,
+  52,52,52,52,52,52,52,52,46,32,13,0,0,0,0,8,28,42,51,52,46,29,13,34,48,52,48,35,18,0,0,0,
+  0,0,18,35,48,52,48,34,13,2,23,39,50,52,46,29,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,28,53,71,83,84,84,84,84,74,58,34,7,0,0,3,29,53,74,84,84,74,53,30,53,74,84,84,74,
+  53,28,0,0,0,0,7,34,58,78,84,78,67,47,21,0,0,0,0,0,0,0,0,0,0,10,36,58,78,84,84,74,
+  53,41,64,81,84,84,74,53,28,0,0,0,0,28,53,74,84,84,78,67,47,58,78,84,78,63,41,17,0,0,0,0,
+  8,29,47,67,78,84,84,84,74,58,41,19,0,0,0,0,0,10,36,58,78,84,84,84,84,84,81,71,53,36,13,0,
+  0,0,0,0,0,8,29,47,67,78,84,84,84,74,58,41,19,0,0,0,0,0,28,53,71,83,84,84,84,84,83,73,
+  58,41,23,2,0,0,0,0,0,0,13,34,49,67,78,84,84,84,81,71,56,36,12,0,0,0,0,21,47,67,81,84,
+  84,84,84,84,84,84,84,84,74,58,34,7,0,0,0,28,53,71,83,84,74,53,36,58,78,84,78,63,41,14,0,0,
+  0,14,41,63,78,84,78,58,36,23,47,67,81,84,74,53,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,10,41,71,98,114,116,116,116,116,103,78,48,17,0,0,15,46,74,98,116,116,98,71,53,75,98,116,116,98,
+  71,41,10,0,0,0,17,48,78,103,116,108,92,63,33,2,0,0,0,0,0,0,0,0,0,23,53,80,103,116,116,98,
+  74,63,86,109,116,116,98,71,41,10,0,0,10,41,71,98,116,116,108,92,63,78,103,116,106,86,60,31,0,0,0,3,
+  29,53,74,92,108,116,116,116,103,85,64,41,17,0,0,0,0,23,53,80,103,116,116,116,116,116,109,98,80,58,36,10,
+  0,0,0,0,3,29,53,74,92,108,116,116,116,103,85,64,41,17,0,0,0,10,41,71,98,114,116,116,116,116,114,103,
+  85,67,47,21,0,0,0,0,0,7,34,58,78,92,108,116,116,116,109,99,80,56,28,0,0,0,2,33,63,92,109,116,
+  116,116,116,116,116,116,116,116,103,78,48,17,0,0,10,41,71,98,114,116,98,71,53,80,103,116,106,85,56,25,0,0,
+  0,25,56,85,106,116,103,80,56,39,67,92,109,116,98,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,12,44,76,108,135,147,147,147,141,116,84,52,20,0,0,20,52,84,116,141,139,108,76,75,98,120,141,135,108,
+  76,44,12,0,0,0,20,52,84,116,146,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,146,141,116,
+  92,75,106,131,147,139,108,76,44,12,0,0,12,44,76,108,139,146,131,106,75,84,116,146,131,100,68,36,4,0,0,15,
+  46,74,98,116,135,146,147,141,124,109,86,60,32,3,0,0,0,28,60,92,124,146,147,147,147,147,139,124,103,80,53,28,
+  0,0,0,0,15,46,74,98,116,135,146,147,141,124,109,86,60,32,3,0,0,12,44,76,108,139,147,147,147,147,139,124,
+  109,92,63,35,5,0,0,0,0,23,49,78,103,120,135,146,147,147,139,124,99,71,41,10,0,0,4,36,68,100,131,147,
+  147,147,147,147,147,147,147,141,116,84,52,20,0,0,12,44,76,108,139,139,108,76,60,92,124,146,124,92,60,28,0,0,
+  0,28,60,92,124,146,124,99,67,50,81,109,135,139,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,8,38,67,92,109,116,120,135,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,98,120,141,135,114,92,
+  67,38,8,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,155,157,131,
+  103,84,116,141,171,139,108,76,44,12,0,0,12,44,76,108,139,171,139,114,85,84,116,147,131,100,68,36,4,0,0,28,
+  56,85,116,141,146,124,120,131,152,131,103,74,46,15,0,0,0,28,60,92,124,155,135,116,116,124,141,146,124,98,71,41,
+  10,0,0,0,28,56,85,116,141,146,124,120,131,152,131,103,74,46,15,0,0,12,44,76,108,139,146,120,116,124,135,152,
+  131,106,75,46,15,0,0,0,8,38,67,92,120,146,139,124,116,124,131,131,106,75,43,12,0,0,0,31,60,86,109,116,
+  116,120,141,152,131,116,116,116,98,74,46,15,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,25,56,85,116,147,131,106,75,53,84,116,147,135,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,23,47,67,81,84,96,124,147,116,84,52,20,0,0,20,52,84,116,147,139,108,98,120,141,139,114,92,69,
+  47,23,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,155,147,139,
+  108,92,124,149,171,139,108,76,44,12,0,0,12,44,76,108,139,170,152,124,99,84,116,147,131,100,68,36,4,0,10,41,
+  71,99,124,149,124,103,92,109,135,141,116,85,56,25,0,0,0,28,60,92,124,155,124,96,89,103,120,147,139,108,76,44,
+  12,0,0,10,41,71,99,124,149,124,103,92,109,135,141,116,85,56,25,0,0,12,44,76,108,139,139,108,84,96,114,139,
+  141,116,84,52,20,0,0,0,12,44,76,108,135,139,114,99,89,96,103,108,92,63,35,5,0,0,0,17,41,64,81,84,
+  84,100,131,147,116,89,84,84,74,53,29,3,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,19,50,81,109,139,139,108,78,60,92,124,149,124,99,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,2,23,39,50,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,139,108,120,141,139,114,98,71,47,
+  24,2,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,147,124,146,
+  116,108,135,147,157,139,108,76,44,12,0,0,12,44,76,108,139,149,131,139,108,84,116,147,131,100,68,36,4,0,17,48,
+  78,108,139,139,114,83,67,96,124,152,124,96,66,35,3,0,0,28,60,92,124,155,124,92,60,84,116,147,139,108,76,44,
+  12,0,0,17,48,78,108,139,139,114,83,67,96,124,152,124,96,66,35,3,0,12,44,76,108,139,139,108,76,75,106,131,
+  147,116,84,52,20,0,0,0,12,44,76,108,139,139,108,83,73,66,73,76,67,47,21,0,0,0,0,0,19,39,50,52,
+  68,100,131,147,116,84,52,52,46,29,8,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,11,42,73,103,131,146,116,89,73,103,131,146,116,85,56,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,10,28,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,139,120,141,141,116,98,71,53,28,
+  2,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,135,
+  131,116,146,116,139,139,108,76,44,12,0,0,12,44,76,108,139,139,120,146,120,96,116,147,131,100,68,36,4,0,20,52,
+  84,116,146,139,108,76,58,89,116,147,131,100,68,36,4,0,0,28,60,92,124,155,124,92,85,98,120,147,135,108,76,44,
+  12,0,0,20,52,84,116,146,139,108,76,58,89,116,147,131,100,68,36,4,0,12,44,76,108,139,139,108,84,91,114,139,
+  139,114,83,51,20,0,0,0,12,44,76,108,135,146,124,114,103,91,84,74,53,30,8,0,0,0,0,0,0,10,19,36,
+  68,100,131,147,116,84,52,20,15,3,0,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,3,32,60,91,120,147,131,100,83,114,139,139,108,78,48,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,157,147,163,131,106,78,53,28,8,
+  0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,120,
+  141,124,139,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,109,139,131,106,116,147,131,100,68,36,4,0,20,52,
+  84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,28,60,92,124,155,131,116,116,124,141,146,124,99,67,38,
+  8,0,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,12,44,76,108,139,141,120,116,120,131,146,
+  131,103,73,42,13,0,0,0,8,38,67,92,120,141,149,139,131,120,116,98,75,53,29,3,0,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,0,20,52,84,116,141,135,108,85,116,147,131,103,73,42,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,163,146,139,146,120,98,71,47,21,
+  0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,0,0,28,60,92,124,147,116,116,
+  141,155,131,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,124,139,114,116,147,131,100,68,36,4,0,20,52,
+  84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,28,60,92,124,155,152,147,147,139,139,124,103,80,56,28,
+  0,0,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,12,44,76,108,139,157,147,147,147,155,124,
+  106,86,60,32,3,0,0,0,0,23,49,75,98,116,131,139,141,147,141,120,98,74,46,15,0,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,0,15,46,75,106,131,139,109,92,124,147,120,92,63,33,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,14,25,28,23,28,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,146,120,116,141,139,114,92,63,36,
+  12,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,4,4,0,0,0,0,0,0,0,28,60,92,124,147,116,106,
+  131,141,116,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,116,141,131,116,147,131,100,68,36,4,0,20,52,
+  84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,0,28,60,92,124,155,131,116,116,114,108,99,80,58,36,12,
+  0,0,0,20,52,84,116,147,139,108,76,52,84,116,147,131,100,68,36,4,0,12,44,76,108,139,146,116,116,124,141,139,
+  114,86,60,32,3,0,0,0,0,5,30,53,74,92,103,108,116,131,141,141,116,85,56,25,0,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,0,5,35,63,92,124,147,120,106,131,139,109,81,50,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,18,41,56,60,53,42,60,92,124,147,116,84,52,20,0,0,20,52,84,116,147,139,108,98,124,149,131,106,80,56,
+  28,2,0,0,0,0,20,52,84,116,147,131,100,68,36,36,36,36,28,12,0,0,0,0,0,28,60,92,124,147,116,86,
+  106,116,98,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,103,131,139,120,147,131,100,68,36,4,0,20,52,
+  84,116,141,139,108,76,59,91,120,147,131,100,68,36,4,0,0,28,60,92,124,155,124,96,84,83,76,71,56,36,13,0,
+  0,0,0,20,52,84,116,141,139,108,76,59,91,120,147,131,100,68,36,4,0,12,44,76,108,139,139,108,84,103,120,147,
+  131,103,73,45,17,0,0,0,0,2,24,42,51,63,73,76,86,103,124,152,124,96,66,35,3,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,12,44,76,108,139,139,108,76,60,92,124,155,124,92,60,28,0,0,
+  0,0,0,23,53,84,116,146,131,116,141,131,106,75,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,35,63,85,92,83,73,71,100,131,147,116,84,52,20,0,0,20,52,84,116,147,139,108,81,109,135,146,124,99,71,
+  47,23,0,0,0,0,20,52,84,116,147,131,100,68,68,68,68,67,56,36,13,0,0,0,0,28,60,92,124,147,116,84,
+  78,84,76,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,89,116,147,139,159,131,100,68,36,4,0,15,46,
+  76,108,135,141,116,86,71,99,124,149,124,92,63,33,2,0,0,28,60,92,124,155,124,92,60,51,44,41,28,12,0,0,
+  0,0,0,15,46,76,108,135,141,116,86,71,99,124,147,120,92,63,33,2,0,12,44,76,108,139,139,108,76,81,109,135,
+  139,114,89,60,32,3,0,0,0,21,47,69,83,84,78,67,71,91,120,147,131,100,68,36,4,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,12,44,76,108,135,139,109,81,69,92,124,149,124,92,60,28,0,0,
+  0,0,0,17,48,78,108,139,139,120,147,124,96,66,35,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,106,124,114,103,99,114,139,139,114,83,51,20,0,0,20,52,84,116,147,139,108,76,92,116,141,139,114,92,
+  67,39,10,0,0,0,20,52,84,116,147,131,106,100,100,100,100,99,80,58,32,3,0,0,0,28,60,92,124,147,116,84,
+  52,52,76,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,81,109,135,159,163,131,100,68,36,4,0,8,38,
+  67,96,124,149,131,109,99,114,139,139,114,83,53,23,0,0,0,28,60,92,124,155,124,92,60,28,13,10,0,0,0,0,
+  0,0,0,8,38,67,96,124,149,131,109,99,114,139,139,114,83,51,21,0,0,12,44,76,108,139,139,108,76,67,92,120,
+  147,131,103,73,42,14,0,0,2,33,63,92,114,116,108,96,100,114,131,146,124,92,63,33,2,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,8,38,67,99,124,147,124,103,99,114,131,141,116,84,53,23,0,0,
+  0,0,0,10,41,71,99,124,149,131,141,116,84,53,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,146,139,131,124,139,149,131,106,75,43,13,0,0,20,52,84,116,147,139,108,76,74,103,124,149,135,109,
+  81,50,19,0,0,0,20,52,84,116,147,146,131,131,131,131,131,124,103,73,42,11,0,0,0,28,60,92,124,147,116,84,
+  52,44,76,108,139,139,108,76,44,12,0,0,12,44,76,108,139,139,108,76,92,124,149,163,131,100,68,36,4,0,0,25,
+  53,83,114,135,152,131,124,139,146,124,99,71,42,13,0,0,0,28,60,92,124,155,124,92,60,28,0,0,0,0,0,0,
+  0,0,0,0,25,53,83,114,135,152,131,124,139,146,124,99,71,42,13,0,0,12,44,76,108,139,139,108,76,51,83,114,
+  139,139,114,85,56,25,0,0,4,36,68,100,131,146,135,124,131,139,149,135,108,80,53,23,0,0,0,0,0,0,4,36,
+  68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,28,56,85,116,139,146,131,124,135,146,131,106,75,46,15,0,0,
+  0,0,0,0,28,58,89,116,147,163,139,108,76,46,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,124,131,139,139,139,124,109,86,63,35,5,0,0,20,51,83,114,135,135,108,76,58,81,109,131,135,116,
+  84,52,20,0,0,0,20,52,84,116,139,139,139,139,139,139,139,135,108,76,44,12,0,0,0,28,59,91,120,135,116,84,
+  52,43,75,106,131,135,108,76,44,12,0,0,12,44,76,108,135,135,108,76,83,114,135,139,124,99,67,36,4,0,0,13,
+  42,69,92,109,131,139,139,135,120,103,80,56,28,0,0,0,0,28,59,91,120,139,124,92,60,28,0,0,0,0,0,0,
+  0,0,0,0,13,42,69,92,109,131,139,139,157,131,106,80,56,28,0,0,0,12,44,76,108,131,135,108,76,44,71,98,
+  120,139,124,92,60,28,0,0,2,33,63,92,109,131,139,139,139,135,124,109,92,67,38,10,0,0,0,0,0,0,4,36,
+  67,99,124,135,114,83,51,20,0,0,0,0,0,0,0,15,46,74,98,114,131,139,139,135,124,106,86,63,35,5,0,0,
+  0,0,0,0,20,51,83,114,135,139,124,99,71,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,34,58,80,96,106,108,108,108,99,81,64,41,18,0,0,0,13,42,69,92,108,108,92,67,39,67,92,106,108,96,
+  74,46,15,0,0,0,15,46,74,98,108,108,108,108,108,108,108,108,92,67,38,8,0,0,0,20,49,75,98,108,96,74,
+  46,35,63,86,103,108,92,67,38,8,0,0,8,38,67,92,108,108,92,67,69,92,108,108,99,80,56,28,0,0,0,0,
+  24,47,67,86,100,108,108,108,96,78,58,36,12,0,0,0,0,20,49,75,98,108,99,80,53,23,0,0,0,0,0,0,
+  0,0,0,0,0,24,47,67,86,100,108,114,135,146,120,92,63,33,2,0,0,8,38,67,92,106,108,92,67,38,53,75,
+  98,108,99,80,53,23,0,0,0,21,47,67,86,100,108,108,108,108,99,81,67,47,23,0,0,0,0,0,0,0,0,28,
+  56,80,103,108,92,69,42,13,0,0,0,0,0,0,0,3,29,53,71,92,100,108,108,108,99,80,63,41,18,0,0,0,
+  0,0,0,0,13,42,69,92,108,108,99,80,56,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,13,36,53,66,75,76,76,76,71,56,39,19,0,0,0,0,0,24,47,67,76,76,67,47,23,47,63,75,76,67,
+  52,29,3,0,0,0,3,29,53,71,76,76,76,76,76,76,76,76,67,47,23,0,0,0,0,5,30,53,71,76,67,52,
+  29,18,41,60,73,76,67,47,23,0,0,0,0,23,47,67,76,76,67,47,47,67,76,76,71,56,36,12,0,0,0,0,
+  2,23,41,60,71,76,76,76,67,52,34,13,0,0,0,0,0,5,30,53,71,76,71,56,36,10,0,0,0,0,0,0,
+  0,0,0,0,0,2,23,41,60,71,76,92,114,131,131,100,68,36,4,0,0,0,23,47,63,75,76,67,47,23,30,53,
+  71,76,71,56,36,10,0,0,0,2,23,41,60,71,76,76,76,76,67,56,39,23,2,0,0,0,0,0,0,0,0,12,
+  36,58,73,76,67,47,24,0,0,0,0,0,0,0,0,0,8,28,47,63,71,76,76,76,67,56,36,18,0,0,0,0,
+  0,0,0,0,0,24,47,67,76,76,71,56,36,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,10,25,35,43,44,44,44,41,28,12,0,0,0,0,0,0,2,23,38,44,44,38,23,2,21,35,43,44,38,
+  25,7,0,0,0,0,0,8,28,41,44,44,44,44,44,44,44,44,38,23,2,0,0,0,0,0,8,28,41,44,38,25,
+  7,0,17,32,42,44,38,23,2,0,0,0,0,2,23,38,44,44,38,23,23,38,44,44,41,28,12,0,0,0,0,0,
+  0,0,17,31,41,44,44,44,38,25,7,0,0,0,0,0,0,0,8,28,41,44,41,28,12,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,17,31,41,47,69,92,100,100,86,60,31,0,0,0,0,2,21,35,43,44,38,23,2,8,28,
+  41,44,41,28,12,0,0,0,0,0,0,17,31,41,44,44,44,44,38,28,12,0,0,0,0,0,0,0,0,0,0,0,
+  13,32,42,44,38,23,2,0,0,0,0,0,0,0,0,0,0,2,21,33,41,44,44,44,38,28,12,0,0,0,0,0,
+  0,0,0,0,0,2,23,38,44,44,41,28,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,5,12,12,12,12,10,0,0,0,0,0,0,0,0,0,0,8,12,12,8,0,0,0,5,12,12,8,
+  0,0,0,0,0,0,0,0,0,10,12,12,12,12,12,12,12,12,8,0,0,0,0,0,0,0,0,0,10,12,8,0,
+  0,0,0,3,11,12,8,0,0,0,0,0,0,0,0,8,12,12,8,0,0,8,12,12,10,0,0,0,0,0,0,0,
+  0,0,0,0,10,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,10,12,10,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,10,24,47,63,68,68,60,41,17,0,0,0,0,0,0,5,12,12,8,0,0,0,0,
+  10,12,10,0,0,0,0,0,0,0,0,0,0,10,12,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,11,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,10,12,12,12,8,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,8,12,12,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,2,21,33,36,36,31,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,2,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,7,17,20,20,13,0,0,0,0,7,17,20,19,10,0,0,0,0,0,0,0,3,15,20,20,13,0,0,3,15,
+  20,20,15,3,0,0,0,0,0,0,0,7,17,20,17,7,0,0,0,13,20,20,15,3,0,0,0,0,0,0,0,7,
+  17,20,20,20,20,20,20,20,20,15,3,0,0,0,0,0,0,7,17,20,20,20,20,13,0,0,0,0,0,0,0,3,
+  15,20,20,13,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,20,20,20,13,0,0,0,0,0,0,0,0,
+  0,0,0,13,20,20,17,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,13,20,20,20,20,15,3,0,0,
+  0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,17,20,20,
+  20,15,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,19,20,15,3,0,0,0,0,0,0,0,0,0,0,
+  0,13,34,48,52,51,42,24,2,0,13,34,48,52,50,39,23,2,0,0,0,0,13,32,46,52,51,42,28,8,29,46,
+  52,52,46,29,8,0,0,0,0,0,18,35,48,52,48,34,13,8,28,42,51,52,46,29,8,0,0,0,0,0,18,35,
+  48,52,52,52,52,52,52,52,52,46,29,8,0,0,0,0,13,34,48,52,52,52,51,42,24,2,0,0,0,0,8,29,
+  46,52,51,42,24,2,0,0,0,0,0,0,0,0,0,0,13,34,48,52,52,52,51,42,24,2,0,0,0,0,0,0,
+  0,8,28,42,51,52,48,35,18,0,0,0,0,0,0,0,0,0,7,17,20,20,20,20,20,20,20,20,20,20,20,13,
+  0,0,0,0,0,0,0,14,25,28,25,15,3,0,0,0,0,0,0,0,0,18,35,43,51,52,52,52,46,32,17,0,
+  0,0,0,0,0,0,13,34,48,52,46,32,13,0,0,0,0,0,0,0,0,0,0,0,0,0,7,25,38,48,52,52,
+  52,46,35,18,0,0,0,0,0,0,0,0,0,0,0,0,19,39,50,52,46,29,8,0,0,0,0,0,0,0,0,0,
+  7,34,58,78,84,83,69,47,23,7,34,58,78,84,81,67,47,21,0,0,0,7,34,58,74,84,83,71,53,29,53,74,
+  84,84,74,53,28,0,0,0,0,14,41,63,78,84,78,58,36,28,53,71,83,84,74,53,28,0,0,0,0,14,41,63,
+  78,84,84,84,84,84,84,84,84,74,53,28,0,0,0,7,34,58,78,84,84,84,83,69,47,21,0,0,0,3,29,53,
+  74,84,83,69,47,23,0,0,0,0,0,0,0,0,0,7,34,58,78,84,84,84,83,69,47,21,0,0,0,0,0,0,
+  3,29,53,71,83,84,78,63,41,18,0,0,0,0,0,0,0,13,34,48,52,52,52,52,52,52,52,52,52,52,51,42,
+  24,2,0,0,0,0,18,41,56,60,56,46,29,7,0,0,0,0,0,0,19,41,63,75,83,84,84,84,74,60,41,23,
+  2,0,0,0,0,10,36,58,78,84,74,58,34,7,0,0,0,0,0,0,0,0,0,0,0,13,34,52,67,78,84,84,
+  84,75,63,41,17,0,0,0,0,0,0,0,0,0,0,17,41,64,81,84,74,53,28,0,0,0,0,0,0,0,0,0,
+  17,48,78,103,116,114,92,67,38,20,48,78,103,116,109,92,63,33,2,0,0,17,48,78,103,116,114,98,71,46,74,98,
+  116,116,98,71,41,10,0,0,0,25,56,85,106,116,103,80,58,42,71,98,114,116,98,71,41,10,0,0,0,25,56,85,
+  106,116,116,116,116,116,116,116,116,98,71,41,10,0,0,17,48,78,103,116,116,116,114,92,63,33,2,0,0,15,46,74,
+  98,116,114,92,67,38,8,0,0,0,0,0,0,0,0,17,48,78,103,116,116,116,114,92,63,33,2,0,0,0,0,0,
+  24,47,74,98,114,116,106,86,63,36,13,0,0,0,0,0,7,34,58,78,84,84,84,84,84,84,84,84,84,84,83,69,
+  47,21,0,0,0,5,35,63,85,92,85,74,52,25,0,0,0,0,0,10,39,64,86,106,114,116,116,116,103,86,67,47,
+  21,0,0,0,0,23,53,80,103,116,103,78,48,17,0,0,0,0,0,0,0,0,0,0,10,36,58,78,96,108,116,116,
+  116,106,86,60,32,3,0,0,0,0,0,0,0,0,0,31,60,86,109,116,98,71,41,10,0,0,0,0,0,0,0,0,
+  20,52,84,116,146,135,108,76,50,52,52,84,116,146,131,100,68,36,4,0,0,20,52,84,116,141,139,109,86,63,89,116,
+  141,135,108,76,44,12,0,0,0,28,60,92,124,146,124,103,73,58,83,114,139,139,108,76,44,12,0,0,0,28,60,92,
+  124,146,147,147,147,147,147,147,139,108,76,44,12,0,0,20,52,84,116,146,147,147,131,100,68,36,4,0,0,20,52,84,
+  116,141,135,108,78,52,25,0,0,0,0,0,0,0,0,20,52,84,116,141,147,147,131,100,68,36,4,0,0,0,0,19,
+  42,69,92,116,139,146,131,106,80,58,32,8,0,0,0,0,17,48,78,103,116,116,116,116,116,116,116,116,116,116,114,92,
+  63,33,2,0,0,12,43,75,106,124,116,96,67,41,17,0,0,0,0,19,50,81,109,131,139,147,147,141,131,109,92,63,
+  35,5,0,0,0,28,60,92,124,141,116,84,52,20,17,8,0,0,0,0,0,0,0,3,29,53,80,103,120,135,146,147,
+  141,131,103,73,42,11,0,0,0,0,0,0,0,13,20,36,68,100,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  19,50,81,109,139,139,108,76,81,84,74,84,116,147,131,100,68,36,4,0,0,15,46,74,98,124,149,131,103,78,106,131,
+  146,120,96,67,38,8,0,0,0,23,53,83,114,139,139,114,86,74,103,124,149,124,103,73,42,11,0,0,0,23,53,80,
+  103,116,116,116,116,116,131,157,131,106,75,43,12,0,0,20,52,84,116,147,139,116,109,92,63,33,2,0,0,15,46,74,
+  99,124,146,120,96,67,38,8,0,0,0,0,0,0,0,15,46,74,103,116,124,149,131,100,68,36,4,0,0,0,13,39,
+  64,85,114,135,146,139,146,124,103,75,53,28,2,0,0,0,20,52,84,116,141,147,147,147,147,147,147,147,147,146,131,100,
+  68,36,4,0,0,12,44,76,108,135,135,109,86,60,34,7,0,0,0,20,52,84,116,139,131,120,120,131,152,131,106,75,
+  43,12,0,0,0,28,60,92,124,147,116,84,52,52,48,38,23,2,0,0,0,0,0,15,46,74,98,124,146,139,124,116,
+  124,131,108,76,44,12,0,0,0,0,0,8,28,42,51,52,68,100,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  12,44,76,108,139,139,108,92,109,116,103,92,124,149,124,92,60,31,0,0,0,3,29,53,81,109,135,141,116,92,120,146,
+  131,106,78,52,25,0,0,0,0,13,42,71,98,120,147,131,103,85,116,141,135,109,81,58,32,3,0,0,0,10,36,58,
+  78,84,84,84,85,114,139,139,114,92,63,35,5,0,0,20,52,84,116,147,131,103,81,67,47,21,0,0,0,3,29,56,
+  85,116,141,135,108,76,47,21,0,0,0,0,0,0,0,3,32,58,78,84,116,147,131,100,68,36,4,0,0,7,34,58,
+  81,109,124,141,120,109,131,141,120,98,71,47,21,0,0,0,15,46,74,98,116,116,116,116,116,116,116,116,116,116,108,92,
+  63,33,2,0,0,8,38,67,92,116,139,131,103,78,48,17,0,0,0,15,46,74,98,108,100,91,92,109,131,139,109,81,
+  50,19,0,0,0,28,60,92,124,147,116,84,84,84,78,67,47,24,2,0,0,0,0,20,52,84,116,141,139,114,99,89,
+  99,100,92,67,38,8,0,0,0,0,13,34,53,71,83,84,84,100,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  10,41,71,100,131,139,109,108,135,141,124,92,124,147,116,84,53,23,0,0,0,0,10,39,67,92,116,146,131,114,135,139,
+  114,86,63,35,7,0,0,0,0,0,28,53,81,109,131,141,116,103,124,146,120,96,67,39,13,0,0,0,0,0,13,34,
+  48,52,52,78,103,124,149,124,99,71,47,21,0,0,0,20,52,84,116,147,131,100,68,39,23,2,0,0,0,0,15,46,
+  74,103,124,141,116,92,63,35,5,0,0,0,0,0,0,0,13,34,52,84,116,147,131,100,68,36,4,0,0,17,48,78,
+  103,124,146,124,103,86,109,135,139,114,92,63,33,2,0,0,3,29,53,74,84,84,84,84,84,84,84,84,84,84,78,67,
+  47,21,0,0,0,0,23,47,74,98,116,135,114,83,51,20,0,0,0,17,41,64,86,103,116,116,116,120,131,147,116,84,
+  52,20,0,0,0,28,60,92,124,147,116,109,116,116,108,92,69,47,23,0,0,0,0,25,56,85,116,147,131,103,73,58,
+  67,68,63,47,23,0,0,0,0,7,34,58,78,98,114,116,116,106,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,31,60,92,124,147,116,116,141,159,131,100,131,139,109,81,50,19,0,0,0,0,0,23,48,78,103,124,152,139,146,120,
+  98,71,42,18,0,0,0,0,0,0,10,39,64,89,116,146,135,120,146,131,106,78,52,25,0,0,0,0,0,0,0,7,
+  17,42,69,92,120,146,135,109,81,56,28,2,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,3,32,
+  58,85,116,141,131,106,75,47,21,0,0,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,20,52,84,
+  116,135,124,103,80,67,92,114,131,131,100,68,36,4,0,0,0,8,29,46,52,52,52,52,52,52,52,52,52,52,48,38,
+  23,2,0,0,0,0,3,29,53,74,98,108,92,69,42,13,0,0,3,32,60,86,109,131,141,147,147,147,152,147,116,84,
+  52,20,0,0,0,28,60,92,124,149,124,139,147,146,135,114,92,67,39,10,0,0,0,28,60,92,124,152,124,92,63,33,
+  36,36,33,21,2,0,0,0,0,21,49,78,103,120,139,147,141,131,135,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,27,58,89,116,147,120,116,147,139,139,108,135,139,108,76,44,12,0,0,0,0,0,7,34,58,85,116,141,164,135,108,
+  78,53,28,0,0,0,0,0,0,0,0,19,48,78,103,124,152,147,141,116,92,63,35,7,0,0,0,0,0,0,0,3,
+  32,58,83,114,135,141,116,92,67,39,12,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,15,
+  46,74,103,131,141,116,92,63,35,5,0,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,15,46,74,
+  96,108,99,80,58,47,69,92,100,100,86,60,31,0,0,0,0,0,3,15,20,20,20,20,20,20,20,20,20,20,17,8,
+  0,0,0,0,0,0,0,8,29,53,71,76,67,47,24,0,0,0,11,42,73,103,131,152,131,120,116,116,131,147,116,84,
+  52,20,0,0,0,28,60,92,124,155,152,131,124,131,146,135,109,81,50,21,0,0,0,28,60,92,124,149,124,96,66,35,
+  43,44,41,28,8,0,0,0,5,35,63,92,120,146,141,124,124,139,157,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,147,124,124,141,124,139,114,139,139,108,76,44,12,0,0,0,0,0,7,34,58,85,114,139,163,131,106,
+  78,53,28,0,0,0,0,0,0,0,0,7,34,58,85,116,141,156,131,103,74,47,21,0,0,0,0,0,0,0,0,23,
+  47,74,103,124,149,124,103,74,47,23,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,3,
+  32,60,89,116,146,131,106,75,46,17,0,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,3,29,52,
+  67,76,67,56,36,24,47,63,68,68,60,41,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,8,28,41,44,38,23,2,0,0,0,12,44,76,108,139,139,109,92,84,106,131,147,116,84,
+  52,20,0,0,0,28,60,92,124,155,135,109,92,106,124,147,120,92,63,33,2,0,0,23,53,84,116,147,131,106,78,66,
+  75,76,71,53,28,0,0,0,15,46,75,106,131,141,116,99,99,116,146,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,146,141,131,135,116,146,120,147,131,100,71,41,10,0,0,0,0,0,24,49,78,103,124,152,139,146,120,
+  98,71,41,17,0,0,0,0,0,0,0,0,15,46,74,103,131,147,116,89,60,32,3,0,0,0,0,0,0,0,13,39,
+  67,92,116,141,135,109,81,58,32,3,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,
+  17,48,78,106,131,141,116,89,60,32,3,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,7,25,
+  38,44,38,28,12,2,21,33,36,36,31,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,12,44,76,108,139,139,114,99,106,120,146,147,116,84,
+  52,20,0,0,0,28,60,92,124,152,124,96,67,89,116,147,131,100,68,36,4,0,0,20,51,83,114,135,141,120,106,96,
+  106,108,98,71,41,10,0,0,20,52,84,116,141,139,108,76,78,108,139,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,17,48,78,108,139,163,156,131,114,139,131,155,124,99,67,36,4,0,0,0,0,13,42,69,92,120,146,131,114,139,139,
+  109,86,60,32,3,0,0,0,0,0,0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,3,32,58,
+  81,109,135,141,116,92,67,39,28,23,10,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,
+  7,35,63,89,116,146,131,103,73,42,17,0,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  8,12,8,0,0,0,0,2,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,41,71,99,124,146,139,124,131,146,147,147,116,84,
+  52,20,0,0,0,28,60,92,124,147,116,85,56,84,116,147,131,100,68,36,4,0,0,13,42,69,92,120,139,146,131,124,
+  131,139,108,76,44,12,0,0,20,52,84,116,147,139,108,76,71,100,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,12,43,75,106,131,163,147,116,106,131,159,147,116,89,58,28,0,0,0,0,3,32,58,83,114,135,139,114,98,120,147,
+  131,103,74,47,23,0,0,0,0,0,0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,17,46,74,
+  103,124,149,124,103,74,60,60,60,53,36,13,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,
+  0,18,48,78,106,131,139,114,86,60,32,3,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,56,80,103,124,139,139,135,124,124,135,114,83,
+  51,20,0,0,0,28,60,92,124,147,116,89,58,84,116,147,131,100,68,36,4,0,0,0,24,49,75,98,114,131,139,139,
+  135,124,99,71,41,10,0,0,20,52,84,116,147,139,108,76,73,103,131,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,5,36,67,99,124,155,139,109,92,124,155,141,116,84,52,20,0,0,0,0,21,47,74,103,124,149,124,103,81,109,135,
+  141,116,92,67,38,8,0,0,0,0,0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,0,31,60,89,
+  116,141,139,109,92,92,92,92,92,80,58,34,7,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,
+  0,7,35,63,89,116,146,131,103,73,42,17,0,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,36,58,80,99,108,108,108,96,99,108,92,69,
+  42,13,0,0,0,28,60,92,124,155,124,99,71,91,120,147,131,100,68,36,4,0,0,0,5,30,53,71,89,100,108,108,
+  108,99,80,56,28,0,0,0,19,50,81,109,139,139,108,80,81,109,139,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,0,28,60,92,124,152,139,108,89,116,147,139,108,76,46,15,0,0,0,2,33,63,92,116,141,135,109,81,67,92,116,
+  146,135,108,78,48,17,0,0,0,0,0,0,4,36,68,100,131,147,116,84,52,20,0,0,0,0,0,0,10,41,71,100,
+  131,156,141,124,124,124,124,124,124,103,78,48,17,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,0,0,
+  0,0,18,48,78,106,131,139,114,86,60,32,3,0,0,0,0,20,52,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,36,56,71,76,76,76,67,71,76,67,47,
+  24,0,0,0,0,28,60,92,124,155,139,114,100,114,131,141,116,89,60,31,0,0,0,0,0,8,28,45,60,71,76,76,
+  76,67,56,36,12,0,0,0,11,42,73,103,131,146,124,106,106,120,147,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,0,25,56,85,116,139,131,103,83,114,135,135,108,76,44,12,0,0,0,4,36,68,100,131,135,120,96,67,48,78,106,
+  131,135,116,84,52,20,0,0,0,0,0,0,4,36,67,99,124,135,114,83,51,20,0,0,0,0,0,0,12,43,75,106,
+  131,139,139,139,139,139,139,139,135,114,83,51,20,0,0,20,52,84,116,147,131,100,68,42,24,2,0,0,0,0,0,0,
+  0,0,7,35,63,92,120,147,131,103,73,42,11,0,0,0,13,34,52,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,44,44,44,38,41,44,38,23,
+  2,0,0,0,0,28,60,92,124,155,147,139,131,135,149,131,106,75,46,17,0,0,0,0,0,0,1,17,31,41,44,44,
+  44,38,28,12,0,0,0,0,3,32,60,89,116,139,146,131,131,146,155,139,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,0,15,46,74,98,108,103,86,69,92,108,108,92,67,38,8,0,0,0,0,31,60,86,103,108,96,75,52,35,63,86,
+  103,108,96,74,46,15,0,0,0,0,0,0,0,28,56,80,103,108,92,69,42,13,0,0,0,0,0,0,5,35,63,86,
+  103,108,108,108,108,108,108,108,108,92,69,42,13,0,0,20,52,84,116,147,131,100,83,69,47,21,0,0,0,0,0,0,
+  0,0,0,21,50,81,109,135,139,108,76,44,12,0,0,7,34,58,78,84,116,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,8,10,12,8,0,
+  0,0,0,0,0,28,59,91,120,135,120,131,139,139,131,109,86,63,35,5,0,0,0,0,0,0,0,0,0,10,12,12,
+  12,8,0,0,0,0,0,0,0,17,46,74,98,114,131,139,135,124,124,135,108,76,44,12,0,0,0,0,0,0,0,0,
+  0,0,3,29,53,71,76,73,60,47,67,76,76,67,47,23,0,0,0,0,0,17,41,60,73,76,67,52,30,18,41,60,
+  73,76,67,52,29,3,0,0,0,0,0,0,0,12,36,58,73,76,67,47,24,0,0,0,0,0,0,0,0,18,41,60,
+  73,76,76,76,76,76,76,76,76,67,47,24,0,0,0,20,52,84,116,147,135,116,114,92,63,33,2,0,0,0,0,0,
+  0,0,0,10,39,67,92,109,124,99,71,41,10,0,0,17,48,78,103,116,120,147,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,20,49,75,98,108,96,103,108,108,100,86,64,41,18,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,3,29,53,71,92,106,108,108,99,103,108,92,67,38,8,0,0,0,0,0,0,0,0,
+  0,0,0,8,28,41,44,42,32,23,38,44,44,38,23,2,0,0,0,0,0,0,17,32,42,44,38,25,7,0,17,32,
+  42,44,38,25,7,0,0,0,0,0,0,0,0,0,13,32,42,44,38,23,2,0,0,0,0,0,0,0,0,0,17,32,
+  42,44,44,44,44,44,44,44,44,38,23,2,0,0,0,20,52,84,116,141,147,146,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,23,47,67,85,92,80,56,28,0,0,0,20,52,84,116,141,147,141,131,100,68,36,4,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,5,30,53,71,76,67,73,76,76,71,60,41,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,8,28,47,63,75,76,76,67,73,76,67,47,23,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,10,12,11,3,0,8,12,12,8,0,0,0,0,0,0,0,0,0,3,11,12,8,0,0,0,0,3,
+  11,12,8,0,0,0,0,0,0,0,0,0,0,0,0,3,11,12,8,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  11,12,12,12,12,12,12,12,12,8,0,0,0,0,0,15,46,74,98,116,116,116,108,92,63,33,2,0,0,0,0,0,
+  0,0,0,0,2,23,41,56,60,53,36,12,0,0,0,15,46,74,98,116,116,116,106,86,60,31,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,8,28,41,44,38,42,44,44,41,31,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,2,21,35,43,44,44,38,42,44,38,23,2,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,29,53,74,84,84,84,78,67,47,21,0,0,0,0,0,0,
+  0,0,0,0,0,0,14,25,28,23,10,0,0,0,0,3,29,53,74,84,84,84,75,63,41,17,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,10,12,8,11,12,12,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,12,12,12,8,11,12,8,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,29,46,52,52,52,48,38,23,2,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,29,46,52,52,52,46,35,18,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,15,20,20,20,17,8,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,15,20,20,20,15,5,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,7,17,20,20,20,17,7,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,20,20,15,3,
+  0,0,0,0,0,0,0,0,0,13,20,20,20,15,19,20,15,3,0,0,0,0,0,0,0,7,17,20,15,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,10,19,20,13,0,0,0,0,0,0,7,17,20,19,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,19,
+  20,20,20,17,7,0,0,0,0,0,0,0,0,0,0,0,7,17,20,17,20,20,15,17,20,20,13,0,0,0,0,0,
+  0,0,0,7,17,20,15,17,20,20,17,8,0,0,0,0,0,0,0,0,0,0,0,8,17,20,20,20,15,3,0,0,
+  0,0,0,0,0,0,0,7,17,20,15,19,20,20,17,7,0,0,0,0,0,0,0,0,0,0,0,10,19,20,20,17,
+  17,20,15,3,0,0,0,0,0,0,3,15,20,20,13,19,20,20,20,13,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,3,18,35,48,52,52,52,48,35,18,1,0,0,0,0,0,0,0,0,0,0,18,35,48,52,52,52,46,32,
+  13,0,0,0,0,0,0,8,28,42,51,52,52,46,50,52,46,29,8,0,0,0,0,0,13,34,48,52,46,32,13,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,13,34,48,52,46,32,13,0,0,0,0,0,0,0,0,0,0,0,8,
+  28,41,50,51,42,24,2,0,0,0,13,34,48,52,50,39,23,2,0,0,0,0,0,0,0,0,0,0,2,23,39,50,
+  52,52,52,48,35,18,0,0,0,0,0,0,0,0,0,13,34,48,52,48,52,52,46,48,52,51,42,28,8,0,0,0,
+  0,0,13,34,48,52,46,48,52,52,48,38,23,2,0,0,0,0,0,0,0,5,23,38,48,52,52,52,46,32,17,0,
+  0,0,0,0,0,0,18,35,48,52,46,50,52,52,48,35,18,1,0,0,0,0,0,0,0,8,28,41,50,52,52,48,
+  48,52,46,29,8,0,0,0,0,8,29,46,52,51,42,50,52,52,51,42,24,2,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,29,46,63,78,84,84,84,78,63,45,24,2,0,0,0,0,0,0,0,0,19,41,63,78,84,84,84,74,58,
+  34,7,0,0,0,0,13,34,53,71,83,84,84,75,81,84,74,53,28,0,0,0,0,10,36,58,78,84,74,58,34,7,
+  0,0,0,0,0,0,0,0,0,0,0,0,10,36,58,78,84,74,58,34,7,0,0,0,0,0,0,0,0,0,0,28,
+  53,71,81,83,69,47,23,0,0,7,34,58,78,84,81,67,47,21,0,0,0,0,0,0,0,0,0,0,21,47,67,81,
+  84,84,84,78,63,41,17,0,0,0,0,0,0,0,7,34,58,78,84,78,84,84,74,78,84,83,71,53,28,2,0,0,
+  0,10,36,58,78,84,74,78,84,84,78,67,47,24,2,0,0,0,0,0,8,30,49,67,78,84,84,84,74,60,41,23,
+  2,0,0,0,0,14,41,63,78,84,74,81,84,84,78,63,45,24,2,0,0,0,0,0,8,30,53,71,81,84,84,78,
+  78,84,74,53,29,3,0,0,3,29,53,74,84,83,71,81,84,84,83,69,47,23,0,0,0,0,0,0,0,0,0,0,
+  0,0,28,53,74,89,106,116,116,116,106,89,69,47,23,0,0,0,0,0,0,0,14,41,64,86,106,116,116,116,103,78,
+  48,17,0,0,0,7,34,58,78,98,114,116,116,106,109,116,98,71,41,10,0,0,0,23,53,80,103,116,103,78,48,17,
+  0,0,0,0,0,0,0,0,0,0,0,0,23,53,80,103,116,103,78,48,17,0,0,0,0,0,0,0,0,0,10,41,
+  71,98,109,114,92,67,38,8,0,17,48,78,103,116,109,92,63,33,2,0,0,0,0,0,0,0,0,2,33,63,92,109,
+  116,116,116,106,86,60,31,0,0,0,0,0,0,0,17,48,78,103,116,108,116,116,103,106,116,114,98,71,47,21,0,0,
+  0,23,53,80,103,116,103,108,116,116,108,92,69,47,23,0,0,0,0,3,29,53,75,92,108,116,116,116,103,86,67,47,
+  21,0,0,0,0,25,56,85,106,116,103,109,116,116,106,89,69,47,23,0,0,0,0,3,29,53,75,98,109,116,116,108,
+  106,116,98,74,46,15,0,0,15,46,74,98,116,114,98,109,116,116,114,92,67,38,8,0,0,0,0,0,0,0,0,0,
+  0,17,42,71,98,116,131,146,147,146,131,114,92,67,39,10,0,0,0,0,0,7,25,56,85,109,131,146,147,141,116,84,
+  52,20,0,0,0,21,48,78,103,120,139,147,141,131,131,139,108,76,44,12,0,0,0,28,60,92,124,141,116,84,52,20,
+  17,8,0,0,0,0,0,0,0,0,0,0,28,60,92,124,141,116,84,52,20,0,0,0,0,0,0,0,0,0,12,44,
+  76,108,139,135,108,76,44,12,0,20,52,84,116,146,131,100,68,36,19,20,15,3,0,0,0,0,0,4,36,68,100,131,
+  147,147,146,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,146,139,146,141,124,131,146,139,114,92,63,33,3,0,
+  0,28,60,92,124,141,124,135,146,146,135,114,92,67,38,8,0,0,0,17,46,74,98,120,135,146,147,141,131,109,92,63,
+  35,5,0,0,0,28,60,92,124,141,124,139,147,146,131,114,92,67,38,8,0,0,0,17,46,74,98,120,139,147,146,135,
+  131,141,116,84,52,20,0,0,20,52,84,116,141,135,116,139,147,147,135,108,76,44,12,0,0,0,0,0,0,0,0,0,
+  3,32,60,86,114,139,141,131,120,124,141,135,109,81,53,25,0,0,0,0,13,34,48,67,96,124,152,131,116,116,98,74,
+  46,15,0,0,5,35,63,92,116,146,141,124,124,139,157,139,108,76,44,12,0,0,0,28,60,92,124,147,116,84,52,52,
+  48,38,23,2,0,0,0,0,0,0,8,28,42,59,91,120,135,116,84,52,20,0,0,0,0,0,0,0,0,19,39,50,
+  76,108,131,131,106,75,43,12,0,20,52,84,116,147,131,100,68,39,50,52,46,32,13,0,0,0,0,0,31,60,86,109,
+  116,124,152,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,141,124,146,155,135,124,149,131,103,73,42,11,0,
+  0,28,60,92,124,155,146,131,120,131,152,135,108,76,44,12,0,0,0,28,58,89,116,141,146,124,124,131,152,131,106,75,
+  46,15,0,0,0,28,60,92,124,155,152,131,124,131,149,135,108,78,49,20,0,0,0,28,58,89,116,141,141,124,124,135,
+  156,147,116,84,52,20,0,0,20,52,84,116,147,157,146,131,124,124,131,106,75,43,12,0,0,0,0,0,0,0,0,0,
+  11,42,73,103,131,146,120,103,91,103,124,149,124,96,66,35,3,0,0,10,36,58,78,84,108,135,139,109,89,84,74,58,
+  34,7,0,0,13,43,75,106,131,146,116,99,99,116,146,139,108,76,44,12,0,0,0,28,60,92,124,147,116,84,84,84,
+  78,67,47,24,2,0,0,0,0,0,28,53,71,83,84,98,108,96,74,46,15,0,0,0,0,0,0,0,17,41,64,81,
+  84,92,106,108,92,63,35,5,0,20,52,84,116,147,131,100,68,64,81,84,74,58,34,7,0,0,0,0,17,41,64,81,
+  85,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,124,103,124,147,116,109,139,139,108,76,44,12,0,
+  0,28,60,92,124,155,131,106,92,109,135,139,108,76,46,15,0,0,10,41,71,99,124,149,124,103,96,109,135,141,116,85,
+  56,25,0,0,0,28,60,92,124,155,131,109,92,109,131,146,120,91,60,31,0,0,10,41,71,99,124,147,120,103,96,116,
+  141,147,116,84,52,20,0,0,20,52,84,116,147,149,124,103,92,96,100,86,63,35,5,0,0,0,0,0,0,0,0,0,
+  19,50,81,109,139,139,116,116,116,116,120,147,131,100,68,36,4,0,0,23,53,80,103,116,120,139,139,116,116,116,103,78,
+  48,17,0,0,20,51,83,114,139,139,108,78,78,108,139,139,108,76,44,12,0,0,0,28,60,92,124,147,116,108,116,116,
+  108,92,69,47,23,0,0,0,0,10,41,71,98,114,116,116,116,103,78,48,17,0,0,0,0,0,0,0,31,60,86,109,
+  116,116,116,114,92,67,38,8,0,20,52,84,116,147,131,100,69,92,109,116,103,78,48,17,0,0,0,0,0,19,39,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,124,92,124,146,116,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,149,124,96,68,100,131,141,116,84,52,20,0,0,12,44,76,108,139,139,109,81,67,92,124,152,124,92,
+  63,33,2,0,0,28,60,92,124,149,124,96,66,89,116,147,131,100,68,36,4,0,12,44,76,108,139,139,109,81,75,106,
+  131,147,116,84,52,20,0,0,20,52,84,116,147,139,109,81,63,66,68,60,41,18,0,0,0,0,0,0,0,0,0,0,
+  20,52,84,116,147,157,147,147,147,147,147,141,131,100,68,36,4,0,0,28,60,92,124,146,147,159,157,147,147,141,116,84,
+  52,20,0,0,20,52,84,116,147,139,108,76,71,100,131,139,108,76,44,12,0,0,0,28,60,92,124,147,124,135,146,146,
+  135,114,92,67,38,8,0,0,0,12,44,76,108,139,147,147,141,116,84,52,20,0,0,0,0,0,0,4,36,68,100,131,
+  146,147,147,135,108,76,44,12,0,20,52,84,116,147,131,100,92,114,131,141,116,84,52,20,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,116,92,124,139,108,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,12,44,76,108,139,139,108,76,56,85,116,147,131,100,
+  68,36,4,0,0,28,60,92,124,147,116,84,53,84,116,147,131,100,68,36,4,0,12,44,76,108,139,139,108,76,66,96,
+  124,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,44,35,36,31,17,0,0,0,0,0,0,0,0,0,0,0,
+  20,52,84,116,147,139,116,116,116,116,116,116,106,86,60,31,0,0,0,23,53,80,103,116,120,146,146,120,116,116,98,74,
+  46,15,0,0,20,52,84,116,147,139,108,76,73,103,131,139,108,76,44,12,0,0,0,28,60,92,124,155,146,131,120,131,
+  152,135,108,76,44,12,0,0,0,10,41,71,98,114,116,131,147,116,84,52,20,0,0,0,0,0,0,0,31,60,86,106,
+  116,124,149,139,108,76,44,12,0,20,52,84,116,147,131,100,114,135,141,120,98,74,46,15,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,116,92,124,139,108,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,12,44,76,108,139,139,108,76,58,89,116,147,131,100,
+  68,36,4,0,0,28,60,92,124,147,116,85,56,84,116,147,131,100,68,36,4,0,12,44,76,108,139,139,108,76,67,99,
+  124,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,44,12,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  19,50,81,109,139,139,109,85,84,84,84,84,75,63,41,17,0,0,0,10,36,58,78,84,108,139,139,108,84,84,74,53,
+  29,3,0,0,19,50,81,109,139,139,109,81,81,109,139,139,108,76,44,12,0,0,0,28,60,92,124,155,131,106,92,109,
+  135,139,108,76,46,15,0,0,0,0,28,53,71,83,92,124,147,116,84,52,20,0,0,0,0,0,0,0,17,41,63,78,
+  84,109,139,139,108,76,44,12,0,20,52,84,116,147,131,114,135,141,120,98,75,53,29,3,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,116,92,124,139,108,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,12,44,76,108,135,139,114,85,73,98,124,149,124,92,
+  60,31,0,0,0,28,60,92,124,152,124,99,71,92,120,147,131,100,68,36,4,0,12,44,76,108,135,139,114,83,78,108,
+  135,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  10,41,71,99,124,149,124,109,99,100,109,116,103,78,48,17,0,0,0,0,13,34,48,76,108,139,139,108,76,52,46,29,
+  8,0,0,0,11,42,73,103,131,149,124,106,106,120,147,139,108,76,44,12,0,0,0,28,60,92,124,149,124,96,68,100,
+  131,141,116,84,52,20,0,0,0,0,8,28,42,60,92,124,147,116,84,52,20,0,0,0,0,0,0,0,0,18,35,48,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,152,139,155,124,98,75,53,30,8,0,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,116,92,124,139,108,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,8,38,67,96,124,152,124,109,103,114,139,139,114,83,
+  53,23,0,0,0,28,60,92,124,155,135,114,100,114,131,141,116,89,60,31,0,0,8,38,67,99,124,149,124,109,103,120,
+  146,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,28,56,85,114,135,149,139,124,131,139,141,116,84,52,20,0,0,0,0,0,12,44,76,108,139,139,108,76,44,15,3,
+  0,0,0,0,3,32,60,86,116,139,146,131,131,146,156,139,108,76,44,12,0,0,0,28,60,92,124,147,116,84,60,92,
+  124,147,116,84,52,20,0,0,0,0,0,0,28,60,92,124,147,116,84,52,20,0,0,0,0,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,157,147,156,131,106,78,53,28,2,0,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,4,0,0,0,0,0,0,20,52,84,116,147,116,92,124,139,108,100,131,139,108,76,44,12,0,
+  0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,0,25,56,85,114,135,152,131,131,139,146,131,103,73,
+  42,13,0,0,0,28,60,92,124,155,147,139,131,135,149,131,106,75,46,17,0,0,0,28,56,85,114,139,149,131,131,141,
+  149,147,116,84,52,20,0,0,20,52,84,116,147,139,108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,14,42,69,92,109,124,135,139,139,131,124,103,74,46,15,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,0,
+  0,0,0,0,0,17,46,74,98,114,131,139,135,124,131,139,108,76,44,12,0,0,0,28,60,92,124,147,116,84,60,92,
+  124,147,116,84,52,20,0,0,0,0,0,14,28,60,92,124,147,116,84,52,25,14,0,0,0,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,141,116,131,146,120,98,71,47,23,0,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,36,23,10,0,0,0,0,0,20,52,84,116,135,116,91,120,135,108,100,131,135,108,76,44,12,0,
+  0,28,59,91,120,135,116,84,60,92,124,135,114,83,51,20,0,0,0,14,42,69,92,114,131,139,139,135,124,103,86,60,
+  32,3,0,0,0,28,60,92,124,147,120,131,139,139,124,109,86,63,35,5,0,0,0,14,42,71,98,114,131,139,139,131,
+  124,147,116,84,52,20,0,0,20,51,83,114,135,131,106,75,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,24,47,67,81,99,108,108,108,106,96,80,58,32,3,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,0,
+  0,0,0,0,0,3,29,53,71,92,106,108,108,108,139,139,108,76,44,12,0,0,0,28,60,92,124,147,116,84,60,92,
+  124,147,116,84,52,20,0,0,0,0,19,41,56,60,92,124,147,116,84,60,56,41,19,0,0,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,131,106,114,139,139,114,92,67,41,14,0,0,0,0,0,0,20,52,
+  84,116,147,131,100,68,60,53,36,13,0,0,0,0,15,46,74,98,108,96,75,98,108,92,86,103,108,92,67,38,8,0,
+  0,20,49,75,98,108,96,74,53,80,99,108,92,69,42,13,0,0,0,0,24,47,69,86,100,108,108,108,96,80,60,41,
+  17,0,0,0,0,28,60,92,124,147,116,103,108,108,99,81,64,41,18,0,0,0,0,0,28,53,71,92,103,108,108,100,
+  124,147,116,84,52,20,0,0,13,42,69,92,108,106,86,63,35,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,2,23,39,56,67,76,76,76,75,66,53,36,13,0,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,0,
+  0,0,0,0,0,10,41,71,98,108,108,100,103,120,146,131,106,75,43,12,0,0,0,28,60,92,124,147,116,84,60,92,
+  124,147,116,84,52,20,0,0,0,14,41,64,85,92,96,124,147,120,96,92,85,64,41,14,0,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,131,100,98,120,146,135,109,85,58,32,3,0,0,0,0,0,20,52,
+  84,116,141,135,109,96,92,80,58,32,3,0,0,0,3,29,53,71,76,67,53,71,76,67,60,73,76,67,47,23,0,0,
+  0,5,30,53,71,76,67,52,36,56,71,76,67,47,24,0,0,0,0,0,2,24,42,60,71,76,76,76,67,53,36,17,
+  0,0,0,0,0,28,60,92,124,147,116,84,76,76,71,56,39,19,0,0,0,0,0,0,8,28,47,63,73,76,76,92,
+  124,147,116,84,52,20,0,0,0,24,47,67,76,75,63,41,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,28,38,44,44,44,43,35,25,10,0,0,0,0,0,0,0,12,44,76,108,139,139,108,76,44,12,0,
+  0,0,0,0,0,12,44,76,108,139,139,131,131,141,141,116,92,63,35,5,0,0,0,28,60,92,124,147,116,84,60,92,
+  124,147,116,84,52,20,0,0,0,25,56,85,109,124,124,135,159,135,124,124,109,85,56,25,0,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,147,131,100,78,103,124,152,124,103,73,42,11,0,0,0,0,0,15,46,
+  74,103,131,152,131,124,124,103,73,42,11,0,0,0,0,8,28,41,44,38,28,41,44,38,32,42,44,38,23,2,0,0,
+  0,0,8,28,41,44,38,25,12,28,41,44,38,23,2,0,0,0,0,0,0,0,17,31,41,44,44,44,38,25,10,0,
+  0,0,0,0,0,28,60,92,124,147,116,84,52,44,41,28,12,0,0,0,0,0,0,0,0,2,21,33,42,44,60,92,
+  124,147,116,84,52,20,0,0,0,2,23,38,44,43,35,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,8,12,12,12,12,5,0,0,0,0,0,0,0,0,0,12,44,76,108,131,135,108,76,44,12,0,
+  0,0,0,0,0,11,42,73,103,124,135,139,139,131,116,98,74,47,21,0,0,0,0,28,59,91,120,135,116,84,60,92,
+  124,135,114,83,51,20,0,0,0,28,60,92,124,139,139,139,139,139,139,139,124,92,60,28,0,0,0,0,0,14,25,44,
+  76,108,139,139,108,76,44,12,0,20,52,84,116,139,131,100,68,85,114,131,135,108,76,44,12,0,0,0,0,0,3,32,
+  60,86,109,131,139,139,135,108,76,44,12,0,0,0,0,0,0,10,12,8,0,10,12,8,3,11,12,8,0,0,0,0,
+  0,0,0,0,10,12,8,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,10,12,12,12,8,0,0,0,
+  0,0,0,0,0,28,60,92,124,135,114,83,51,20,10,0,0,0,0,0,0,0,0,0,0,0,0,3,11,28,60,92,
+  124,135,114,83,51,20,0,0,0,0,0,8,12,12,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,38,67,92,103,108,92,67,38,8,0,
+  0,0,0,0,0,3,32,58,80,99,108,108,108,106,92,74,53,29,3,0,0,0,0,20,49,75,98,108,96,74,53,80,
+  99,108,92,69,42,13,0,0,0,23,53,80,99,108,108,108,108,108,108,108,99,80,53,23,0,0,0,0,19,41,56,60,
+  81,109,139,139,108,76,44,12,0,15,46,74,98,108,103,86,60,69,92,106,108,92,67,38,8,0,0,0,0,0,0,17,
+  41,64,86,100,108,108,108,92,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,23,53,80,99,108,92,69,42,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,53,80,
+  99,108,92,69,42,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,47,63,73,76,67,47,23,0,0,
+  0,0,0,0,0,0,13,36,56,67,76,76,76,75,63,47,29,8,0,0,0,0,0,5,30,53,71,76,67,52,36,56,
+  71,76,67,47,24,0,0,0,0,10,36,56,71,76,76,76,76,76,76,76,71,56,36,10,0,0,0,14,41,64,85,92,
+  99,120,147,131,103,73,42,11,0,3,29,53,71,76,73,60,41,47,63,75,76,67,47,23,0,0,0,0,0,0,0,0,
+  19,41,60,71,76,76,76,67,47,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,10,36,56,71,76,67,47,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,36,56,
+  71,76,67,47,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,21,33,42,44,38,23,2,0,0,
+  0,0,0,0,0,0,0,12,28,38,44,44,44,43,35,21,3,0,0,0,0,0,0,0,8,28,41,44,38,25,12,28,
+  41,44,38,23,2,0,0,0,0,0,12,28,41,44,44,44,44,44,44,44,41,28,12,0,0,0,0,25,56,85,109,124,
+  124,139,141,120,92,63,33,3,0,0,8,28,41,44,42,32,17,21,35,43,44,38,23,2,0,0,0,0,0,0,0,0,
+  0,17,31,41,44,44,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,12,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,
+  41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,11,12,8,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,8,12,12,12,12,5,0,0,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,
+  10,12,8,0,0,0,0,0,0,0,0,0,10,12,12,12,12,12,12,12,10,0,0,0,0,0,0,28,60,92,124,139,
+  139,135,124,99,75,49,21,0,0,0,0,0,10,12,11,3,0,0,5,12,12,8,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,10,12,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,53,80,99,108,
+  108,108,96,80,56,30,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,36,56,71,76,
+  76,76,67,53,36,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,44,
+  44,44,38,25,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,
+  12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,8,17,20,20,20,19,10,0,0,0,0,0,0,0,0,0,0,0,0,2,4,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,7,17,20,15,3,0,7,17,20,15,3,0,0,0,0,0,0,0,7,17,20,19,10,0,0,
+  3,15,20,19,10,0,0,0,0,0,0,3,15,20,17,8,0,0,0,0,3,15,20,17,8,0,0,0,0,0,0,0,
+  0,10,19,20,15,3,0,7,17,20,15,3,0,0,0,0,0,0,0,0,3,15,20,20,13,0,0,0,13,20,20,15,
+  3,0,0,0,0,0,0,0,7,17,20,20,20,20,20,20,20,15,3,0,0,0,0,0,0,0,0,0,0,0,3,15,
+  20,20,20,13,0,0,0,0,0,0,0,7,17,20,15,3,0,0,0,0,0,0,0,7,17,20,20,19,10,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,3,23,38,48,52,52,52,50,39,23,2,0,0,0,0,0,0,0,0,2,21,33,36,31,17,0,0,0,0,
+  0,0,0,0,0,0,13,34,48,52,46,32,18,35,48,52,46,29,8,0,0,0,0,0,13,34,48,52,50,39,23,8,
+  29,46,52,50,39,23,2,0,0,0,8,29,46,52,48,38,23,2,0,8,29,46,52,48,38,23,2,0,0,0,0,2,
+  23,39,50,52,46,29,18,35,48,52,46,32,13,0,0,0,0,0,0,8,29,46,52,51,42,24,8,28,42,51,52,46,
+  29,8,0,0,0,0,0,13,34,48,52,52,52,52,52,52,52,46,29,8,0,0,0,0,0,0,0,0,0,14,32,46,
+  52,52,51,42,24,2,0,0,0,0,18,35,48,52,46,29,8,0,0,0,0,0,13,34,48,52,52,50,39,23,5,0,
+  0,0,0,0,0,0,0,0,0,8,17,20,20,20,17,8,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,29,47,67,78,84,84,84,81,67,47,24,0,0,0,0,0,0,0,0,23,47,63,68,60,41,19,0,0,0,
+  0,0,0,0,0,10,36,58,78,84,74,58,41,63,78,84,74,53,29,3,0,0,0,7,34,58,78,84,81,67,47,29,
+  53,74,84,81,67,47,21,0,0,3,29,53,74,84,78,67,47,21,3,29,53,74,84,78,67,47,21,0,0,0,0,21,
+  47,67,81,84,74,53,41,63,78,84,74,58,34,7,0,0,0,0,3,29,53,74,84,83,69,47,28,53,71,83,84,74,
+  53,28,0,0,0,0,7,34,58,78,84,84,84,84,84,84,84,74,53,28,0,0,0,0,0,0,0,0,18,41,58,74,
+  84,84,83,69,47,23,0,0,0,14,41,63,78,84,74,53,28,0,0,0,0,7,34,58,78,84,84,81,67,49,30,8,
+  0,0,0,0,0,0,0,2,23,38,48,52,52,52,48,38,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,28,53,74,92,108,116,116,116,109,92,69,42,14,0,0,0,0,0,3,15,39,67,92,100,86,64,39,20,15,3,
+  0,0,0,0,0,23,53,80,103,116,103,78,56,85,106,116,98,74,46,15,0,0,0,17,48,78,103,116,109,92,63,46,
+  74,98,116,109,92,63,33,2,0,15,46,74,98,116,108,92,63,33,20,46,74,98,116,108,92,63,33,2,0,0,2,33,
+  63,92,109,116,98,74,63,85,106,116,103,78,48,17,0,0,0,0,15,46,74,98,116,114,92,67,42,71,98,114,116,98,
+  71,41,10,0,0,0,17,48,78,103,116,116,116,116,116,116,116,98,71,41,10,0,0,0,0,0,0,7,35,63,85,103,
+  116,116,114,92,67,38,8,0,0,25,56,85,106,116,98,71,41,10,0,0,0,17,48,78,103,116,116,109,92,75,53,28,
+  0,0,0,0,0,0,0,23,47,67,78,84,84,84,78,67,58,71,76,67,47,21,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,13,42,71,98,116,135,146,147,147,135,114,85,56,25,0,0,0,0,8,29,46,53,81,109,131,109,81,52,52,46,29,
+  8,0,0,0,0,28,60,92,124,141,116,84,60,92,124,141,116,84,52,20,0,0,0,20,52,84,116,146,131,106,75,53,
+  84,116,141,131,100,68,36,4,0,20,52,84,116,141,131,103,73,50,52,52,84,116,141,131,100,68,36,4,0,0,4,36,
+  68,100,131,141,116,96,78,106,124,141,116,84,52,20,0,0,0,0,20,52,84,116,141,135,108,76,51,83,114,139,139,108,
+  76,44,12,0,0,0,20,52,84,116,141,147,147,147,147,147,139,108,76,44,12,0,0,0,0,0,0,17,48,78,106,124,
+  141,147,135,108,76,44,12,0,0,28,60,92,124,139,108,76,44,12,0,0,0,20,52,84,116,141,147,135,120,98,71,41,
+  10,0,0,0,0,0,10,39,67,92,108,116,116,116,108,92,89,98,108,92,63,33,2,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,51,83,114,139,146,124,116,124,131,120,91,59,28,0,0,0,0,28,53,74,84,92,124,147,116,85,84,84,74,53,
+  28,0,0,0,0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,0,17,48,78,106,131,139,114,83,67,
+  96,124,147,120,92,63,33,2,0,17,48,78,108,139,139,108,76,81,84,74,89,116,147,124,96,66,35,3,0,0,0,31,
+  60,86,114,139,135,109,98,120,146,131,103,78,48,17,0,0,0,0,15,46,74,103,131,141,116,86,63,92,120,147,124,99,
+  71,41,10,0,0,0,15,46,74,103,116,116,116,116,124,155,135,108,76,44,12,0,0,0,0,0,0,27,58,89,116,146,
+  141,120,114,92,67,38,8,0,0,28,60,92,124,139,108,76,44,12,0,0,0,15,46,74,103,116,124,149,139,108,76,44,
+  12,0,0,0,0,0,19,50,81,109,135,146,147,146,135,124,116,124,131,100,68,36,4,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,147,131,103,89,96,100,96,75,49,20,0,0,0,10,41,71,98,116,116,124,149,124,116,116,116,98,71,
+  41,10,0,0,0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,0,7,35,63,92,124,149,124,96,78,
+  108,135,139,109,81,50,21,0,0,10,41,71,99,124,139,114,86,109,116,98,92,124,141,116,84,53,25,0,0,0,0,17,
+  42,71,98,120,146,131,116,141,135,109,86,60,34,7,0,0,0,0,3,32,60,89,116,147,131,100,75,106,131,139,114,85,
+  56,28,0,0,0,0,3,32,58,78,84,84,85,109,131,141,120,96,67,38,8,0,0,0,0,0,0,28,60,92,124,147,
+  120,98,83,69,47,23,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,3,32,58,78,89,109,131,139,108,76,44,
+  12,0,0,0,0,0,20,52,84,116,131,116,116,124,135,139,141,139,131,100,68,36,4,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,141,139,116,114,106,92,80,63,41,14,0,0,0,12,44,76,108,139,147,149,169,152,147,147,135,108,76,
+  44,12,0,0,0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,0,0,23,53,84,116,141,131,106,85,
+  116,146,131,103,73,42,11,0,0,0,28,59,91,120,147,116,103,131,141,116,106,131,139,108,76,46,15,0,0,0,0,0,
+  28,53,78,103,124,149,147,139,114,92,67,41,17,0,0,0,0,0,0,19,50,81,109,139,139,108,84,116,141,131,106,75,
+  43,14,0,0,0,0,0,13,34,48,53,78,103,124,146,124,103,75,52,25,0,0,0,0,0,0,0,28,60,92,124,147,
+  116,84,53,42,24,2,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,13,34,48,68,100,131,139,108,76,44,
+  12,0,0,0,0,0,15,46,74,96,100,92,85,99,108,108,116,108,103,86,60,31,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,15,46,74,103,124,139,147,139,131,124,106,85,56,28,0,0,0,10,41,71,98,116,116,131,156,131,116,116,116,96,67,
+  38,8,0,0,0,28,60,92,124,147,116,84,60,92,124,147,116,84,52,20,0,0,0,0,15,46,75,106,131,139,114,96,
+  124,146,116,92,63,33,3,0,0,0,20,52,84,116,147,131,114,139,152,124,109,139,131,106,75,43,12,0,0,0,0,0,
+  8,34,58,83,114,139,155,124,99,71,47,23,0,0,0,0,0,0,0,10,41,71,98,124,146,116,92,124,147,120,96,66,
+  35,5,0,0,0,0,0,1,28,53,74,98,120,146,131,106,80,58,32,7,0,0,0,0,0,0,7,28,60,92,124,147,
+  116,84,52,20,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,7,36,68,100,131,139,108,76,44,
+  15,3,0,0,0,0,3,29,52,66,68,63,56,67,76,78,84,76,73,60,41,17,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,32,58,80,103,109,120,131,139,146,124,99,71,41,10,0,0,0,28,53,74,84,92,124,147,120,92,84,84,74,52,
+  25,0,0,0,0,28,60,92,124,147,116,84,67,99,124,147,116,84,52,20,0,0,0,0,5,35,63,91,120,147,124,109,
+  135,139,108,78,48,21,0,0,0,0,19,50,81,109,139,135,116,146,124,135,116,147,124,99,67,36,5,0,0,0,0,0,
+  19,46,74,98,120,147,147,135,109,86,63,35,8,0,0,0,0,0,0,0,28,56,85,116,146,131,109,135,139,109,81,52,
+  25,0,0,0,0,0,0,19,45,71,98,116,141,135,109,86,63,36,13,0,0,0,0,0,0,13,34,48,64,92,124,147,
+  116,84,52,20,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,4,36,68,100,131,139,114,83,53,
+  46,29,7,0,0,0,0,7,25,35,36,33,28,38,44,48,52,46,42,32,17,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,34,58,78,84,81,92,103,116,141,139,108,76,44,12,0,0,0,8,29,46,60,92,124,147,116,84,52,52,46,29,
+  7,0,0,0,0,28,60,92,124,147,120,92,78,106,131,147,116,84,52,20,0,0,0,0,0,20,52,84,116,141,135,116,
+  147,131,103,73,42,11,0,0,0,0,11,42,73,103,131,146,124,135,116,141,124,146,116,85,56,28,0,0,0,0,0,13,
+  39,64,89,116,141,141,124,146,131,106,78,53,28,2,0,0,0,0,0,0,17,48,78,106,131,139,120,147,131,103,73,42,
+  11,0,0,0,0,0,10,39,64,89,114,139,139,114,92,67,60,53,36,13,0,0,0,0,7,34,58,78,85,109,131,139,
+  114,83,51,20,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,2,33,63,92,124,147,120,98,84,
+  74,52,25,0,0,0,0,0,0,3,4,2,0,8,12,17,20,15,11,3,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,103,116,108,100,99,116,141,139,108,76,44,12,0,0,0,0,3,28,60,92,124,147,116,84,52,20,15,3,
+  0,0,0,0,0,25,56,85,116,147,131,109,106,120,146,147,116,84,52,20,0,0,0,0,0,15,46,74,103,131,149,131,
+  146,116,89,60,32,3,0,0,0,0,3,32,60,92,124,149,147,124,109,139,147,139,108,78,48,17,0,0,0,0,7,34,
+  58,81,109,131,141,116,103,131,146,120,98,71,47,21,0,0,0,0,0,0,7,35,63,92,120,147,147,141,116,89,60,32,
+  3,0,0,0,0,0,19,50,81,109,131,147,120,98,92,92,92,80,58,32,3,0,0,0,17,48,78,103,116,124,149,135,
+  108,76,44,13,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,0,27,58,89,116,146,139,120,116,
+  96,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,146,135,131,124,139,146,124,99,71,41,10,0,0,0,0,0,28,60,92,124,147,116,84,52,28,20,5,
+  0,0,0,0,0,20,51,83,114,135,152,131,131,141,149,147,116,84,52,20,0,0,0,0,0,3,32,60,89,116,147,163,
+  139,108,78,48,17,0,0,0,0,0,0,23,53,84,116,147,141,116,99,124,155,135,108,76,44,12,0,0,0,0,17,48,
+  78,103,124,149,124,103,86,114,135,139,114,92,63,33,2,0,0,0,0,0,0,21,51,83,114,139,164,135,108,76,46,17,
+  0,0,0,0,0,0,25,56,85,116,147,147,124,124,124,124,124,103,73,42,11,0,0,0,20,52,84,116,141,149,147,120,
+  96,67,38,8,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,0,20,49,78,106,124,155,147,135,
+  108,76,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,48,78,106,131,135,139,139,131,120,103,80,56,28,0,0,0,0,0,0,28,60,92,124,147,120,91,60,59,49,30,
+  8,0,0,0,0,13,42,69,92,114,131,139,135,124,124,135,114,83,51,20,0,0,0,0,0,0,20,51,83,114,135,139,
+  124,99,71,41,10,0,0,0,0,0,0,20,51,83,114,135,135,108,89,116,139,124,99,67,38,8,0,0,0,0,20,52,
+  84,116,135,131,109,81,69,92,116,139,131,100,68,36,4,0,0,0,0,0,0,14,42,73,103,131,152,124,99,67,38,8,
+  0,0,0,0,0,0,28,59,91,120,139,139,139,139,139,139,135,108,76,44,12,0,0,0,15,46,74,98,116,124,146,135,
+  108,76,46,15,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,0,28,59,91,120,146,135,120,114,
+  92,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,35,63,86,100,108,108,108,106,96,78,58,36,12,0,0,0,0,0,0,23,53,84,116,147,124,103,92,91,75,53,
+  28,0,0,0,0,0,24,47,69,92,106,108,108,96,99,108,92,69,42,13,0,0,0,0,0,0,13,42,69,92,108,108,
+  99,80,56,28,0,0,0,0,0,0,0,13,42,69,92,108,108,92,74,98,108,99,80,56,28,0,0,0,0,0,15,46,
+  74,96,108,106,86,64,47,74,98,108,106,86,60,31,0,0,0,0,0,0,19,41,56,78,106,131,139,114,85,56,28,0,
+  0,0,0,0,0,0,20,49,75,98,108,108,108,108,108,108,108,92,67,38,8,0,0,0,3,29,53,74,84,103,131,141,
+  116,84,52,20,0,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,3,35,66,96,124,147,116,92,83,
+  69,47,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,18,41,60,68,76,76,76,75,66,52,34,13,0,0,0,0,0,0,0,20,52,84,116,141,146,124,124,120,98,71,
+  41,10,0,0,0,0,2,24,47,63,75,76,76,67,71,76,67,47,24,0,0,0,0,0,0,0,0,24,47,67,76,76,
+  71,56,36,12,0,0,0,0,0,0,0,0,24,47,67,76,76,67,53,71,76,71,56,36,12,0,0,0,0,0,3,29,
+  52,67,76,75,63,41,29,53,71,76,75,63,41,17,0,0,0,0,0,14,41,64,85,99,120,146,131,106,75,43,14,0,
+  0,0,0,0,0,0,5,30,53,71,76,76,76,76,76,76,76,67,47,23,0,0,0,0,0,8,29,46,63,92,124,147,
+  116,84,52,20,3,0,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,0,7,36,68,100,131,139,109,81,51,
+  42,24,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,17,31,38,44,44,44,43,35,25,7,0,0,0,0,0,0,0,0,15,46,74,98,116,135,139,139,135,108,76,
+  44,12,0,0,0,0,0,2,21,35,43,44,44,38,41,44,38,23,2,0,0,0,0,0,0,0,0,2,23,38,44,44,
+  41,28,12,0,0,0,0,0,0,0,0,0,2,23,38,44,44,38,28,41,44,41,28,12,0,0,0,0,0,0,0,7,
+  25,38,44,43,35,18,8,28,41,44,43,35,18,0,0,0,0,0,0,25,56,85,109,124,139,141,120,92,63,35,5,0,
+  0,0,0,0,0,0,0,8,28,41,44,44,44,44,44,44,44,38,23,2,0,0,0,0,0,0,3,28,60,92,124,147,
+  116,84,52,46,29,7,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,0,13,34,48,68,100,131,139,108,76,44,
+  13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,8,12,12,12,12,5,0,0,0,0,0,0,0,0,0,0,3,29,53,74,96,108,108,108,108,92,67,
+  38,8,0,0,0,0,0,0,0,5,12,12,12,8,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,8,12,12,
+  10,0,0,0,0,0,0,0,0,0,0,0,0,0,8,12,12,8,0,10,12,10,0,0,0,0,0,0,0,0,0,0,
+  0,8,12,12,5,0,0,0,10,12,12,5,0,0,0,0,0,0,0,28,60,92,124,139,135,120,98,75,49,21,0,0,
+  0,0,0,0,0,0,0,0,0,10,12,12,12,12,12,12,12,8,0,0,0,0,0,0,0,0,0,28,60,92,124,147,
+  120,92,84,74,52,25,0,0,0,28,60,92,124,139,108,76,44,12,0,0,0,7,34,58,78,84,106,131,139,108,76,44,
+  12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,29,52,67,76,76,76,76,67,47,
+  23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,53,80,99,108,108,96,75,53,30,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,59,91,120,147,
+  135,120,116,96,67,38,8,0,0,28,60,92,124,139,108,76,44,12,0,0,0,17,48,78,103,116,124,146,139,108,76,44,
+  12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,25,38,44,44,44,44,38,23,
+  2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,36,56,71,76,76,67,52,30,8,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,50,81,109,131,
+  139,146,135,108,76,44,12,0,0,28,60,92,124,139,108,76,44,12,0,0,0,20,52,84,116,141,139,139,124,99,71,41,
+  10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,12,12,12,12,8,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,28,41,44,44,38,25,7,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,39,67,92,106,
+  108,116,108,92,67,38,8,0,0,28,60,92,124,139,108,76,44,12,0,0,0,15,46,74,98,116,114,108,99,80,56,28,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,12,12,8,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,47,63,75,
+  78,84,78,67,47,23,0,0,0,28,60,92,124,135,108,76,44,12,0,0,0,3,29,53,74,84,83,76,71,56,36,12,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,21,35,43,
+  48,52,48,38,23,2,0,0,0,23,53,80,99,108,92,67,38,8,0,0,0,0,8,29,46,52,51,44,41,28,12,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,12,
+  17,20,17,8,0,0,0,0,0,10,36,56,71,76,67,47,23,0,0,0,0,0,0,3,15,20,20,13,10,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,12,28,41,44,38,23,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,10,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+ 18.000000f, 20.950001f, -0.009998f, 16.709999f, -4.250000f, 96,
+ {
+  {4294967295, 8, 8, -4, 4, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.031250f, 0.031250f, 0, { {0, 0.000000f} } },
+  {32, 9, 9, -4, 4, 10.843750f, 0.000000f, 0.031250f, 0.000000f, 0.066406f, 0.035156f, 0, { {0, 0.000000f} } },
+  {33, 12, 22, 0, 17, 10.843750f, 0.000000f, 0.066406f, 0.000000f, 0.113281f, 0.085938f, 0, { {0, 0.000000f} } },
+  {34, 15, 14, -2, 17, 10.843750f, 0.000000f, 0.113281f, 0.000000f, 0.171875f, 0.054688f, 0, { {0, 0.000000f} } },
+  {35, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.171875f, 0.000000f, 0.250000f, 0.085938f, 0, { {0, 0.000000f} } },
+  {36, 18, 25, -3, 18, 10.843750f, 0.000000f, 0.250000f, 0.000000f, 0.320312f, 0.097656f, 0, { {0, 0.000000f} } },
+  {37, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.320312f, 0.000000f, 0.398438f, 0.085938f, 0, { {0, 0.000000f} } },
+  {38, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.398438f, 0.000000f, 0.476562f, 0.085938f, 0, { {0, 0.000000f} } },
+  {39, 12, 14, 0, 17, 10.843750f, 0.000000f, 0.476562f, 0.000000f, 0.523438f, 0.054688f, 0, { {0, 0.000000f} } },
+  {40, 14, 25, -1, 18, 10.843750f, 0.000000f, 0.523438f, 0.000000f, 0.578125f, 0.097656f, 0, { {0, 0.000000f} } },
+  {41, 14, 25, -1, 18, 10.843750f, 0.000000f, 0.578125f, 0.000000f, 0.632812f, 0.097656f, 0, { {0, 0.000000f} } },
+  {42, 18, 17, -3, 17, 10.843750f, 0.000000f, 0.632812f, 0.000000f, 0.703125f, 0.066406f, 0, { {0, 0.000000f} } },
+  {43, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.703125f, 0.000000f, 0.781250f, 0.070312f, 0, { {0, 0.000000f} } },
+  {44, 13, 14, -1, 7, 10.843750f, 0.000000f, 0.781250f, 0.000000f, 0.832031f, 0.054688f, 0, { {0, 0.000000f} } },
+  {45, 14, 12, -1, 10, 10.843750f, 0.000000f, 0.832031f, 0.000000f, 0.886719f, 0.046875f, 0, { {0, 0.000000f} } },
+  {46, 12, 12, 0, 7, 10.843750f, 0.000000f, 0.886719f, 0.000000f, 0.933594f, 0.046875f, 0, { {0, 0.000000f} } },
+  {47, 19, 24, -4, 17, 10.843750f, 0.000000f, 0.000000f, 0.097656f, 0.074219f, 0.191406f, 0, { {0, 0.000000f} } },
+  {48, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.074219f, 0.097656f, 0.144531f, 0.183594f, 0, { {0, 0.000000f} } },
+  {49, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.144531f, 0.097656f, 0.210938f, 0.183594f, 0, { {0, 0.000000f} } },
+  {50, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.210938f, 0.097656f, 0.281250f, 0.183594f, 0, { {0, 0.000000f} } },
+  {51, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.281250f, 0.097656f, 0.351562f, 0.183594f, 0, { {0, 0.000000f} } },
+  {52, 19, 22, -4, 17, 10.843750f, 0.000000f, 0.351562f, 0.097656f, 0.425781f, 0.183594f, 0, { {0, 0.000000f} } },
+  {53, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.425781f, 0.097656f, 0.496094f, 0.183594f, 0, { {0, 0.000000f} } },
+  {54, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.496094f, 0.097656f, 0.566406f, 0.183594f, 0, { {0, 0.000000f} } },
+  {55, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.566406f, 0.097656f, 0.636719f, 0.183594f, 0, { {0, 0.000000f} } },
+  {56, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.636719f, 0.097656f, 0.707031f, 0.183594f, 0, { {0, 0.000000f} } },
+  {57, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.707031f, 0.097656f, 0.777344f, 0.183594f, 0, { {0, 0.000000f} } },
+  {58, 12, 18, 0, 13, 10.843750f, 0.000000f, 0.777344f, 0.097656f, 0.824219f, 0.167969f, 0, { {0, 0.000000f} } },
+  {59, 13, 21, -1, 14, 10.843750f, 0.000000f, 0.824219f, 0.097656f, 0.875000f, 0.179688f, 0, { {0, 0.000000f} } },
+  {60, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.875000f, 0.097656f, 0.953125f, 0.167969f, 0, { {0, 0.000000f} } },
+  {61, 20, 16, -4, 13, 10.843750f, 0.000000f, 0.000000f, 0.191406f, 0.078125f, 0.253906f, 0, { {0, 0.000000f} } },
+  {62, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.078125f, 0.191406f, 0.156250f, 0.261719f, 0, { {0, 0.000000f} } },
+  {63, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.156250f, 0.191406f, 0.222656f, 0.277344f, 0, { {0, 0.000000f} } },
+  {64, 20, 26, -4, 17, 10.843750f, 0.000000f, 0.222656f, 0.191406f, 0.300781f, 0.292969f, 0, { {0, 0.000000f} } },
+  {65, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.300781f, 0.191406f, 0.378906f, 0.277344f, 0, { {0, 0.000000f} } },
+  {66, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.378906f, 0.191406f, 0.449219f, 0.277344f, 0, { {0, 0.000000f} } },
+  {67, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.449219f, 0.191406f, 0.519531f, 0.277344f, 0, { {0, 0.000000f} } },
+  {68, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.519531f, 0.191406f, 0.589844f, 0.277344f, 0, { {0, 0.000000f} } },
+  {69, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.589844f, 0.191406f, 0.660156f, 0.277344f, 0, { {0, 0.000000f} } },
+  {70, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.660156f, 0.191406f, 0.726562f, 0.277344f, 0, { {0, 0.000000f} } },
+  {71, 19, 22, -4, 17, 10.843750f, 0.000000f, 0.726562f, 0.191406f, 0.800781f, 0.277344f, 0, { {0, 0.000000f} } },
+  {72, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.800781f, 0.191406f, 0.871094f, 0.277344f, 0, { {0, 0.000000f} } },
+  {73, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.871094f, 0.191406f, 0.941406f, 0.277344f, 0, { {0, 0.000000f} } },
+  {74, 18, 22, -4, 17, 10.843750f, 0.000000f, 0.000000f, 0.292969f, 0.070312f, 0.378906f, 0, { {0, 0.000000f} } },
+  {75, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.070312f, 0.292969f, 0.144531f, 0.378906f, 0, { {0, 0.000000f} } },
+  {76, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.144531f, 0.292969f, 0.218750f, 0.378906f, 0, { {0, 0.000000f} } },
+  {77, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.218750f, 0.292969f, 0.296875f, 0.378906f, 0, { {0, 0.000000f} } },
+  {78, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.296875f, 0.292969f, 0.367188f, 0.378906f, 0, { {0, 0.000000f} } },
+  {79, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.367188f, 0.292969f, 0.437500f, 0.378906f, 0, { {0, 0.000000f} } },
+  {80, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.437500f, 0.292969f, 0.511719f, 0.378906f, 0, { {0, 0.000000f} } },
+  {81, 18, 25, -3, 17, 10.843750f, 0.000000f, 0.511719f, 0.292969f, 0.582031f, 0.390625f, 0, { {0, 0.000000f} } },
+  {82, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.582031f, 0.292969f, 0.656250f, 0.378906f, 0, { {0, 0.000000f} } },
+  {83, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.656250f, 0.292969f, 0.726562f, 0.378906f, 0, { {0, 0.000000f} } },
+  {84, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.726562f, 0.292969f, 0.804688f, 0.378906f, 0, { {0, 0.000000f} } },
+  {85, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.804688f, 0.292969f, 0.875000f, 0.378906f, 0, { {0, 0.000000f} } },
+  {86, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.875000f, 0.292969f, 0.953125f, 0.378906f, 0, { {0, 0.000000f} } },
+  {87, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.000000f, 0.390625f, 0.078125f, 0.476562f, 0, { {0, 0.000000f} } },
+  {88, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.078125f, 0.390625f, 0.156250f, 0.476562f, 0, { {0, 0.000000f} } },
+  {89, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.156250f, 0.390625f, 0.234375f, 0.476562f, 0, { {0, 0.000000f} } },
+  {90, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.234375f, 0.390625f, 0.308594f, 0.476562f, 0, { {0, 0.000000f} } },
+  {91, 13, 26, 0, 18, 10.843750f, 0.000000f, 0.308594f, 0.390625f, 0.359375f, 0.492188f, 0, { {0, 0.000000f} } },
+  {92, 19, 24, -4, 17, 10.843750f, 0.000000f, 0.359375f, 0.390625f, 0.433594f, 0.484375f, 0, { {0, 0.000000f} } },
+  {93, 13, 26, -1, 18, 10.843750f, 0.000000f, 0.433594f, 0.390625f, 0.484375f, 0.492188f, 0, { {0, 0.000000f} } },
+  {94, 20, 14, -4, 17, 10.843750f, 0.000000f, 0.484375f, 0.390625f, 0.562500f, 0.445312f, 0, { {0, 0.000000f} } },
+  {95, 20, 12, -4, 2, 10.843750f, 0.000000f, 0.562500f, 0.390625f, 0.640625f, 0.437500f, 0, { {0, 0.000000f} } },
+  {96, 14, 13, -2, 19, 10.843750f, 0.000000f, 0.640625f, 0.390625f, 0.695312f, 0.441406f, 0, { {0, 0.000000f} } },
+  {97, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.695312f, 0.390625f, 0.765625f, 0.464844f, 0, { {0, 0.000000f} } },
+  {98, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.765625f, 0.390625f, 0.835938f, 0.480469f, 0, { {0, 0.000000f} } },
+  {99, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.835938f, 0.390625f, 0.906250f, 0.464844f, 0, { {0, 0.000000f} } },
+  {100, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.906250f, 0.390625f, 0.976562f, 0.480469f, 0, { {0, 0.000000f} } },
+  {101, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.000000f, 0.492188f, 0.070312f, 0.566406f, 0, { {0, 0.000000f} } },
+  {102, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.070312f, 0.492188f, 0.140625f, 0.582031f, 0, { {0, 0.000000f} } },
+  {103, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.140625f, 0.492188f, 0.210938f, 0.582031f, 0, { {0, 0.000000f} } },
+  {104, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.210938f, 0.492188f, 0.281250f, 0.582031f, 0, { {0, 0.000000f} } },
+  {105, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.281250f, 0.492188f, 0.351562f, 0.582031f, 0, { {0, 0.000000f} } },
+  {106, 15, 27, -3, 18, 10.843750f, 0.000000f, 0.351562f, 0.492188f, 0.410156f, 0.597656f, 0, { {0, 0.000000f} } },
+  {107, 18, 23, -2, 18, 10.843750f, 0.000000f, 0.410156f, 0.492188f, 0.480469f, 0.582031f, 0, { {0, 0.000000f} } },
+  {108, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.480469f, 0.492188f, 0.550781f, 0.582031f, 0, { {0, 0.000000f} } },
+  {109, 19, 19, -4, 14, 10.843750f, 0.000000f, 0.550781f, 0.492188f, 0.625000f, 0.566406f, 0, { {0, 0.000000f} } },
+  {110, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.625000f, 0.492188f, 0.695312f, 0.566406f, 0, { {0, 0.000000f} } },
+  {111, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.695312f, 0.492188f, 0.765625f, 0.566406f, 0, { {0, 0.000000f} } },
+  {112, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.765625f, 0.492188f, 0.835938f, 0.582031f, 0, { {0, 0.000000f} } },
+  {113, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.835938f, 0.492188f, 0.906250f, 0.582031f, 0, { {0, 0.000000f} } },
+  {114, 17, 19, -1, 14, 10.843750f, 0.000000f, 0.906250f, 0.492188f, 0.972656f, 0.566406f, 0, { {0, 0.000000f} } },
+  {115, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.000000f, 0.597656f, 0.070312f, 0.671875f, 0, { {0, 0.000000f} } },
+  {116, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.070312f, 0.597656f, 0.140625f, 0.683594f, 0, { {0, 0.000000f} } },
+  {117, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.140625f, 0.597656f, 0.210938f, 0.671875f, 0, { {0, 0.000000f} } },
+  {118, 19, 19, -4, 14, 10.843750f, 0.000000f, 0.210938f, 0.597656f, 0.285156f, 0.671875f, 0, { {0, 0.000000f} } },
+  {119, 20, 19, -4, 14, 10.843750f, 0.000000f, 0.285156f, 0.597656f, 0.363281f, 0.671875f, 0, { {0, 0.000000f} } },
+  {120, 20, 19, -4, 14, 10.843750f, 0.000000f, 0.363281f, 0.597656f, 0.441406f, 0.671875f, 0, { {0, 0.000000f} } },
+  {121, 20, 23, -4, 14, 10.843750f, 0.000000f, 0.441406f, 0.597656f, 0.519531f, 0.687500f, 0, { {0, 0.000000f} } },
+  {122, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.519531f, 0.597656f, 0.589844f, 0.671875f, 0, { {0, 0.000000f} } },
+  {123, 17, 26, -3, 18, 10.843750f, 0.000000f, 0.589844f, 0.597656f, 0.656250f, 0.699219f, 0, { {0, 0.000000f} } },
+  {124, 12, 27, 0, 18, 10.843750f, 0.000000f, 0.656250f, 0.597656f, 0.703125f, 0.703125f, 0, { {0, 0.000000f} } },
+  {125, 17, 26, -3, 18, 10.843750f, 0.000000f, 0.703125f, 0.597656f, 0.769531f, 0.699219f, 0, { {0, 0.000000f} } },
+  {126, 20, 13, -4, 12, 10.843750f, 0.000000f, 0.769531f, 0.597656f, 0.847656f, 0.648438f, 0, { {0, 0.000000f} } }
+ }
+};
+
+#endif // _DEJAVUFONT_SDF_H
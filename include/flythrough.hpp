@@ -0,0 +1,29 @@
+#ifndef _FLYTHROUGH_H
+#define _FLYTHROUGH_H
+
+// Benchmark de renderização: os carros e a bola percorrem caminhos fixos
+// (splines Catmull-Rom) pela arena durante um número fixo de quadros,
+// ignorando o teclado. As câmeras das duas telas passam pelos três modos
+// (perseguição, olhando para a bola e olhando para trás), de modo que toda
+// execução desenha exatamente a mesma sequência de imagens.
+//
+// Ao final são impressos os percentis dos tempos de quadro (CPU e GPU) e o
+// número médio de chamadas de desenho por quadro.
+
+#define FLYTHROUGH_DEFAULT_FRAMES 1800
+#define FLYTHROUGH_WARMUP_FRAMES  60 // Quadros iniciais fora das medidas
+
+void Flythrough_Start(int num_frames);
+bool Flythrough_IsActive();
+
+// Posiciona os carros, a bola e as câmeras para o quadro atual. Retorna falso
+// quando todos os quadros já foram desenhados.
+bool Flythrough_Update();
+
+// Chamada após a troca de buffers, com o número de chamadas de desenho feitas
+// no quadro
+void Flythrough_EndFrame(unsigned int draw_calls);
+
+void Flythrough_PrintReport();
+
+#endif // _FLYTHROUGH_H
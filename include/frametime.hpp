@@ -0,0 +1,59 @@
+#ifndef _FRAMETIME_H
+#define _FRAMETIME_H
+
+#include <cstdint>
+
+struct GLFWwindow;
+
+// Registro dos tempos de cada quadro, de CPU (intervalo entre quadros) e de
+// GPU (soma das zonas de GPU do profiler). Cada série é um histograma de
+// tamanho fixo, atualizado sem travas, do qual são extraídos os percentis:
+// a média de um segundo esconde os engasgos, os percentis altos não.
+//
+// Os baldes têm FRAME_TIME_BUCKET_MS de largura; tempos acima de
+// FRAME_TIME_MAX_MS caem no último balde (o máximo é guardado à parte).
+
+#define FRAME_TIME_BUDGET_MS (1000.0 / 60.0) // Orçamento de um quadro a 60 Hz
+#define FRAME_TIME_BUCKET_MS 0.1
+#define FRAME_TIME_MAX_MS    250.0
+#define FRAME_TIME_GRAPH_FRAMES 240          // Quadros mostrados no gráfico
+
+enum FrameTimeSeries
+{
+    FRAME_TIME_CPU = 0,
+    FRAME_TIME_GPU = 1,
+    FRAME_TIME_NUM_SERIES
+};
+
+struct FrameTimeReport
+{
+    uint64_t frames;
+    uint64_t over_budget; // Quadros acima de FRAME_TIME_BUDGET_MS
+    double   p50_ms;
+    double   p95_ms;
+    double   p99_ms;
+    double   max_ms;
+};
+
+// Cria e libera os objetos de GPU do gráfico. Devem ser chamadas na thread
+// OpenGL.
+void FrameTime_Init();
+void FrameTime_Shutdown();
+
+// Acrescenta o tempo de um quadro a uma série. Pode ser chamada por qualquer
+// thread.
+void FrameTime_Record(FrameTimeSeries series, double milliseconds);
+
+// Percentis acumulados desde o início (ou desde FrameTime_Reset())
+void FrameTime_GetReport(FrameTimeSeries series, FrameTimeReport* report);
+void FrameTime_Reset();
+
+// Desenha o gráfico dos últimos quadros e os percentis na parte inferior da
+// viewport atual
+void FrameTime_DrawGraph(GLFWwindow* window);
+void FrameTime_ToggleGraph();
+
+// Imprime os percentis de todas as séries no terminal
+void FrameTime_PrintReport();
+
+#endif // _FRAMETIME_H
@@ -0,0 +1,27 @@
+#ifndef _GLDEBUG_H
+#define _GLDEBUG_H
+
+// Mensagens de depuração do driver OpenGL (KHR_debug, ou ARB_debug_output em
+// drivers mais antigos). O driver chama um callback com os erros e avisos de
+// desempenho, sem que a aplicação precise consultar glGetError(), que em
+// muitos drivers força a sincronização entre CPU e GPU.
+//
+// Mensagens de severidade "notification" são descartadas, e cada mensagem é
+// impressa no máximo GLDEBUG_MAX_REPEATS vezes, pois avisos de desempenho
+// costumam se repetir a cada quadro.
+//
+// A consulta a glGetError() em glCheckError() (veja "utils.h") só existe em
+// builds de depuração, compilados com -DGL_ERROR_POLLING (veja
+// "_build_debug.bat"). Nesses builds as mensagens também são síncronas: o
+// callback executa dentro da chamada OpenGL que gerou a mensagem.
+
+#define GLDEBUG_MAX_REPEATS 10
+
+// Pede um contexto de depuração. Deve ser chamada antes de glfwCreateWindow().
+void GlDebug_RequestContext();
+
+// Instala o callback, se o driver oferecer a extensão. Deve ser chamada após
+// carregar as funções OpenGL. Retorna falso se não houver suporte.
+bool GlDebug_Init();
+
+#endif // _GLDEBUG_H
@@ -0,0 +1,27 @@
+#ifndef _GLSTATE_H
+#define _GLSTATE_H
+
+// Cache do estado OpenGL: guarda o programa, o VAO, os buffers, as texturas
+// de cada unidade, os framebuffers, blend/depth/cull e a viewport atuais, e
+// descarta as chamadas que não mudariam nada (por exemplo, ligar o mesmo VAO
+// para cada um dos planos da arena, ou glDisable(GL_BLEND) com o blend já
+// desligado).
+//
+// Assim como em "glstats.hpp", GlState_Init() troca os ponteiros de função da
+// GLAD, de modo que nenhum código de renderização precisa ser alterado.
+// Chamado depois de GlStats_Init(), os contadores passam a mostrar apenas as
+// chamadas que chegam ao driver.
+//
+// O estado começa desconhecido: a primeira chamada de cada tipo sempre chega
+// ao driver. Apagar um objeto ligado (glDeleteBuffers, glDeleteTextures, ...)
+// atualiza o cache, já que o OpenGL volta a ligação para 0.
+
+// Deve ser chamada logo após gladLoadGLLoader() (e após GlStats_Init())
+void GlState_Init();
+void GlState_Shutdown();
+
+// Esquece todo o estado guardado, para quando algum código alterar o estado
+// OpenGL sem passar pela GLAD (bibliotecas externas, por exemplo)
+void GlState_Invalidate();
+
+#endif // _GLSTATE_H
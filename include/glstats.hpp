@@ -0,0 +1,59 @@
+#ifndef _GLSTATS_H
+#define _GLSTATS_H
+
+#include <cstdint>
+#include <cstdio>
+
+// Contadores de chamadas OpenGL por quadro. GlStats_Init() troca os ponteiros
+// de função carregados pela GLAD (glad_glDrawElements, glad_glBindTexture,
+// ...) por funções que incrementam os contadores e chamam a original, de modo
+// que nenhum código de renderização precisa ser alterado.
+//
+// Só existe quando compilado com -DGLSTATS_ENABLED (veja
+// "_build_glstats.bat"); nos outros builds todas as funções abaixo são vazias
+// e as chamadas OpenGL vão direto ao driver.
+
+struct GlStatsCounters
+{
+    uint32_t draw_calls;         // glDraw*
+    uint32_t state_changes;      // glEnable, glBlendFunc, glViewport, ...
+    uint32_t program_binds;      // glUseProgram
+    uint32_t vertex_array_binds; // glBindVertexArray
+    uint32_t texture_binds;      // glBindTexture
+    uint32_t buffer_binds;       // glBindBuffer
+    uint64_t upload_bytes;       // glBufferData, glTexImage2D, ...
+};
+
+#ifdef GLSTATS_ENABLED
+
+// Deve ser chamada logo após gladLoadGLLoader()
+void GlStats_Init();
+void GlStats_Shutdown();
+
+// Delimitam um quadro: GlStats_EndFrame() guarda os contadores do quadro e,
+// se houver um arquivo aberto, escreve uma linha no CSV
+void GlStats_BeginFrame();
+void GlStats_EndFrame();
+
+// Contadores do último quadro completo
+bool GlStats_GetLastFrame(GlStatsCounters* counters);
+
+// Abre um arquivo CSV com uma linha por quadro. Retorna falso em caso de erro.
+bool GlStats_OpenCsv(const char* filename);
+
+#else
+
+inline void GlStats_Init() {}
+inline void GlStats_Shutdown() {}
+inline void GlStats_BeginFrame() {}
+inline void GlStats_EndFrame() {}
+inline bool GlStats_GetLastFrame(GlStatsCounters*) { return false; }
+inline bool GlStats_OpenCsv(const char*)
+{
+    fprintf(stderr, "ERROR: GL statistics require a build with -DGLSTATS_ENABLED.\n");
+    return false;
+}
+
+#endif // GLSTATS_ENABLED
+
+#endif // _GLSTATS_H
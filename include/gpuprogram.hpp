@@ -0,0 +1,20 @@
+#ifndef _GPUPROGRAM_H
+#define _GPUPROGRAM_H
+
+#include "./glad/glad.h"
+#include "./gpuresources.hpp"
+
+// Criação de programas de GPU a partir de shaders já compilados. Definidas
+// em main.cpp e usadas também por "textrendering.cpp" e "frametime.cpp".
+// Ambas liberam os dois shaders após a linkagem.
+
+// Cria um programa cujo dono é quem chama, sem registrá-lo. O jogo usa
+// CreateTrackedGpuProgram(); esta é mantida para código que gerencia seus
+// próprios objetos.
+GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id);
+
+// Cria um programa registrado em "gpuresources.hpp". Se a linkagem falhar, o
+// handle retornado é vazio.
+GpuProgram CreateTrackedGpuProgram(const char* name, GLuint vertex_shader_id, GLuint fragment_shader_id);
+
+#endif // _GPUPROGRAM_H
@@ -0,0 +1,164 @@
+#ifndef _GPURESOURCES_H
+#define _GPURESOURCES_H
+
+#include <cstddef>
+
+#include "./glad/glad.h"
+
+// Registro dos objetos OpenGL (buffers, VAOs, texturas, samplers, programas,
+// framebuffers, consultas e fences) criados pelo jogo: carregadores de assets,
+// texto, gráficos, profiler e captura. Cada objeto é criado e destruído por
+// aqui, com um nome e o tamanho aproximado da memória que ocupa na GPU, de
+// modo que é possível saber quanta memória cada recurso usa e, ao final,
+// quais objetos não foram liberados.
+//
+// O código não usa os IDs diretamente como donos: cada objeto pertence a um
+// GpuHandle (GpuBuffer, GpuTexture, ...), que só pode ser movido, nunca
+// copiado, e libera o objeto ao ser destruído ou substituído. Substituir um
+// recurso por uma versão recarregada é uma atribuição: o objeto anterior é
+// liberado no mesmo instante.
+//
+// Todas as funções, inclusive os destrutores dos handles, devem executar na
+// thread do contexto OpenGL.
+
+enum GpuResourceType
+{
+    GPU_BUFFER,
+    GPU_VERTEX_ARRAY,
+    GPU_TEXTURE,
+    GPU_SAMPLER,
+    GPU_PROGRAM,
+    GPU_FRAMEBUFFER,
+    GPU_RENDERBUFFER,
+    GPU_QUERY,
+    GPU_FENCE, // Veja GpuResources_CreateFence()
+    GPU_NUM_RESOURCE_TYPES
+};
+
+// Cria um objeto OpenGL do tipo pedido (glGenBuffers(), glCreateProgram(),
+// ...) e o registra com o nome dado
+GLuint GpuResources_Create(GpuResourceType type, const char* name);
+
+// Libera o objeto e o remove do registro. Após GpuResources_Shutdown() não
+// faz nada, pois o contexto OpenGL pode não existir mais.
+void GpuResources_Destroy(GpuResourceType type, GLuint id);
+
+// Informa o tamanho atual do objeto na GPU (após glBufferData(),
+// glTexImage2D(), ...)
+void GpuResources_SetSize(GpuResourceType type, GLuint id, size_t bytes);
+
+// Fences (GLsync) não têm um ID numérico: são criadas com glFenceSync() e
+// registradas pelo endereço
+GLsync GpuResources_CreateFence(const char* name);
+void   GpuResources_DestroyFence(GLsync fence);
+
+// Memória total registrada, em bytes
+size_t GpuResources_GetTotalBytes();
+
+// Imprime o número de objetos e a memória de cada tipo
+void GpuResources_PrintSummary();
+
+// Imprime os objetos ainda registrados (vazamentos) e fecha o registro. Deve
+// ser chamada depois que os módulos liberaram seus recursos, e antes de
+// glfwTerminate().
+void GpuResources_Shutdown();
+
+// Dono de um objeto OpenGL do tipo TYPE
+template <GpuResourceType TYPE>
+class GpuHandle
+{
+public:
+    GpuHandle() : m_id(0) {}
+    ~GpuHandle() { Reset(); }
+
+    GpuHandle(GpuHandle&& other) : m_id(other.m_id) { other.m_id = 0; }
+    GpuHandle& operator=(GpuHandle&& other)
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_id = other.m_id;
+            other.m_id = 0;
+        }
+        return *this;
+    }
+
+    GpuHandle(const GpuHandle&) = delete;
+    GpuHandle& operator=(const GpuHandle&) = delete;
+
+    // Libera o objeto atual, se houver, e cria um novo
+    void Create(const char* name)
+    {
+        Reset();
+        m_id = GpuResources_Create(TYPE, name);
+    }
+
+    void Reset()
+    {
+        if (m_id != 0)
+            GpuResources_Destroy(TYPE, m_id);
+        m_id = 0;
+    }
+
+    void SetSize(size_t bytes) { GpuResources_SetSize(TYPE, m_id, bytes); }
+
+    GLuint Get() const { return m_id; }
+    bool IsValid() const { return m_id != 0; }
+
+private:
+    GLuint m_id;
+};
+
+typedef GpuHandle<GPU_BUFFER>       GpuBuffer;
+typedef GpuHandle<GPU_VERTEX_ARRAY> GpuVertexArray;
+typedef GpuHandle<GPU_TEXTURE>      GpuTexture;
+typedef GpuHandle<GPU_SAMPLER>      GpuSampler;
+typedef GpuHandle<GPU_PROGRAM>      GpuProgram;
+typedef GpuHandle<GPU_FRAMEBUFFER>  GpuFramebuffer;
+typedef GpuHandle<GPU_RENDERBUFFER> GpuRenderbuffer;
+typedef GpuHandle<GPU_QUERY>        GpuQuery;
+
+// Dono de uma fence. Create() insere a fence no fluxo de comandos
+// (glFenceSync()); uma fence já sinalizada pode ser liberada com Reset().
+class GpuFence
+{
+public:
+    GpuFence() : m_sync(NULL) {}
+    ~GpuFence() { Reset(); }
+
+    GpuFence(GpuFence&& other) : m_sync(other.m_sync) { other.m_sync = NULL; }
+    GpuFence& operator=(GpuFence&& other)
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_sync = other.m_sync;
+            other.m_sync = NULL;
+        }
+        return *this;
+    }
+
+    GpuFence(const GpuFence&) = delete;
+    GpuFence& operator=(const GpuFence&) = delete;
+
+    void Create(const char* name)
+    {
+        Reset();
+        m_sync = GpuResources_CreateFence(name);
+    }
+
+    void Reset()
+    {
+        if (m_sync != NULL)
+            GpuResources_DestroyFence(m_sync);
+        m_sync = NULL;
+    }
+
+    GLsync Get() const { return m_sync; }
+    bool IsValid() const { return m_sync != NULL; }
+
+private:
+    GLsync m_sync;
+};
+
+#endif // _GPURESOURCES_H
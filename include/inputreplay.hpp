@@ -0,0 +1,59 @@
+#ifndef _INPUTREPLAY_H
+#define _INPUTREPLAY_H
+
+#include <cstdint>
+
+#include "simulation.hpp"
+
+// Gravação e reprodução dos comandos dos dois jogadores, passo a passo da
+// simulação. Como a simulação avança em passos fixos, reproduzir uma gravação
+// repete a partida exatamente, independente da taxa de quadros: útil para
+// medir desempenho sempre com a mesma carga.
+//
+// Arquivo ".cinp" (little-endian):
+//
+//   InputFileHeader
+//   InputChange[num_changes], em ordem crescente de tick
+//
+// Só os passos em que algum comando muda são guardados.
+
+#define INPUT_FILE_MAGIC   0x504E4943u // "CINP"
+#define INPUT_FILE_VERSION 1u
+
+struct InputFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t tick_rate;   // SIMULATION_TICK_RATE da gravação
+    uint32_t num_ticks;   // Duração da partida, em passos
+    uint32_t num_changes;
+    uint32_t reserved;
+};
+
+struct InputChange
+{
+    uint32_t tick;
+    uint8_t  purple;
+    uint8_t  orange;
+    uint16_t reserved;
+};
+
+// Inicia a gravação; o arquivo é escrito por InputReplay_Stop()
+bool InputReplay_StartRecording(const char* filename);
+
+// Carrega uma gravação para reprodução. Retorna falso se o arquivo não existe
+// ou é inválido.
+bool InputReplay_StartReplay(const char* filename);
+
+// Termina a gravação (escrevendo o arquivo) ou a reprodução
+void InputReplay_Stop();
+
+bool InputReplay_IsRecording();
+bool InputReplay_IsReplaying();
+
+// Chamada uma vez por passo da simulação, antes de Simulation_Step(). Na
+// gravação, guarda "input"; na reprodução, substitui "input" pelo comando
+// gravado. Retorna falso quando a reprodução chegou ao fim.
+bool InputReplay_Tick(SimulationInput* input);
+
+#endif // _INPUTREPLAY_H
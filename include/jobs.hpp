@@ -0,0 +1,64 @@
+#ifndef _JOBS_H
+#define _JOBS_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+// Conjunto de threads auxiliares para tarefas de CPU (leitura de arquivos,
+// decodificação de imagens, ...), e uma fila de tarefas que devem executar na
+// thread que possui o contexto OpenGL (criação de objetos da GPU).
+//
+// Cada thread auxiliar tem sua própria fila (deque). Uma tarefa submetida por
+// uma thread auxiliar entra na fila dessa thread, que executa primeiro as
+// tarefas mais recentes (cujos dados ainda estão no cache). Tarefas
+// submetidas pelas demais threads são distribuídas entre as filas. Uma thread
+// sem tarefas "rouba" as mais antigas das filas das outras.
+//
+// Dependências entre etapas são expressas encadeando tarefas: ao terminar,
+// uma tarefa submete a etapa seguinte, na fila adequada. Um JobCounter conta
+// as tarefas ainda não terminadas de um grupo; Jobs_Wait() espera o grupo
+// executando tarefas enquanto isso, em vez de bloquear.
+
+typedef std::function<void()> Job;
+
+// Tarefas de um grupo ainda não terminadas. Uma tarefa que encadeia a etapa
+// seguinte com o mesmo contador mantém o grupo aberto até o fim da cadeia.
+struct JobCounter
+{
+    std::atomic<int> count;
+
+    JobCounter() : count(0) {}
+};
+
+// Inicia as threads auxiliares. num_threads = 0 escolhe automaticamente. A
+// thread que chama esta função é considerada a thread OpenGL.
+void Jobs_Init(unsigned int num_threads = 0);
+
+// Termina as threads auxiliares (tarefas ainda na fila são descartadas)
+void Jobs_Shutdown();
+
+// Submete uma tarefa para ser executada por uma thread auxiliar (ou dentro de
+// Jobs_Wait()). Se "counter" não for nulo, ele é incrementado agora e
+// decrementado quando a tarefa terminar. Sem threads auxiliares (fora de
+// Jobs_Init()/Jobs_Shutdown()), a tarefa é executada antes de retornar.
+void Jobs_Submit(Job job, JobCounter* counter = NULL);
+
+// Submete uma tarefa para ser executada na thread do contexto OpenGL, dentro
+// de Jobs_RunMainThread() ou Jobs_Wait()
+void Jobs_SubmitMainThread(Job job, JobCounter* counter = NULL);
+
+// Executa até "max_jobs" tarefas da fila da thread OpenGL (todas, se
+// negativo), sem bloquear. Retorna o número de tarefas executadas.
+int Jobs_RunMainThread(int max_jobs = -1);
+
+// Espera até que todas as tarefas contadas por "counter" terminem. Enquanto
+// isso, executa tarefas das filas (e, na thread OpenGL, as da fila dessa
+// thread), de modo que a thread que espera também trabalha.
+void Jobs_Wait(JobCounter* counter);
+
+// Executa body(begin, end) para intervalos consecutivos de até "batch_size"
+// itens em [0, count), em paralelo, e retorna quando todos terminarem
+void Jobs_ParallelFor(int count, int batch_size, const std::function<void(int begin, int end)>& body);
+
+#endif // _JOBS_H
@@ -0,0 +1,68 @@
+#ifndef _MESHPOOL_H
+#define _MESHPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "./glad/glad.h"
+
+// Buffers compartilhados pelos modelos estáticos: em vez de um VAO e buffers
+// próprios para cada modelo, os vértices e índices de todos os modelos de um
+// mesmo layout ficam em um único buffer de vértices e um único buffer de
+// índices, associados a um único VAO. Cada modelo guarda apenas onde começam
+// seus vértices (base_vertex) e seus índices (first_index), e é desenhado com
+// glDrawElementsBaseVertex(): trocar de modelo não troca de VAO, e modelos
+// consecutivos podem ser desenhados com uma só chamada a
+// glMultiDrawElementsBaseVertex().
+//
+// Os buffers crescem conforme necessário (o conteúdo é copiado pela GPU com
+// glCopyBufferSubData()), e são liberados por MeshPool_Shutdown(). Ao
+// recarregar os modelos, os novos vão para outro conjunto de buffers, que só
+// substitui o atual se a recarga der certo (veja MeshPool_BeginReload()); os
+// buffers substituídos são liberados, de modo que a memória usada na GPU não
+// cresce a cada recarga.
+//
+// Os índices de cada modelo continuam relativos ao seu primeiro vértice.
+// Todas as funções devem ser chamadas na thread do contexto OpenGL.
+
+// Layouts de vértice: um conjunto de buffers para cada
+enum MeshFormat
+{
+    MESH_FORMAT_COOKED,   // CookedVertex (veja "cookedformat.hpp")
+    MESH_FORMAT_STREAMED, // StreamedVertex (veja "objstream.hpp")
+    MESH_NUM_FORMATS
+};
+
+// Capacidade inicial dos buffers de cada layout, alocados no primeiro uso
+#define MESHPOOL_INITIAL_VERTICES (64 * 1024)
+#define MESHPOOL_INITIAL_INDICES  (256 * 1024)
+
+// Posição de um modelo dentro dos buffers compartilhados
+struct MeshAllocation
+{
+    GLuint vertex_array_object_id;
+    GLint  base_vertex; // Primeiro vértice do modelo
+    size_t first_index; // Primeiro índice do modelo
+};
+
+// Copia vértices e índices da memória principal para os buffers
+// compartilhados
+MeshAllocation MeshPool_Upload(MeshFormat format, const void* vertices, size_t num_vertices, const uint32_t* indices, size_t num_indices);
+
+// Copia vértices e índices de outros buffers da GPU (por exemplo, os buffers
+// temporários do carregador "streaming"), sem passar pela CPU
+MeshAllocation MeshPool_CopyFromBuffers(MeshFormat format, GLuint vertex_buffer_id, size_t num_vertices, GLuint index_buffer_id, size_t num_indices);
+
+// Recarga dos modelos: entre MeshPool_BeginReload() e
+// MeshPool_CommitReload()/MeshPool_CancelReload(), as funções acima escrevem
+// em buffers novos, e os atuais (e as posições já retornadas) continuam
+// válidos. MeshPool_CommitReload() troca os buffers atuais pelos novos e
+// libera os antigos; MeshPool_CancelReload() descarta os novos.
+void MeshPool_BeginReload();
+void MeshPool_CommitReload();
+void MeshPool_CancelReload();
+
+// Libera os VAOs e buffers de todos os layouts
+void MeshPool_Shutdown();
+
+#endif // _MESHPOOL_H
@@ -0,0 +1,59 @@
+#ifndef _NORMALS_H
+#define _NORMALS_H
+
+#include <cstddef>
+
+#include "./glad/glad.h"
+
+// Como a normal de cada face contribui para a normal de um vértice
+enum NormalsWeighting
+{
+    NORMALS_WEIGHT_UNIFORM, // Todas as faces contribuem igualmente
+    NORMALS_WEIGHT_AREA,    // Proporcional à área do triângulo
+    NORMALS_WEIGHT_ANGLE,   // Proporcional ao ângulo do triângulo no vértice
+};
+
+struct NormalsOptions
+{
+    NormalsWeighting weighting;
+
+    // Ângulo (em radianos) acima do qual duas faces vizinhas NÃO são suavizadas
+    // entre si, preservando arestas vivas. Valores <= 0 desabilitam a divisão,
+    // e todas as faces que compartilham um vértice são suavizadas.
+    float smoothing_angle;
+
+    // Se verdadeiro, posições iguais (a menos de weld_epsilon) com índices
+    // diferentes no arquivo são tratadas como um único vértice.
+    bool  weld;
+    float weld_epsilon;
+
+    // Número máximo de partes em que o trabalho é dividido, executadas pelas
+    // threads auxiliares de "jobs.cpp". 0 = std::thread::hardware_concurrency().
+    unsigned int num_threads;
+};
+
+// Opções padrão: ponderação por área, sem divisão por ângulo e sem solda de
+// vértices. Equivale ao método de Gouraud utilizado originalmente.
+NormalsOptions Normals_DefaultOptions();
+
+// Computa uma normal por canto de triângulo.
+//
+//   positions          - 3 floats (x,y,z) por posição
+//   triangle_positions - 3 índices de posição por triângulo
+//   out_normals        - destino da normal (3 floats) do canto i, escrita em
+//                        (char*)out_normals + i*out_stride
+//
+// O trabalho é dividido em tarefas do sistema de "jobs.cpp", que deve estar
+// iniciado (exceto em builds com -DNORMALS_SERIAL). O destino pode ser
+// memória mapeada da GPU, já que só escrevemos nele.
+void Normals_Compute(
+    const float*  positions,
+    size_t        num_positions,
+    const GLuint* triangle_positions,
+    size_t        num_triangles,
+    const NormalsOptions& options,
+    float*        out_normals,
+    size_t        out_stride
+);
+
+#endif // _NORMALS_H
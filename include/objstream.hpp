@@ -0,0 +1,66 @@
+#ifndef _OBJSTREAM_H
+#define _OBJSTREAM_H
+
+#include <string>
+#include <vector>
+
+#include "./glad/glad.h"
+
+// Layout de um vértice gravado diretamente na memória da GPU pelo carregador
+// "streaming". Os atributos ficam intercalados em um único VBO, mantendo as
+// mesmas "locations" usadas em "shader_vertex.glsl".
+struct StreamedVertex
+{
+    float position[4]; // (location = 0) vec4 model_coefficients
+    float normal[4];   // (location = 1) vec4 normal_coefficients
+    float texcoord[2]; // (location = 2) vec2 texture_coefficients
+};
+
+// Um "shape" (grupo "g" ou objeto "o") do arquivo ".obj", já na GPU.
+struct StreamedShape
+{
+    std::string name;
+    size_t      first_index; // Primeiro índice dentro do buffer de índices
+    size_t      num_indices; // Número de índices do shape
+};
+
+// Resultado do carregamento: a posição do modelo nos buffers compartilhados
+// (veja "meshpool.hpp"), além da lista de shapes contidos no arquivo. O
+// "first_index" de cada shape já é relativo ao buffer de índices
+// compartilhado.
+struct StreamedMesh
+{
+    GLuint vertex_array_object_id;
+    GLint  base_vertex;
+    std::vector<StreamedShape> shapes;
+};
+
+// Carregamento em etapas, para que a leitura do arquivo possa ser feita fora
+// da thread do contexto OpenGL (veja "jobs.cpp"):
+//
+//   ObjStream_Begin()      - qualquer thread: abre o arquivo e conta vértices
+//   ObjStream_MapBuffers() - thread OpenGL: cria e mapeia buffers temporários
+//                            da GPU
+//   ObjStream_Parse()      - qualquer thread: lê as faces e escreve os vértices
+//   ObjStream_Finish()     - thread OpenGL: desmapeia, copia os buffers
+//                            temporários para os compartilhados e libera o
+//                            carregamento. Lança std::runtime_error se alguma
+//                            das etapas anteriores falhou.
+//
+// Os buffers temporários existem porque vários modelos podem estar sendo
+// lidos ao mesmo tempo, e um buffer só pode ter um mapeamento de cada vez.
+struct ObjStreamLoad;
+ObjStreamLoad* ObjStream_Begin(const char* filename);
+void ObjStream_MapBuffers(ObjStreamLoad* load, StreamedMesh* mesh);
+void ObjStream_Parse(ObjStreamLoad* load);
+void ObjStream_Finish(ObjStreamLoad* load, StreamedMesh* mesh);
+
+// Carrega um arquivo ".obj" escrevendo os vértices finais diretamente em
+// memória mapeada da GPU (glMapBufferRange), sem construir os vetores
+// intermediários de tinyobj::attrib_t/shape_t. Caso o arquivo não possua
+// normais, estas são computadas pela média das normais das faces (Gouraud).
+// Executa as quatro etapas acima em sequência. Lança std::runtime_error em
+// caso de erro.
+void ObjStream_LoadToGpu(const char* filename, StreamedMesh* mesh);
+
+#endif // _OBJSTREAM_H
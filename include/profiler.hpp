@@ -0,0 +1,87 @@
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include <cstdint>
+
+struct GLFWwindow;
+
+// Profiler de quadros: zonas de CPU (medidas com um relógio monotônico, em
+// qualquer thread) e zonas de GPU (medidas com consultas GL_TIME_ELAPSED).
+//
+// As consultas de GPU ficam em um anel de PROFILER_GPU_FRAMES quadros: o
+// resultado de um quadro só é lido alguns quadros depois, quando
+// GL_QUERY_RESULT_AVAILABLE indica que já está pronto, sem nunca esperar pela
+// GPU.
+//
+// Os eventos dos últimos quadros ficam em memória e podem ser exportados no
+// formato "Trace Event" do Chrome (abra o arquivo em chrome://tracing ou em
+// https://ui.perfetto.dev).
+//
+// Os nomes das zonas devem ser strings literais: apenas o ponteiro é guardado.
+
+#define PROFILER_GPU_FRAMES     4     // Profundidade do anel de consultas
+#define PROFILER_MAX_GPU_ZONES  16    // Zonas de GPU por quadro
+#define PROFILER_MAX_EVENTS     65536 // Eventos guardados para exportação
+
+// Deve ser chamada na thread do contexto OpenGL, após carregar as funções
+void Profiler_Init();
+void Profiler_Shutdown();
+
+// Delimitam um quadro. Profiler_EndFrame() também recolhe os resultados de
+// GPU que já estiverem disponíveis.
+void Profiler_BeginFrame();
+void Profiler_EndFrame();
+
+#ifndef PROFILER_DISABLED
+
+// Zonas de CPU. Podem ser aninhadas e usadas por qualquer thread.
+void Profiler_BeginZone(const char* name);
+void Profiler_EndZone();
+
+// Zonas de GPU, apenas na thread OpenGL. Consultas GL_TIME_ELAPSED não podem
+// ser aninhadas: uma zona iniciada dentro de outra é ignorada.
+void Profiler_BeginGpuZone(const char* name);
+void Profiler_EndGpuZone();
+
+#else
+
+// Compilando com -DPROFILER_DISABLED (ferramentas e benchmarks), as zonas não
+// geram código nem dependem de profiler.cpp
+inline void Profiler_BeginZone(const char*) {}
+inline void Profiler_EndZone() {}
+inline void Profiler_BeginGpuZone(const char*) {}
+inline void Profiler_EndGpuZone() {}
+
+#endif // PROFILER_DISABLED
+
+// Mostra a média (em ms) de cada zona no canto superior esquerdo da viewport
+// atual, usando o renderizador de texto. Zonas de todas as threads entram na
+// média, somadas por quadro da thread principal.
+void Profiler_DrawOverlay(GLFWwindow* window);
+void Profiler_ToggleOverlay();
+
+// Escreve os eventos guardados em "filename". Retorna falso em caso de erro.
+bool Profiler_ExportTrace(const char* filename);
+
+// Zonas delimitadas pelo escopo (RAII)
+class ProfilerZone
+{
+public:
+    explicit ProfilerZone(const char* name) { Profiler_BeginZone(name); }
+    ~ProfilerZone() { Profiler_EndZone(); }
+};
+
+class ProfilerGpuZone
+{
+public:
+    explicit ProfilerGpuZone(const char* name) { Profiler_BeginGpuZone(name); }
+    ~ProfilerGpuZone() { Profiler_EndGpuZone(); }
+};
+
+#define PROFILER_CONCAT2(a, b) a##b
+#define PROFILER_CONCAT(a, b)  PROFILER_CONCAT2(a, b)
+
+#define PROFILE_ZONE(name)     ProfilerZone    PROFILER_CONCAT(profiler_zone_, __LINE__)(name)
+#define PROFILE_GPU_ZONE(name) ProfilerGpuZone PROFILER_CONCAT(profiler_gpu_zone_, __LINE__)(name)
+
+#endif // _PROFILER_H
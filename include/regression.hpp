@@ -0,0 +1,43 @@
+#ifndef _REGRESSION_H
+#define _REGRESSION_H
+
+// Testes de regressão da renderização: cenas fixas (saída de bola, gol em
+// andamento, cada modo de câmera) são desenhadas fora da tela e comparadas com
+// imagens de referência em uma pasta. Pensado para rodar sem GPU, com o
+// llvmpipe do Mesa, de modo que as referências sejam as mesmas em qualquer
+// máquina.
+//
+// A comparação usa a diferença de cor no espaço YIQ (a mesma métrica do
+// "pixelmatch"), que pesa mais o brilho do que a crominância: diferenças
+// abaixo de REGRESSION_PIXEL_THRESHOLD não contam, e uma cena falha se mais de
+// REGRESSION_MAX_DIFF_FRACTION dos pixels diferirem. Nas falhas são escritas
+// "<cena>_actual.png" e "<cena>_diff.png" ao lado da referência.
+//
+// A primeira cena só começa a contar quadros quando todas as texturas
+// terminaram de carregar (veja "textureloader.hpp").
+//
+// Cada cena também é desenhada REGRESSION_TIMED_FRAMES vezes, e o tempo médio
+// por quadro (esperando a GPU com glFinish()) é impresso junto do resultado.
+
+#define REGRESSION_WARMUP_FRAMES     3
+#define REGRESSION_TIMED_FRAMES      20
+#define REGRESSION_PIXEL_THRESHOLD   0.1f   // De 0 a 1
+#define REGRESSION_MAX_DIFF_FRACTION 0.001f // 0.1% dos pixels
+
+// Com update = true as imagens de referência são (re)escritas em vez de
+// comparadas
+void Regression_Start(const char* golden_directory, bool update);
+bool Regression_IsActive();
+
+// Posiciona os carros, a bola e as câmeras para a cena atual. Retorna falso
+// quando todas as cenas já foram desenhadas.
+bool Regression_Update();
+
+// Chamada após desenhar o quadro no framebuffer fora da tela (veja
+// "capture.hpp") e antes da troca de buffers
+void Regression_EndFrame();
+
+// Imprime o resultado de cada cena. Retorna falso se alguma falhou.
+bool Regression_PrintReport();
+
+#endif // _REGRESSION_H
@@ -0,0 +1,51 @@
+#ifndef _SIMTHREAD_H
+#define _SIMTHREAD_H
+
+#include "simulation.hpp"
+
+// Execução da simulação (veja "simulation.hpp") em passos fixos, seja em uma
+// thread própria, seja na thread principal.
+//
+// Na thread própria, a simulação avança SIMULATION_TICK_RATE passos por
+// segundo independentemente dos quadros: a espera pelo vsync em
+// glfwSwapBuffers() não atrasa a física, e um passo demorado não atrasa a
+// apresentação. Ao fim de cada grupo de passos, o estado é publicado em um
+// buffer triplo sem locks: a thread da simulação escreve em um dos três
+// SimulationSnapshot, a renderização lê outro, e o terceiro guarda o mais
+// recente ainda não lido. As duas threads trocam de buffer com uma única
+// operação atômica, e nenhuma espera pela outra.
+//
+// Os comandos do teclado chegam à thread da simulação por SimThread_SetInput().
+// A gravação e a reprodução (veja "inputreplay.hpp") continuam passo a passo,
+// dentro da thread da simulação.
+//
+// Na captura de vídeo, cada quadro deve avançar a partida exatamente
+// 1/CAPTURE_FRAME_RATE segundo; nesse caso a simulação avança na thread
+// principal, com SimThread_Advance().
+
+// Inicia a thread da simulação a partir do estado atual da partida
+void SimThread_Start();
+
+// Para a thread; depois disso o estado da partida volta a pertencer à thread
+// principal. Sem efeito se a thread não foi iniciada.
+void SimThread_Stop();
+
+bool SimThread_IsRunning();
+
+// Comandos atuais do teclado, usados pelos próximos passos. Chamada pela
+// thread principal a cada quadro.
+void SimThread_SetInput(SimulationInput input);
+
+// Copia o estado publicado mais recente
+void SimThread_GetSnapshot(SimulationSnapshot* snapshot);
+
+// Verdadeiro quando a reprodução de uma gravação chegou ao fim (a thread
+// então para de avançar a simulação)
+bool SimThread_IsReplayFinished();
+
+// Sem a thread: avança a simulação na thread chamadora, quantos passos
+// couberem em "delta_time" segundos (mais o resto dos quadros anteriores).
+// Retorna falso quando a reprodução de uma gravação chegou ao fim.
+bool SimThread_Advance(float delta_time, SimulationInput input);
+
+#endif // _SIMTHREAD_H
@@ -0,0 +1,94 @@
+#ifndef _SIMULATION_H
+#define _SIMULATION_H
+
+#include <cstdint>
+
+#include "./glad/glad.h"
+#include "./glm/vec4.hpp"
+
+// Simulação da partida: movimento dos carros e da bola, e colisões. Avança
+// sempre em passos fixos de SIMULATION_TICK segundos, de modo que o resultado
+// depende apenas da sequência de comandos, e não da taxa de quadros.
+
+#define SIMULATION_TICK_RATE           120 // Passos por segundo
+#define SIMULATION_TICK                (1.0f / SIMULATION_TICK_RATE)
+#define SIMULATION_MAX_TICKS_PER_FRAME 8   // Limite para não acumular atraso
+
+// Comandos de um carro em um passo, um bit para cada tecla
+#define INPUT_FRONT         (1 << 0)
+#define INPUT_BACK          (1 << 1)
+#define INPUT_LEFT          (1 << 2)
+#define INPUT_RIGHT         (1 << 3)
+#define INPUT_LOOK_BACK     (1 << 4)
+#define INPUT_LOOK_AT_BALL  (1 << 5)
+
+struct SimulationInput
+{
+    uint8_t purple;
+    uint8_t orange;
+};
+
+// Cópia do estado usado pela renderização: posições, direções e os comandos
+// do último passo (que definem as câmeras)
+struct SimulationSnapshot
+{
+    glm::vec4       purple_car_position;
+    glm::vec4       orange_car_position;
+    glm::vec4       ball_position;
+    GLfloat         purple_car_direction_angle;
+    GLfloat         orange_car_direction_angle;
+    SimulationInput input;
+};
+
+// Estado da partida. Enquanto a simulação executa em sua própria thread (veja
+// "simthread.hpp"), a renderização usa apenas cópias (SimulationSnapshot).
+extern glm::vec4 purple_car_position;
+extern glm::vec4 orange_car_position;
+extern glm::vec4 ball_position;
+
+extern glm::vec4 purple_car_speed;
+extern glm::vec4 orange_car_speed;
+extern glm::vec4 ball_speed;
+
+extern glm::vec4 purple_car_direction;
+extern glm::vec4 orange_car_direction;
+
+extern GLfloat purple_car_direction_angle;
+extern GLfloat orange_car_direction_angle;
+
+extern GLboolean is_ball_returning;
+
+// Comandos atuais de cada jogador, atualizados por KeyCallback() (ou pelas
+// poses fixas do benchmark e da regressão). A simulação não os lê
+// diretamente: veja Simulation_SetInput().
+extern GLboolean is_purple_car_moving_left;
+extern GLboolean is_purple_car_moving_right;
+extern GLboolean is_purple_car_moving_front;
+extern GLboolean is_purple_car_moving_back;
+extern GLboolean is_purple_camera_looking_back;
+extern GLboolean is_purple_car_looking_at_ball;
+
+extern GLboolean is_orange_car_moving_left;
+extern GLboolean is_orange_car_moving_right;
+extern GLboolean is_orange_car_moving_front;
+extern GLboolean is_orange_car_moving_back;
+extern GLboolean is_orange_camera_looking_back;
+extern GLboolean is_orange_car_looking_at_ball;
+
+// Coloca a bola e os carros nas posições iniciais, parados
+void Simulation_Reset();
+
+// Avança a simulação em "delta_time" segundos (normalmente SIMULATION_TICK)
+void Simulation_Step(float delta_time);
+
+// Lê os comandos atuais (os globais acima) na forma compacta usada nas
+// gravações
+SimulationInput Simulation_GetInput();
+
+// Define os comandos usados pelos próximos passos da simulação
+void Simulation_SetInput(SimulationInput input);
+
+// Copia o estado atual da partida
+void Simulation_GetSnapshot(SimulationSnapshot* snapshot);
+
+#endif // _SIMULATION_H
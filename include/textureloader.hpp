@@ -0,0 +1,38 @@
+#ifndef _TEXTURELOADER_H
+#define _TEXTURELOADER_H
+
+#include "./glad/glad.h"
+
+// Carregamento assíncrono de texturas.
+//
+// A decodificação das imagens (JPEG, PNG, ...) é feita pelas threads
+// auxiliares de "jobs.cpp", que escrevem os pixels diretamente em "pixel
+// unpack buffers" (PBOs) mapeados. A thread que possui o contexto OpenGL
+// apenas cria/mapeia os PBOs e faz o upload (glTexImage2D + glGenerateMipmap)
+// quando a imagem está pronta, dentro de Jobs_RunMainThread(). Enquanto isso,
+// uma textura provisória fica associada à unidade.
+//
+// Cada unidade é dona da sua textura e do seu sampler (veja
+// "gpuresources.hpp"). Pedir novamente uma unidade já carregada recarrega a
+// imagem: a textura anterior continua em uso até a nova ficar pronta, e então
+// é liberada. Se a nova imagem não pode ser lida, a anterior é mantida; no
+// primeiro carregamento da unidade, o programa é encerrado.
+
+// Número de unidades de textura que podem ser usadas pelo carregador
+#define TEXTURELOADER_MAX_UNITS 16
+
+// Cria a textura provisória. Deve ser chamada na thread do contexto OpenGL,
+// após Jobs_Init().
+void TextureLoader_Init();
+
+// Pede o carregamento de uma imagem, que ficará associada à unidade de
+// textura "texture_unit" (GL_TEXTURE0 + texture_unit).
+void TextureLoader_Request(const char* filename, GLuint texture_unit);
+
+// Retorna verdadeiro se não há nenhum carregamento pendente
+bool TextureLoader_IsIdle();
+
+// Libera as texturas, os samplers e a textura provisória
+void TextureLoader_Shutdown();
+
+#endif // _TEXTURELOADER_H
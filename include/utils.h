@@ -3,6 +3,11 @@
 
 #include <cstdio>
 
+// glGetError() força a sincronização entre CPU e GPU em muitos drivers, então
+// a consulta só é feita em builds de depuração (-DGL_ERROR_POLLING). Nos
+// demais, os erros são reportados pelo callback de "gldebug.hpp".
+#ifdef GL_ERROR_POLLING
+
 static GLenum glCheckError_(const char *file, int line)
 {
     GLenum errorCode;
@@ -26,4 +31,10 @@ static GLenum glCheckError_(const char *file, int line)
 }
 #define glCheckError() glCheckError_(__FILE__, __LINE__)
 
+#else
+
+#define glCheckError() ((void)0)
+
+#endif // GL_ERROR_POLLING
+
 #endif // _UTILS_H
@@ -0,0 +1,356 @@
+#include "../include/archive.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// Pacote atualmente mapeado. Só é modificado por Archive_Open()/Close(), antes
+// e depois do carregamento dos assets, então as leituras não precisam de
+// sincronização.
+static const char*         g_ArchiveData    = NULL;
+static size_t              g_ArchiveSize    = 0;
+static const ArchiveEntry* g_ArchiveEntries = NULL;
+static const char*         g_ArchiveNames   = NULL;
+static uint32_t            g_ArchiveCount   = 0;
+
+// Com verdadeiro, os arquivos do disco têm preferência sobre o pacote
+static std::atomic<bool> g_PreferLooseFiles(false);
+
+#if defined(_WIN32)
+static HANDLE g_ArchiveFile    = INVALID_HANDLE_VALUE;
+static HANDLE g_ArchiveMapping = NULL;
+#endif
+
+uint64_t Archive_Hash(const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string Archive_NormalizeName(const char* path)
+{
+    std::string name(path);
+    std::replace(name.begin(), name.end(), '\\', '/');
+
+    for (;;)
+    {
+        if (name.compare(0, 2, "./") == 0)
+            name.erase(0, 2);
+        else if (name.compare(0, 3, "../") == 0)
+            name.erase(0, 3);
+        else
+            break;
+    }
+    return name;
+}
+
+static bool MapFile(const char* filename)
+{
+#if defined(_WIN32)
+    g_ArchiveFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (g_ArchiveFile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(g_ArchiveFile, &size) || size.QuadPart == 0)
+        return false;
+
+    g_ArchiveMapping = CreateFileMappingA(g_ArchiveFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (g_ArchiveMapping == NULL)
+        return false;
+
+    g_ArchiveData = (const char*)MapViewOfFile(g_ArchiveMapping, FILE_MAP_READ, 0, 0, 0);
+    g_ArchiveSize = (size_t)size.QuadPart;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+
+    g_ArchiveData = (const char*)data;
+    g_ArchiveSize = (size_t)st.st_size;
+#endif
+    return g_ArchiveData != NULL;
+}
+
+bool Archive_Open(const char* filename)
+{
+    Archive_Close();
+
+    if (!MapFile(filename))
+    {
+        Archive_Close();
+        return false;
+    }
+
+    // Validamos o cabeçalho e os limites da tabela antes de confiar neles
+    const ArchiveHeader* header = (const ArchiveHeader*)g_ArchiveData;
+    bool valid = g_ArchiveSize >= sizeof(ArchiveHeader)
+              && header->magic == ARCHIVE_MAGIC
+              && header->version == ARCHIVE_VERSION
+              && header->names_offset <= header->toc_offset
+              && header->toc_offset <= g_ArchiveSize
+              && (g_ArchiveSize - header->toc_offset) / sizeof(ArchiveEntry) >= header->num_entries;
+
+    if (valid)
+    {
+        g_ArchiveEntries = (const ArchiveEntry*)(g_ArchiveData + header->toc_offset);
+        g_ArchiveNames   = g_ArchiveData + header->names_offset;
+        g_ArchiveCount   = header->num_entries;
+
+        size_t names_size = header->toc_offset - header->names_offset;
+        for (uint32_t i = 0; i < g_ArchiveCount && valid; ++i)
+        {
+            const ArchiveEntry& entry = g_ArchiveEntries[i];
+            valid = entry.offset <= g_ArchiveSize
+                 && entry.size <= g_ArchiveSize - entry.offset
+                 && (size_t)entry.name_offset + entry.name_length < names_size;
+        }
+    }
+
+    if (!valid)
+    {
+        fprintf(stderr, "ERROR: Invalid asset archive \"%s\".\n", filename);
+        Archive_Close();
+        return false;
+    }
+
+    printf("Pacote de assets \"%s\" aberto (%u arquivos).\n", filename, g_ArchiveCount);
+    return true;
+}
+
+void Archive_Close()
+{
+#if defined(_WIN32)
+    if (g_ArchiveData != NULL)
+        UnmapViewOfFile(g_ArchiveData);
+    if (g_ArchiveMapping != NULL)
+        CloseHandle(g_ArchiveMapping);
+    if (g_ArchiveFile != INVALID_HANDLE_VALUE)
+        CloseHandle(g_ArchiveFile);
+    g_ArchiveMapping = NULL;
+    g_ArchiveFile    = INVALID_HANDLE_VALUE;
+#else
+    if (g_ArchiveData != NULL)
+        munmap((void*)g_ArchiveData, g_ArchiveSize);
+#endif
+    g_ArchiveData    = NULL;
+    g_ArchiveSize    = 0;
+    g_ArchiveEntries = NULL;
+    g_ArchiveNames   = NULL;
+    g_ArchiveCount   = 0;
+}
+
+bool Archive_IsOpen()
+{
+    return g_ArchiveData != NULL;
+}
+
+bool Archive_Verify()
+{
+    bool ok = true;
+    for (uint32_t i = 0; i < g_ArchiveCount; ++i)
+    {
+        const ArchiveEntry& entry = g_ArchiveEntries[i];
+        if (Archive_Hash(g_ArchiveData + entry.offset, (size_t)entry.size) != entry.content_hash)
+        {
+            fprintf(stderr, "ERROR: Corrupted asset \"%.*s\" in archive.\n", (int)entry.name_length, g_ArchiveNames + entry.name_offset);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Busca binária na tabela, que está ordenada por hash do nome. O nome é
+// comparado em seguida para descartar colisões.
+static const ArchiveEntry* FindEntry(const std::string& name)
+{
+    uint64_t hash = Archive_Hash(name.data(), name.size());
+
+    const ArchiveEntry* end = g_ArchiveEntries + g_ArchiveCount;
+    const ArchiveEntry* it  = std::lower_bound(g_ArchiveEntries, end, hash,
+        [](const ArchiveEntry& entry, uint64_t h) { return entry.name_hash < h; });
+
+    for (; it != end && it->name_hash == hash; ++it)
+    {
+        if (it->name_length == name.size() && memcmp(g_ArchiveNames + it->name_offset, name.data(), name.size()) == 0)
+            return it;
+    }
+    return NULL;
+}
+
+void Archive_SetPreferLooseFiles(bool prefer)
+{
+    g_PreferLooseFiles = prefer;
+}
+
+static bool LoadLooseFile(const char* path, AssetFile* file)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    file->storage.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    file->data = file->storage.data();
+    file->size = file->storage.size();
+    return true;
+}
+
+bool Asset_Load(const char* path, AssetFile* file)
+{
+    if (g_PreferLooseFiles && LoadLooseFile(path, file))
+        return true;
+
+    if (g_ArchiveData != NULL)
+    {
+        const ArchiveEntry* entry = FindEntry(Archive_NormalizeName(path));
+        if (entry != NULL)
+        {
+            std::vector<char>().swap(file->storage);
+            file->data = g_ArchiveData + entry->offset;
+            file->size = (size_t)entry->size;
+            return true;
+        }
+    }
+
+    return LoadLooseFile(path, file);
+}
+
+bool Asset_Exists(const char* path)
+{
+    if (g_ArchiveData != NULL && FindEntry(Archive_NormalizeName(path)) != NULL)
+        return true;
+
+    std::ifstream in(path, std::ios::binary);
+    return (bool)in;
+}
+
+int64_t Asset_GetModificationTime(const char* path)
+{
+    struct stat info;
+    if (stat(path, &info) != 0)
+        return 0;
+    return (int64_t)info.st_mtime;
+}
+
+static void WritePadding(std::ofstream& out, uint64_t* offset, uint64_t alignment)
+{
+    static const char zeros[ARCHIVE_ALIGNMENT] = { 0 };
+    uint64_t padding = (alignment - (*offset % alignment)) % alignment;
+    out.write(zeros, (std::streamsize)padding);
+    *offset += padding;
+}
+
+bool Archive_Write(const char* filename, const std::vector<std::string>& paths)
+{
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+
+    // O cabeçalho é reescrito ao final, quando os deslocamentos são conhecidos
+    ArchiveHeader header;
+    memset(&header, 0, sizeof(header));
+    out.write((const char*)&header, sizeof(header));
+    uint64_t offset = sizeof(header);
+
+    std::vector<ArchiveEntry> entries;
+    std::string names;
+    for (size_t i = 0; i < paths.size(); ++i)
+    {
+        std::ifstream in(paths[i].c_str(), std::ios::binary);
+        if (!in)
+        {
+            fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", paths[i].c_str());
+            return false;
+        }
+        std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+        std::string name = Archive_NormalizeName(paths[i].c_str());
+        ArchiveEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.name_hash    = Archive_Hash(name.data(), name.size());
+        entry.content_hash = Archive_Hash(data.data(), data.size());
+        entry.name_offset  = (uint32_t)names.size();
+        entry.name_length  = (uint32_t)name.size();
+
+        for (size_t j = 0; j < entries.size(); ++j)
+        {
+            if (entries[j].name_hash == entry.name_hash && names.compare(entries[j].name_offset, entries[j].name_length, name) == 0)
+            {
+                fprintf(stderr, "ERROR: Duplicated asset \"%s\".\n", name.c_str());
+                return false;
+            }
+        }
+
+        WritePadding(out, &offset, ARCHIVE_ALIGNMENT);
+        entry.offset = offset;
+        entry.size   = data.size();
+        out.write(data.data(), (std::streamsize)data.size());
+        offset += data.size();
+
+        names.append(name);
+        names.push_back('\0');
+        entries.push_back(entry);
+
+        printf("  %-40s %10llu bytes\n", name.c_str(), (unsigned long long)entry.size);
+    }
+
+    header.names_offset = offset;
+    out.write(names.data(), (std::streamsize)names.size());
+    offset += names.size();
+
+    std::sort(entries.begin(), entries.end(),
+        [](const ArchiveEntry& a, const ArchiveEntry& b) { return a.name_hash < b.name_hash; });
+
+    WritePadding(out, &offset, 8);
+    header.magic       = ARCHIVE_MAGIC;
+    header.version     = ARCHIVE_VERSION;
+    header.num_entries = (uint32_t)entries.size();
+    header.toc_offset  = offset;
+    if (!entries.empty())
+        out.write((const char*)entries.data(), (std::streamsize)(entries.size() * sizeof(ArchiveEntry)));
+
+    out.seekp(0);
+    out.write((const char*)&header, sizeof(header));
+
+    if (!out)
+    {
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", filename);
+        return false;
+    }
+    return true;
+}
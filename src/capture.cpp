@@ -0,0 +1,535 @@
+#include "../include/capture.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <condition_variable>
+
+#include "../include/glad/glad.h"
+#include "../include/gpuresources.hpp"
+#include "../include/jobs.hpp"
+
+enum CaptureFormat
+{
+    CAPTURE_Y4M,
+    CAPTURE_RAW,
+    CAPTURE_PNG,
+    CAPTURE_NONE // Apenas o framebuffer, sem saída
+};
+
+// Um pixel buffer do anel. "frame" é o quadro cuja leitura foi agendada nele,
+// ou -1 se estiver livre.
+struct CaptureSlot
+{
+    GpuBuffer pbo;
+    GpuFence  fence;
+    int64_t   frame;
+};
+
+typedef std::shared_ptr<std::vector<uint8_t> > CaptureBuffer;
+
+static bool          g_CaptureActive    = false;
+static int           g_CaptureWidth     = 0;
+static int           g_CaptureHeight    = 0;
+static CaptureFormat g_CaptureFormat    = CAPTURE_Y4M;
+static std::string   g_CaptureOutput;
+static std::string   g_CapturePngPrefix;     // Nome de cada PNG: prefixo, número
+static std::string   g_CapturePngSuffix;     // do quadro com g_CapturePngDigits
+static int           g_CapturePngDigits = 0; // dígitos (com zeros) e sufixo
+static FILE*         g_CaptureFile      = NULL;
+static GpuFramebuffer  g_CaptureFBO;
+static GpuRenderbuffer g_CaptureColor;
+static GpuRenderbuffer g_CaptureDepth;
+static CaptureSlot   g_CaptureSlots[CAPTURE_PBO_COUNT];
+static int64_t       g_CaptureFrame     = 0; // Próximo quadro a ser lido
+
+// Quadros entregues às threads auxiliares e ainda não escritos
+static std::mutex              g_CapturePendingMutex;
+static std::condition_variable g_CapturePendingCondition;
+static int                     g_CapturePending = 0;
+
+// Os quadros de vídeo podem terminar a conversão fora de ordem: ficam aqui até
+// chegar a vez de cada um ser escrito
+static std::mutex                         g_CaptureWriteMutex;
+static std::map<int64_t, CaptureBuffer>   g_CaptureReady;
+static int64_t                            g_CaptureNextWrite  = 0;
+static bool                               g_CaptureWriteError = false;
+
+static bool EndsWith(const std::string& str, const char* suffix)
+{
+    size_t length = strlen(suffix);
+    return str.size() >= length && str.compare(str.size() - length, length, suffix) == 0;
+}
+
+// Separa um padrão no estilo printf ("q_%05d.png") em prefixo, número de
+// dígitos e sufixo. Aceita exatamente uma conversão "%d" ou "%0Nd", além de
+// "%%" para o caractere '%'. Qualquer outra conversão é recusada, pois o
+// padrão vem da linha de comando.
+static bool ParsePngPattern(const std::string& pattern, std::string* prefix, int* digits, std::string* suffix)
+{
+    prefix->clear();
+    suffix->clear();
+    *digits = 0;
+
+    bool found = false;
+    for (size_t i = 0; i < pattern.size(); ++i)
+    {
+        std::string* out = found ? suffix : prefix;
+        if (pattern[i] != '%')
+        {
+            out->push_back(pattern[i]);
+            continue;
+        }
+
+        if (i + 1 < pattern.size() && pattern[i + 1] == '%')
+        {
+            out->push_back('%');
+            i += 1;
+            continue;
+        }
+
+        // "%d" ou "%0Nd", com N de até dois dígitos
+        size_t j = i + 1;
+        int width = 0;
+        if (j < pattern.size() && pattern[j] == '0')
+        {
+            j += 1;
+            size_t first_digit = j;
+            while (j < pattern.size() && j < first_digit + 2 && pattern[j] >= '0' && pattern[j] <= '9')
+                width = 10 * width + (pattern[j++] - '0');
+            if (j == first_digit)
+                return false;
+        }
+        if (found || j >= pattern.size() || pattern[j] != 'd')
+            return false;
+
+        found   = true;
+        *digits = width;
+        i = j;
+    }
+    return found;
+}
+
+// CRC dos blocos PNG (polinômio 0xEDB88320, o mesmo do zlib)
+static uint32_t Crc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+    // Inicialização de estáticas locais é segura entre threads
+    struct CrcTable
+    {
+        uint32_t values[256];
+        CrcTable()
+        {
+            for (uint32_t n = 0; n < 256; ++n)
+            {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                values[n] = c;
+            }
+        }
+    };
+    static const CrcTable table;
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i)
+        crc = table.values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void PutU32(std::vector<uint8_t>& out, uint32_t value)
+{
+    out.push_back((uint8_t)(value >> 24));
+    out.push_back((uint8_t)(value >> 16));
+    out.push_back((uint8_t)(value >> 8));
+    out.push_back((uint8_t)value);
+}
+
+static void PutChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data)
+{
+    PutU32(png, (uint32_t)data.size());
+    size_t start = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+    PutU32(png, Crc32(0, &png[start], png.size() - start));
+}
+
+// Não temos zlib: os dados vão em blocos "stored" do deflate, sem
+// compressão, o que é rápido de gerar e suficiente para imagens
+// intermediárias.
+bool Capture_WritePng(const char* filename, const uint8_t* rgb, int width, int height)
+{
+    size_t row_size = (size_t)width * 3;
+
+    // Cada linha é precedida pelo tipo de filtro (0, nenhum)
+    std::vector<uint8_t> raw;
+    raw.reserve((row_size + 1) * height);
+    for (int y = 0; y < height; ++y)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb + y * row_size, rgb + (y + 1) * row_size);
+    }
+
+    std::vector<uint8_t> zlib;
+    zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    zlib.push_back(0x78);
+    zlib.push_back(0x01);
+    size_t offset = 0;
+    do
+    {
+        size_t length = std::min(raw.size() - offset, (size_t)65535);
+        zlib.push_back(offset + length == raw.size() ? 1 : 0);
+        zlib.push_back((uint8_t)length);
+        zlib.push_back((uint8_t)(length >> 8));
+        zlib.push_back((uint8_t)~length);
+        zlib.push_back((uint8_t)(~length >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+        offset += length;
+    } while (offset < raw.size());
+
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < raw.size(); ++i)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    PutU32(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    PutU32(header, width);
+    PutU32(header, height);
+    header.push_back(8); // Bits por canal
+    header.push_back(2); // RGB
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<uint8_t> png(signature, signature + 8);
+    PutChunk(png, "IHDR", header);
+    PutChunk(png, "IDAT", zlib);
+    PutChunk(png, "IEND", std::vector<uint8_t>());
+
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+    fwrite(png.data(), 1, png.size(), file);
+    bool ok = !ferror(file);
+    fclose(file);
+    if (!ok)
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", filename);
+    return ok;
+}
+
+// RGBA de baixo para cima (como OpenGL devolve) para RGB de cima para baixo
+static CaptureBuffer ConvertToRgb(const std::vector<uint8_t>& rgba)
+{
+    CaptureBuffer rgb(new std::vector<uint8_t>((size_t)g_CaptureWidth * g_CaptureHeight * 3));
+    for (int y = 0; y < g_CaptureHeight; ++y)
+    {
+        const uint8_t* src = &rgba[(size_t)(g_CaptureHeight - 1 - y) * g_CaptureWidth * 4];
+        uint8_t*       dst = &(*rgb)[(size_t)y * g_CaptureWidth * 3];
+        for (int x = 0; x < g_CaptureWidth; ++x)
+        {
+            dst[x * 3 + 0] = src[x * 4 + 0];
+            dst[x * 3 + 1] = src[x * 4 + 1];
+            dst[x * 3 + 2] = src[x * 4 + 2];
+        }
+    }
+    return rgb;
+}
+
+// RGBA de baixo para cima para um quadro Y4M (YUV 4:2:0, BT.601 com faixa
+// limitada). A crominância é a média de cada bloco 2x2.
+static CaptureBuffer ConvertToY4m(const std::vector<uint8_t>& rgba)
+{
+    static const char frame_header[] = "FRAME\n";
+    int    width  = g_CaptureWidth;
+    int    height = g_CaptureHeight;
+    size_t header = sizeof(frame_header) - 1;
+    size_t luma   = (size_t)width * height;
+    size_t chroma = luma / 4;
+
+    CaptureBuffer yuv(new std::vector<uint8_t>(header + luma + 2 * chroma));
+    uint8_t* out = yuv->data();
+    memcpy(out, frame_header, header);
+    uint8_t* plane_y = out + header;
+    uint8_t* plane_u = plane_y + luma;
+    uint8_t* plane_v = plane_u + chroma;
+
+    for (int y = 0; y < height; ++y)
+    {
+        const uint8_t* src = &rgba[(size_t)(height - 1 - y) * width * 4];
+        for (int x = 0; x < width; ++x)
+        {
+            int r = src[x * 4 + 0], g = src[x * 4 + 1], b = src[x * 4 + 2];
+            plane_y[(size_t)y * width + x] = (uint8_t)(16 + ((66 * r + 129 * g + 25 * b + 128) >> 8));
+        }
+    }
+
+    for (int y = 0; y < height / 2; ++y)
+    {
+        const uint8_t* row0 = &rgba[(size_t)(height - 1 - 2 * y) * width * 4];
+        const uint8_t* row1 = &rgba[(size_t)(height - 2 - 2 * y) * width * 4];
+        for (int x = 0; x < width / 2; ++x)
+        {
+            int r = (row0[x * 8 + 0] + row0[x * 8 + 4] + row1[x * 8 + 0] + row1[x * 8 + 4] + 2) / 4;
+            int g = (row0[x * 8 + 1] + row0[x * 8 + 5] + row1[x * 8 + 1] + row1[x * 8 + 5] + 2) / 4;
+            int b = (row0[x * 8 + 2] + row0[x * 8 + 6] + row1[x * 8 + 2] + row1[x * 8 + 6] + 2) / 4;
+            plane_u[(size_t)y * (width / 2) + x] = (uint8_t)(128 + ((-38 * r - 74 * g + 112 * b + 128) >> 8));
+            plane_v[(size_t)y * (width / 2) + x] = (uint8_t)(128 + ((112 * r - 94 * g - 18 * b + 128) >> 8));
+        }
+    }
+    return yuv;
+}
+
+// Executada por uma thread auxiliar para cada quadro lido
+static void ProcessFrame(int64_t frame, CaptureBuffer rgba)
+{
+    if (g_CaptureFormat == CAPTURE_PNG)
+    {
+        char number[32];
+        snprintf(number, sizeof(number), "%0*d", g_CapturePngDigits, (int)frame);
+        std::string filename = g_CapturePngPrefix + number + g_CapturePngSuffix;
+        CaptureBuffer rgb = ConvertToRgb(*rgba);
+        rgba.reset();
+        if (!Capture_WritePng(filename.c_str(), rgb->data(), g_CaptureWidth, g_CaptureHeight))
+        {
+            std::lock_guard<std::mutex> lock(g_CaptureWriteMutex);
+            g_CaptureWriteError = true;
+        }
+    }
+    else
+    {
+        CaptureBuffer data = g_CaptureFormat == CAPTURE_Y4M ? ConvertToY4m(*rgba) : ConvertToRgb(*rgba);
+        rgba.reset();
+
+        // Quem completa a sequência escreve todos os quadros prontos em ordem
+        std::lock_guard<std::mutex> lock(g_CaptureWriteMutex);
+        g_CaptureReady[frame] = data;
+        std::map<int64_t, CaptureBuffer>::iterator it;
+        while ((it = g_CaptureReady.find(g_CaptureNextWrite)) != g_CaptureReady.end())
+        {
+            if (!g_CaptureWriteError && fwrite(it->second->data(), 1, it->second->size(), g_CaptureFile) != it->second->size())
+            {
+                fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", g_CaptureOutput.c_str());
+                g_CaptureWriteError = true;
+            }
+            g_CaptureReady.erase(it);
+            g_CaptureNextWrite++;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_CapturePendingMutex);
+        g_CapturePending--;
+    }
+    g_CapturePendingCondition.notify_all();
+}
+
+// Copia os pixels de um pixel buffer cuja leitura já foi agendada e os
+// entrega a uma thread auxiliar
+static void ReadSlot(CaptureSlot& slot)
+{
+    // Normalmente a cópia já terminou há alguns quadros e não há espera
+    while (glClientWaitSync(slot.fence.Get(), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull) == GL_TIMEOUT_EXPIRED)
+        ;
+    slot.fence.Reset();
+
+    // Se a escrita não acompanha a renderização, esperamos, em vez de
+    // acumular quadros na memória
+    {
+        std::unique_lock<std::mutex> lock(g_CapturePendingMutex);
+        g_CapturePendingCondition.wait(lock, [] { return g_CapturePending < CAPTURE_MAX_PENDING; });
+        g_CapturePending++;
+    }
+
+    size_t size = (size_t)g_CaptureWidth * g_CaptureHeight * 4;
+    CaptureBuffer rgba(new std::vector<uint8_t>(size));
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo.Get());
+    const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (pixels != NULL)
+    {
+        memcpy(rgba->data(), pixels, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    int64_t frame = slot.frame;
+    slot.frame = -1;
+    Jobs_Submit([frame, rgba] { ProcessFrame(frame, rgba); });
+}
+
+bool Capture_Init(int width, int height, const char* output, int frame_rate)
+{
+    g_CaptureOutput = output != NULL ? output : "";
+    if (output == NULL)
+        g_CaptureFormat = CAPTURE_NONE;
+    else if (EndsWith(g_CaptureOutput, ".y4m"))
+        g_CaptureFormat = CAPTURE_Y4M;
+    else if (EndsWith(g_CaptureOutput, ".rgb"))
+        g_CaptureFormat = CAPTURE_RAW;
+    else if (EndsWith(g_CaptureOutput, ".png") && ParsePngPattern(g_CaptureOutput, &g_CapturePngPrefix, &g_CapturePngDigits, &g_CapturePngSuffix))
+        g_CaptureFormat = CAPTURE_PNG;
+    else
+    {
+        fprintf(stderr, "ERROR: Unknown capture output \"%s\" (expected .y4m, .rgb or a .png pattern such as \"q_%%05d.png\").\n", output);
+        return false;
+    }
+
+    if (g_CaptureFormat == CAPTURE_Y4M && (width % 2 != 0 || height % 2 != 0))
+    {
+        fprintf(stderr, "ERROR: Y4M capture needs even dimensions, got %dx%d.\n", width, height);
+        return false;
+    }
+
+    if (g_CaptureFormat == CAPTURE_Y4M || g_CaptureFormat == CAPTURE_RAW)
+    {
+        g_CaptureFile = fopen(output, "wb");
+        if (g_CaptureFile == NULL)
+        {
+            fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", output);
+            return false;
+        }
+        if (g_CaptureFormat == CAPTURE_Y4M)
+            fprintf(g_CaptureFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, frame_rate);
+    }
+
+    g_CaptureWidth  = width;
+    g_CaptureHeight = height;
+
+    // Cor RGBA8 e profundidade de 24 bits (em geral 4 bytes por pixel)
+    g_CaptureColor.Create("capture color");
+    glBindRenderbuffer(GL_RENDERBUFFER, g_CaptureColor.Get());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    g_CaptureColor.SetSize((size_t)width * height * 4);
+
+    g_CaptureDepth.Create("capture depth");
+    glBindRenderbuffer(GL_RENDERBUFFER, g_CaptureDepth.Get());
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    g_CaptureDepth.SetSize((size_t)width * height * 4);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    g_CaptureFBO.Create("capture");
+    glBindFramebuffer(GL_FRAMEBUFFER, g_CaptureFBO.Get());
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, g_CaptureColor.Get());
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, g_CaptureDepth.Get());
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        fprintf(stderr, "ERROR: Capture framebuffer incomplete (0x%04x).\n", status);
+        Capture_Shutdown();
+        return false;
+    }
+
+    for (int i = 0; i < CAPTURE_PBO_COUNT && output != NULL; ++i)
+    {
+        g_CaptureSlots[i].pbo.Create("capture readback");
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, g_CaptureSlots[i].pbo.Get());
+        glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)width * height * 4, NULL, GL_STREAM_READ);
+        g_CaptureSlots[i].pbo.SetSize((size_t)width * height * 4);
+        g_CaptureSlots[i].fence.Reset();
+        g_CaptureSlots[i].frame = -1;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    g_CaptureFrame      = 0;
+    g_CaptureNextWrite  = 0;
+    g_CaptureWriteError = false;
+    g_CaptureActive     = true;
+
+    if (output != NULL)
+        printf("Capturando quadros %dx%d em \"%s\".\n", width, height, output);
+    return true;
+}
+
+bool Capture_IsActive()
+{
+    return g_CaptureActive;
+}
+
+void Capture_BeginFrame()
+{
+    if (!g_CaptureActive)
+        return;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_CaptureFBO.Get());
+}
+
+void Capture_EndFrame()
+{
+    if (!g_CaptureActive || g_CaptureFormat == CAPTURE_NONE)
+        return;
+
+    // O pixel buffer deste quadro foi usado CAPTURE_PBO_COUNT quadros atrás;
+    // lemos aquele quadro antes de reutilizá-lo
+    CaptureSlot& slot = g_CaptureSlots[g_CaptureFrame % CAPTURE_PBO_COUNT];
+    if (slot.frame >= 0)
+        ReadSlot(slot);
+
+    // Com um GL_PIXEL_PACK_BUFFER ligado, glReadPixels() retorna sem esperar
+    // pela GPU
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, g_CaptureFBO.Get());
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo.Get());
+    glReadPixels(0, 0, g_CaptureWidth, g_CaptureHeight, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    slot.fence.Create("capture readback");
+    slot.frame = g_CaptureFrame++;
+}
+
+void Capture_ReadPixels(std::vector<uint8_t>* rgb, int* width, int* height)
+{
+    std::vector<uint8_t> rgba((size_t)g_CaptureWidth * g_CaptureHeight * 4);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, g_CaptureFBO.Get());
+    glReadPixels(0, 0, g_CaptureWidth, g_CaptureHeight, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    *rgb    = *ConvertToRgb(rgba);
+    *width  = g_CaptureWidth;
+    *height = g_CaptureHeight;
+}
+
+void Capture_Shutdown()
+{
+    if (g_CaptureActive && g_CaptureFormat != CAPTURE_NONE)
+    {
+        // Os quadros restantes, do mais antigo ao mais recente
+        for (int i = 0; i < CAPTURE_PBO_COUNT; ++i)
+        {
+            CaptureSlot& slot = g_CaptureSlots[(g_CaptureFrame + i) % CAPTURE_PBO_COUNT];
+            if (slot.frame >= 0)
+                ReadSlot(slot);
+        }
+
+        std::unique_lock<std::mutex> lock(g_CapturePendingMutex);
+        g_CapturePendingCondition.wait(lock, [] { return g_CapturePending == 0; });
+
+        printf("Captura: %lld quadros em \"%s\"%s.\n", (long long)g_CaptureFrame, g_CaptureOutput.c_str(), g_CaptureWriteError ? " (com erros)" : "");
+    }
+
+    for (int i = 0; i < CAPTURE_PBO_COUNT; ++i)
+    {
+        g_CaptureSlots[i].pbo.Reset();
+        g_CaptureSlots[i].fence.Reset();
+        g_CaptureSlots[i].frame = -1;
+    }
+    g_CaptureFBO.Reset();
+    g_CaptureColor.Reset();
+    g_CaptureDepth.Reset();
+
+    if (g_CaptureFile != NULL)
+        fclose(g_CaptureFile);
+    g_CaptureFile   = NULL;
+    g_CaptureActive = false;
+}
@@ -0,0 +1,110 @@
+#include "../include/cookedmesh.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+
+#include "../include/glad/glad.h"
+#include "../include/archive.hpp"
+#include "../include/cookedformat.hpp"
+#include "../include/meshpool.hpp"
+
+struct CookedMeshLoad
+{
+    std::string filename;
+    std::string err;
+    AssetFile   file;
+
+    // Apontam para dentro de "file"
+    const CookedMeshHeader* header;
+    const CookedShape*      shapes;
+    const CookedVertex*     vertices;
+    const uint32_t*         indices;
+};
+
+CookedMeshLoad* CookedMesh_Read(const char* filename)
+{
+    CookedMeshLoad* load = new CookedMeshLoad();
+    load->filename = filename;
+    load->header   = NULL;
+
+    if (!Asset_Load(filename, &load->file))
+    {
+        load->err = "ERROR: Cannot open file \"" + load->filename + "\".";
+        return load;
+    }
+
+    const CookedMeshHeader* header = (const CookedMeshHeader*)load->file.data;
+    if (load->file.size < sizeof(CookedMeshHeader)
+        || header->magic != COOKED_MESH_MAGIC
+        || header->version != COOKED_VERSION)
+    {
+        load->err = "ERROR: Invalid cooked mesh \"" + load->filename + "\".";
+        return load;
+    }
+
+    size_t expected = sizeof(CookedMeshHeader)
+                    + (size_t)header->num_shapes   * sizeof(CookedShape)
+                    + (size_t)header->num_vertices * sizeof(CookedVertex)
+                    + (size_t)header->num_indices  * sizeof(uint32_t);
+    if (load->file.size != expected)
+    {
+        load->err = "ERROR: Truncated cooked mesh \"" + load->filename + "\".";
+        return load;
+    }
+
+    // Faixas das partes e índices devem ficar dentro dos buffers, já que
+    // vão direto para glDrawElements sem nenhuma outra verificação
+    const CookedShape*  shapes   = (const CookedShape*)(header + 1);
+    const CookedVertex* vertices = (const CookedVertex*)(shapes + header->num_shapes);
+    const uint32_t*     indices  = (const uint32_t*)(vertices + header->num_vertices);
+    bool valid = true;
+    for (uint32_t i = 0; valid && i < header->num_shapes; ++i)
+        valid = shapes[i].first_index <= header->num_indices
+             && shapes[i].num_indices <= header->num_indices - shapes[i].first_index;
+    for (uint32_t i = 0; valid && i < header->num_indices; ++i)
+        valid = indices[i] < header->num_vertices;
+    if (!valid)
+    {
+        load->err = "ERROR: Invalid cooked mesh \"" + load->filename + "\".";
+        return load;
+    }
+
+    load->header   = header;
+    load->shapes   = shapes;
+    load->vertices = vertices;
+    load->indices  = indices;
+    return load;
+}
+
+void CookedMesh_Upload(CookedMeshLoad* load, StreamedMesh* mesh)
+{
+    if (load->header == NULL)
+    {
+        fprintf(stderr, "\n%s\n", load->err.c_str());
+        delete load;
+        throw std::runtime_error("Erro ao carregar modelo.");
+    }
+
+    const CookedMeshHeader* header = load->header;
+
+    // Os dados vêm direto do arquivo (ou da memória mapeada do pacote de
+    // assets) para os buffers compartilhados (veja "meshpool.hpp").
+    MeshAllocation allocation = MeshPool_Upload(MESH_FORMAT_COOKED, load->vertices, header->num_vertices, load->indices, header->num_indices);
+    mesh->vertex_array_object_id = allocation.vertex_array_object_id;
+    mesh->base_vertex            = allocation.base_vertex;
+
+    mesh->shapes.clear();
+    for (uint32_t i = 0; i < header->num_shapes; ++i)
+    {
+        StreamedShape shape;
+        shape.name        = std::string(load->shapes[i].name, strnlen(load->shapes[i].name, sizeof(load->shapes[i].name)));
+        shape.first_index = allocation.first_index + load->shapes[i].first_index;
+        shape.num_indices = load->shapes[i].num_indices;
+        mesh->shapes.push_back(shape);
+    }
+
+    printf("Modelo \"%s\" carregado (%d vértices).\n", load->filename.c_str(), (int)header->num_vertices);
+    delete load;
+}
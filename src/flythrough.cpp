@@ -0,0 +1,152 @@
+#include "../include/flythrough.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+#include "../include/constants.hpp"
+#include "../include/simulation.hpp"
+#include "../include/frametime.hpp"
+
+// Pontos de controle do caminho dos carros (x, z), um "oito" que passa perto
+// das paredes, dos gols e do centro do campo
+static const float g_CarPath[][2] = {
+    { -40.0f, -50.0f }, {   0.0f, -20.0f }, {  40.0f, -50.0f }, {  45.0f,   0.0f },
+    {  40.0f,  50.0f }, {   0.0f,  20.0f }, { -40.0f,  50.0f }, { -45.0f,   0.0f },
+};
+static const int g_CarPathSize = sizeof(g_CarPath) / sizeof(g_CarPath[0]);
+
+#define FLYTHROUGH_LAPS        2     // Voltas completas dos carros
+#define FLYTHROUGH_BALL_RADIUS 15.0f // Raio do círculo percorrido pela bola
+
+// Modos de câmera, em ordem, para cada terço da execução
+enum FlythroughCamera
+{
+    CAMERA_CHASE,
+    CAMERA_LOOK_AT_BALL,
+    CAMERA_LOOK_BACK
+};
+
+static const FlythroughCamera g_PurpleCameras[3] = { CAMERA_CHASE, CAMERA_LOOK_AT_BALL, CAMERA_LOOK_BACK };
+static const FlythroughCamera g_OrangeCameras[3] = { CAMERA_LOOK_AT_BALL, CAMERA_LOOK_BACK, CAMERA_CHASE };
+
+static bool     g_FlythroughActive     = false;
+static int      g_FlythroughFrames     = 0;
+static int      g_FlythroughFrame      = 0;
+static uint64_t g_FlythroughDrawCalls  = 0;
+static int      g_FlythroughMeasured   = 0;
+
+void Flythrough_Start(int num_frames)
+{
+    g_FlythroughActive    = true;
+    g_FlythroughFrames    = num_frames;
+    g_FlythroughFrame     = 0;
+    g_FlythroughDrawCalls = 0;
+    g_FlythroughMeasured  = 0;
+
+    printf("Flythrough: %d quadros (+%d de aquecimento).\n", num_frames, FLYTHROUGH_WARMUP_FRAMES);
+}
+
+bool Flythrough_IsActive()
+{
+    return g_FlythroughActive;
+}
+
+// Ponto e tangente da spline Catmull-Rom fechada, com t em [0, 1)
+static void EvaluateCarPath(float t, glm::vec4* position, glm::vec4* tangent)
+{
+    float u = (t - std::floor(t)) * g_CarPathSize;
+    int   i = (int)u;
+    float f = u - i;
+
+    const float* p0 = g_CarPath[(i + g_CarPathSize - 1) % g_CarPathSize];
+    const float* p1 = g_CarPath[i % g_CarPathSize];
+    const float* p2 = g_CarPath[(i + 1) % g_CarPathSize];
+    const float* p3 = g_CarPath[(i + 2) % g_CarPathSize];
+
+    float f2 = f * f;
+    float f3 = f2 * f;
+    float xz[2], dxz[2];
+    for (int k = 0; k < 2; ++k)
+    {
+        xz[k] = 0.5f * ((2 * p1[k]) + (-p0[k] + p2[k]) * f + (2 * p0[k] - 5 * p1[k] + 4 * p2[k] - p3[k]) * f2 + (-p0[k] + 3 * p1[k] - 3 * p2[k] + p3[k]) * f3);
+        dxz[k] = 0.5f * ((-p0[k] + p2[k]) + 2 * (2 * p0[k] - 5 * p1[k] + 4 * p2[k] - p3[k]) * f + 3 * (-p0[k] + 3 * p1[k] - 3 * p2[k] + p3[k]) * f2);
+    }
+
+    float length = std::sqrt(dxz[0] * dxz[0] + dxz[1] * dxz[1]);
+    *position = glm::vec4(xz[0], CAR_HEIGHT / 2, xz[1], 1);
+    *tangent  = glm::vec4(dxz[0] / length, 0, dxz[1] / length, 0);
+}
+
+static void SetCamera(FlythroughCamera camera, GLboolean* looking_at_ball, GLboolean* looking_back)
+{
+    *looking_at_ball = camera == CAMERA_LOOK_AT_BALL;
+    *looking_back    = camera == CAMERA_LOOK_BACK;
+}
+
+bool Flythrough_Update()
+{
+    if (!g_FlythroughActive)
+        return true;
+
+    int total = FLYTHROUGH_WARMUP_FRAMES + g_FlythroughFrames;
+    if (g_FlythroughFrame >= total)
+        return false;
+
+    // As medidas começam após o aquecimento (carregamento de texturas,
+    // compilação de shaders pelo driver, ...)
+    if (g_FlythroughFrame == FLYTHROUGH_WARMUP_FRAMES)
+    {
+        FrameTime_Reset();
+        g_FlythroughDrawCalls = 0;
+        g_FlythroughMeasured  = 0;
+    }
+
+    // Posição ao longo do caminho depende só do número do quadro, nunca do
+    // tempo, para que a carga seja sempre a mesma
+    float t = (float)g_FlythroughFrame / total;
+
+    EvaluateCarPath(t * FLYTHROUGH_LAPS, &purple_car_position, &purple_car_direction);
+    EvaluateCarPath(t * FLYTHROUGH_LAPS + 0.5f, &orange_car_position, &orange_car_direction);
+    purple_car_direction_angle = atan2(-purple_car_direction.x, -purple_car_direction.z);
+    orange_car_direction_angle = atan2(-orange_car_direction.x, -orange_car_direction.z);
+
+    float ball_angle = 2 * PI * t * 3;
+    ball_position = glm::vec4(FLYTHROUGH_BALL_RADIUS * std::cos(ball_angle), BALL_RADIUS, FLYTHROUGH_BALL_RADIUS * std::sin(ball_angle), 1);
+
+    int third = g_FlythroughFrame * 3 / total;
+    SetCamera(g_PurpleCameras[third], &is_purple_car_looking_at_ball, &is_purple_camera_looking_back);
+    SetCamera(g_OrangeCameras[third], &is_orange_car_looking_at_ball, &is_orange_camera_looking_back);
+
+    return true;
+}
+
+void Flythrough_EndFrame(unsigned int draw_calls)
+{
+    if (!g_FlythroughActive)
+        return;
+
+    if (g_FlythroughFrame >= FLYTHROUGH_WARMUP_FRAMES)
+    {
+        g_FlythroughDrawCalls += draw_calls;
+        g_FlythroughMeasured++;
+    }
+    g_FlythroughFrame++;
+}
+
+void Flythrough_PrintReport()
+{
+    if (!g_FlythroughActive)
+        return;
+
+    FrameTimeReport cpu, gpu;
+    FrameTime_GetReport(FRAME_TIME_CPU, &cpu);
+    FrameTime_GetReport(FRAME_TIME_GPU, &gpu);
+
+    printf("Flythrough: %d quadros medidos\n", g_FlythroughMeasured);
+    printf("  quadro (ms): p50 %.2f  p95 %.2f  p99 %.2f  max %.2f  acima do orçamento %llu\n",
+           cpu.p50_ms, cpu.p95_ms, cpu.p99_ms, cpu.max_ms, (unsigned long long)cpu.over_budget);
+    printf("  GPU (ms):    p50 %.2f  p95 %.2f  p99 %.2f  max %.2f\n",
+           gpu.p50_ms, gpu.p95_ms, gpu.p99_ms, gpu.max_ms);
+    printf("  chamadas de desenho por quadro: %.1f\n",
+           g_FlythroughMeasured > 0 ? (double)g_FlythroughDrawCalls / g_FlythroughMeasured : 0.0);
+}
@@ -0,0 +1,284 @@
+#include "../include/frametime.hpp"
+
+#include <cstdio>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "../include/glad/glad.h"
+#include "../include/GLFW/glfw3.h"
+
+#include "../include/utils.h"
+#include "../include/gpuprogram.hpp"
+
+// Funções definidas em textrendering.cpp
+void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_id);
+float TextRendering_LineHeight(GLFWwindow* window);
+int  TextRendering_CreateText();
+void TextRendering_SetText(int text_id, const std::string &str, float x, float y, float scale = 1.0f);
+void TextRendering_DrawText(int text_id);
+
+#define FRAME_TIME_NUM_BUCKETS ((int)(FRAME_TIME_MAX_MS / FRAME_TIME_BUCKET_MS) + 1)
+
+// Histograma e últimos quadros de uma série. Todos os campos são atômicos:
+// FrameTime_Record() pode ser chamada por várias threads ao mesmo tempo que
+// o gráfico é desenhado.
+struct FrameTimeHistogram
+{
+    std::atomic<uint32_t> buckets[FRAME_TIME_NUM_BUCKETS];
+    std::atomic<uint64_t> frames;
+    std::atomic<uint64_t> over_budget;
+    std::atomic<uint64_t> max_us;
+
+    std::atomic<uint32_t> recent_us[FRAME_TIME_GRAPH_FRAMES];
+    std::atomic<uint32_t> recent_next;
+};
+
+// Variáveis estáticas são zeradas antes de qualquer uso
+static FrameTimeHistogram g_FrameTimes[FRAME_TIME_NUM_SERIES];
+
+static const char* const g_SeriesNames[FRAME_TIME_NUM_SERIES] = { "CPU", "GPU" };
+
+static bool           g_ShowGraph         = false;
+static GpuVertexArray g_GraphVAO;
+static GpuBuffer      g_GraphVBO;
+static GpuProgram     g_GraphProgram;
+static GLint          g_GraphColorUniform = -1;
+static int            g_GraphTexts[FRAME_TIME_NUM_SERIES];
+
+const GLchar* const graphvertexshader_source = ""
+"#version 330\n"
+"layout (location = 0) in vec2 position;\n"
+"void main()\n"
+"{\n"
+    "gl_Position = vec4(position, 0, 1);\n"
+"}\n"
+"\0";
+
+const GLchar* const graphfragmentshader_source = ""
+"#version 330\n"
+"uniform vec4 color;\n"
+"out vec4 fragColor;\n"
+"void main()\n"
+"{\n"
+    "fragColor = color;\n"
+"}\n"
+"\0";
+
+void FrameTime_Init()
+{
+    GLuint vertex_shader_id = glCreateShader(GL_VERTEX_SHADER);
+    TextRendering_LoadShader(graphvertexshader_source, vertex_shader_id);
+
+    GLuint fragment_shader_id = glCreateShader(GL_FRAGMENT_SHADER);
+    TextRendering_LoadShader(graphfragmentshader_source, fragment_shader_id);
+
+    g_GraphProgram = CreateTrackedGpuProgram("frametime graph", vertex_shader_id, fragment_shader_id);
+    g_GraphColorUniform = glGetUniformLocation(g_GraphProgram.Get(), "color");
+    glCheckError();
+
+    g_GraphVAO.Create("frametime graph");
+    g_GraphVBO.Create("frametime graph");
+    glBindVertexArray(g_GraphVAO.Get());
+    glBindBuffer(GL_ARRAY_BUFFER, g_GraphVBO.Get());
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glCheckError();
+
+    for (int i = 0; i < FRAME_TIME_NUM_SERIES; ++i)
+        g_GraphTexts[i] = TextRendering_CreateText();
+}
+
+void FrameTime_Shutdown()
+{
+    g_GraphVAO.Reset();
+    g_GraphVBO.Reset();
+    g_GraphProgram.Reset();
+}
+
+void FrameTime_Record(FrameTimeSeries series, double milliseconds)
+{
+    FrameTimeHistogram& histogram = g_FrameTimes[series];
+
+    if (milliseconds < 0.0)
+        milliseconds = 0.0;
+
+    int bucket = (int)(milliseconds / FRAME_TIME_BUCKET_MS);
+    if (bucket >= FRAME_TIME_NUM_BUCKETS)
+        bucket = FRAME_TIME_NUM_BUCKETS - 1;
+
+    uint64_t us = (uint64_t)(milliseconds * 1000.0);
+
+    histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    histogram.frames.fetch_add(1, std::memory_order_relaxed);
+    if (milliseconds > FRAME_TIME_BUDGET_MS)
+        histogram.over_budget.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t max_us = histogram.max_us.load(std::memory_order_relaxed);
+    while (us > max_us && !histogram.max_us.compare_exchange_weak(max_us, us, std::memory_order_relaxed))
+        ;
+
+    uint32_t slot = histogram.recent_next.fetch_add(1, std::memory_order_relaxed) % FRAME_TIME_GRAPH_FRAMES;
+    histogram.recent_us[slot].store(us > 0xFFFFFFFFu ? 0xFFFFFFFFu : (uint32_t)us, std::memory_order_relaxed);
+}
+
+// Limite superior do balde que contém a fração "p" dos quadros
+static double Percentile(const FrameTimeHistogram& histogram, uint64_t frames, double p)
+{
+    uint64_t target = (uint64_t)(p * frames + 0.5);
+    if (target == 0)
+        target = 1;
+
+    uint64_t count = 0;
+    for (int i = 0; i < FRAME_TIME_NUM_BUCKETS; ++i)
+    {
+        count += histogram.buckets[i].load(std::memory_order_relaxed);
+        if (count >= target)
+            return (i + 1) * FRAME_TIME_BUCKET_MS;
+    }
+    return FRAME_TIME_MAX_MS;
+}
+
+void FrameTime_GetReport(FrameTimeSeries series, FrameTimeReport* report)
+{
+    const FrameTimeHistogram& histogram = g_FrameTimes[series];
+
+    report->frames      = histogram.frames.load(std::memory_order_relaxed);
+    report->over_budget = histogram.over_budget.load(std::memory_order_relaxed);
+    report->max_ms      = histogram.max_us.load(std::memory_order_relaxed) / 1000.0;
+    report->p50_ms = report->p95_ms = report->p99_ms = 0.0;
+
+    if (report->frames == 0)
+        return;
+
+    report->p50_ms = Percentile(histogram, report->frames, 0.50);
+    report->p95_ms = Percentile(histogram, report->frames, 0.95);
+    report->p99_ms = Percentile(histogram, report->frames, 0.99);
+
+    // O percentil é o limite do balde; não reportamos mais que o máximo real
+    if (report->p50_ms > report->max_ms) report->p50_ms = report->max_ms;
+    if (report->p95_ms > report->max_ms) report->p95_ms = report->max_ms;
+    if (report->p99_ms > report->max_ms) report->p99_ms = report->max_ms;
+}
+
+void FrameTime_Reset()
+{
+    for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+    {
+        FrameTimeHistogram& histogram = g_FrameTimes[s];
+        for (int i = 0; i < FRAME_TIME_NUM_BUCKETS; ++i)
+            histogram.buckets[i].store(0, std::memory_order_relaxed);
+        histogram.frames.store(0, std::memory_order_relaxed);
+        histogram.over_budget.store(0, std::memory_order_relaxed);
+        histogram.max_us.store(0, std::memory_order_relaxed);
+    }
+}
+
+void FrameTime_ToggleGraph()
+{
+    g_ShowGraph = !g_ShowGraph;
+}
+
+static std::string FormatReport(FrameTimeSeries series)
+{
+    FrameTimeReport report;
+    FrameTime_GetReport(series, &report);
+
+    char buffer[160];
+    snprintf(buffer, sizeof(buffer), "%s p50 %.1f  p95 %.1f  p99 %.1f  max %.1f ms  (%llu de %llu acima de %.1f ms)",
+             g_SeriesNames[series], report.p50_ms, report.p95_ms, report.p99_ms, report.max_ms,
+             (unsigned long long)report.over_budget, (unsigned long long)report.frames, FRAME_TIME_BUDGET_MS);
+    return buffer;
+}
+
+void FrameTime_DrawGraph(GLFWwindow* window)
+{
+    if (!g_ShowGraph || !g_GraphProgram.IsValid())
+        return;
+
+    // Área do gráfico, em NDC da viewport atual. O eixo vertical vai de 0 a
+    // duas vezes o orçamento do quadro.
+    const float left   = -0.95f;
+    const float right  =  0.95f;
+    const float bottom = -0.95f;
+    const float top    = -0.55f;
+    const double scale_ms = 2.0 * FRAME_TIME_BUDGET_MS;
+
+    // Linha do orçamento seguida de uma linha para cada série, do quadro mais
+    // antigo para o mais recente
+    float budget_y = bottom + (top - bottom) * (float)(FRAME_TIME_BUDGET_MS / scale_ms);
+    std::vector<float> vertices;
+    vertices.reserve(2 * (2 + FRAME_TIME_NUM_SERIES * FRAME_TIME_GRAPH_FRAMES));
+    vertices.push_back(left);  vertices.push_back(budget_y);
+    vertices.push_back(right); vertices.push_back(budget_y);
+
+    for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+    {
+        const FrameTimeHistogram& histogram = g_FrameTimes[s];
+        uint32_t next = histogram.recent_next.load(std::memory_order_relaxed);
+        for (int i = 0; i < FRAME_TIME_GRAPH_FRAMES; ++i)
+        {
+            uint32_t us = histogram.recent_us[(next + i) % FRAME_TIME_GRAPH_FRAMES].load(std::memory_order_relaxed);
+            double t = us / 1000.0 / scale_ms;
+            if (t > 1.0)
+                t = 1.0;
+            vertices.push_back(left + (right - left) * i / (FRAME_TIME_GRAPH_FRAMES - 1));
+            vertices.push_back(bottom + (top - bottom) * (float)t);
+        }
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, g_GraphVBO.Get());
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STREAM_DRAW);
+    g_GraphVBO.SetSize(vertices.size() * sizeof(float));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    static const float colors[1 + FRAME_TIME_NUM_SERIES][4] = {
+        { 0.8f, 0.0f, 0.0f, 1.0f }, // Orçamento
+        { 0.9f, 0.5f, 0.0f, 1.0f }, // CPU
+        { 0.1f, 0.2f, 0.8f, 1.0f }, // GPU
+    };
+
+    glDepthFunc(GL_ALWAYS);
+    glUseProgram(g_GraphProgram.Get());
+    glBindVertexArray(g_GraphVAO.Get());
+
+    glUniform4fv(g_GraphColorUniform, 1, colors[0]);
+    glDrawArrays(GL_LINES, 0, 2);
+    for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+    {
+        glUniform4fv(g_GraphColorUniform, 1, colors[1 + s]);
+        glDrawArrays(GL_LINE_STRIP, 2 + s * FRAME_TIME_GRAPH_FRAMES, FRAME_TIME_GRAPH_FRAMES);
+    }
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glDepthFunc(GL_LESS);
+
+    // Percentis acima do gráfico. O texto é refeito apenas algumas vezes por
+    // segundo, para não refazer o layout a cada quadro.
+    static double last_update = 0.0;
+    static std::string reports[FRAME_TIME_NUM_SERIES];
+    double now = glfwGetTime();
+    if (now - last_update > 0.25)
+    {
+        last_update = now;
+        for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+            reports[s] = FormatReport((FrameTimeSeries)s);
+    }
+
+    float lineheight = TextRendering_LineHeight(window);
+    for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+    {
+        TextRendering_SetText(g_GraphTexts[s], reports[s], left, top + (FRAME_TIME_NUM_SERIES - s) * lineheight, 1.0f);
+        TextRendering_DrawText(g_GraphTexts[s]);
+    }
+}
+
+void FrameTime_PrintReport()
+{
+    printf("Tempos de quadro:\n");
+    for (int s = 0; s < FRAME_TIME_NUM_SERIES; ++s)
+        printf("  %s\n", FormatReport((FrameTimeSeries)s).c_str());
+}
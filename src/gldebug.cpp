@@ -0,0 +1,139 @@
+#include "../include/gldebug.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include "../include/glad/glad.h"
+#include "../include/GLFW/glfw3.h"
+
+// A GLAD deste projeto foi gerada apenas para OpenGL 3.3 core, sem as
+// extensões de depuração: definimos aqui o que falta
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS       0x8242
+#define GL_DEBUG_SOURCE_API               0x8246
+#define GL_DEBUG_SOURCE_WINDOW_SYSTEM     0x8247
+#define GL_DEBUG_SOURCE_SHADER_COMPILER   0x8248
+#define GL_DEBUG_SOURCE_THIRD_PARTY       0x8249
+#define GL_DEBUG_SOURCE_APPLICATION       0x824A
+#define GL_DEBUG_TYPE_ERROR               0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR  0x824E
+#define GL_DEBUG_TYPE_PORTABILITY         0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE         0x8250
+#define GL_DEBUG_SEVERITY_NOTIFICATION    0x826B
+#define GL_DEBUG_SEVERITY_HIGH            0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM          0x9147
+#define GL_DEBUG_SEVERITY_LOW             0x9148
+#define GL_DEBUG_OUTPUT                   0x92E0
+#define GL_CONTEXT_FLAG_DEBUG_BIT         0x00000002
+#endif
+
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECALLBACKPROC)(GLDEBUGPROC callback, const void* userParam);
+typedef void (APIENTRYP PFNGLDEBUGMESSAGECONTROLPROC)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled);
+
+// O callback pode ser chamado por threads do driver
+static std::mutex              g_DebugMutex;
+static std::map<GLuint, int>   g_DebugRepeats; // Vezes que cada mensagem foi impressa
+
+static const char* SourceName(GLenum source)
+{
+    switch (source)
+    {
+        case GL_DEBUG_SOURCE_API:             return "API";
+        case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "window system";
+        case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+        case GL_DEBUG_SOURCE_THIRD_PARTY:     return "third party";
+        case GL_DEBUG_SOURCE_APPLICATION:     return "application";
+        default:                              return "other";
+    }
+}
+
+static const char* TypeName(GLenum type)
+{
+    switch (type)
+    {
+        case GL_DEBUG_TYPE_ERROR:               return "error";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "undefined behavior";
+        case GL_DEBUG_TYPE_PORTABILITY:         return "portability";
+        case GL_DEBUG_TYPE_PERFORMANCE:         return "performance";
+        default:                                return "other";
+    }
+}
+
+static void APIENTRY DebugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* user_param)
+{
+    (void)length;
+    (void)user_param;
+
+    // Alguns drivers ignoram glDebugMessageControl()
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION)
+        return;
+
+    std::lock_guard<std::mutex> lock(g_DebugMutex);
+    int& repeats = g_DebugRepeats[id];
+    if (repeats >= GLDEBUG_MAX_REPEATS)
+        return;
+    repeats++;
+
+    const char* severity_name = severity == GL_DEBUG_SEVERITY_HIGH   ? "high"
+                              : severity == GL_DEBUG_SEVERITY_MEDIUM ? "medium"
+                              : "low";
+    const char* prefix = type == GL_DEBUG_TYPE_ERROR ? "ERROR" : "WARNING";
+
+    fprintf(stderr, "%s: OpenGL %s (%s, %s, id %u): %s\n", prefix, TypeName(type), SourceName(source), severity_name, id, message);
+    if (repeats == GLDEBUG_MAX_REPEATS)
+        fprintf(stderr, "%s: OpenGL message %u repeated too often; ignoring further occurrences.\n", prefix, id);
+}
+
+void GlDebug_RequestContext()
+{
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+}
+
+bool GlDebug_Init()
+{
+    // KHR_debug (núcleo a partir do OpenGL 4.3) ou sua antecessora. As
+    // constantes usadas abaixo têm os mesmos valores nas duas.
+    PFNGLDEBUGMESSAGECALLBACKPROC debug_message_callback = NULL;
+    PFNGLDEBUGMESSAGECONTROLPROC  debug_message_control  = NULL;
+    const char* extension = NULL;
+    if (glfwExtensionSupported("GL_KHR_debug"))
+    {
+        debug_message_callback = (PFNGLDEBUGMESSAGECALLBACKPROC)glfwGetProcAddress("glDebugMessageCallback");
+        debug_message_control  = (PFNGLDEBUGMESSAGECONTROLPROC)glfwGetProcAddress("glDebugMessageControl");
+        extension = "KHR_debug";
+    }
+    else if (glfwExtensionSupported("GL_ARB_debug_output"))
+    {
+        debug_message_callback = (PFNGLDEBUGMESSAGECALLBACKPROC)glfwGetProcAddress("glDebugMessageCallbackARB");
+        debug_message_control  = (PFNGLDEBUGMESSAGECONTROLPROC)glfwGetProcAddress("glDebugMessageControlARB");
+        extension = "ARB_debug_output";
+    }
+
+    if (debug_message_callback == NULL || debug_message_control == NULL)
+    {
+        printf("Mensagens de depuração OpenGL indisponíveis.\n");
+        return false;
+    }
+
+    // GL_DEBUG_OUTPUT já vem habilitado em contextos de depuração, mas não
+    // nos demais; ARB_debug_output não tem essa opção
+    if (strcmp(extension, "KHR_debug") == 0)
+        glEnable(GL_DEBUG_OUTPUT);
+
+#ifdef GL_ERROR_POLLING
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+#endif
+
+    debug_message_callback(DebugMessageCallback, NULL);
+    debug_message_control(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+    debug_message_control(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+
+    GLint flags = 0;
+    glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+    printf("Mensagens de depuração OpenGL: %s%s.\n", extension, (flags & GL_CONTEXT_FLAG_DEBUG_BIT) ? ", contexto de depuração" : "");
+    return true;
+}
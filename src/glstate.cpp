@@ -0,0 +1,391 @@
+#include "../include/glstate.hpp"
+
+#include "../include/glad/glad.h"
+
+#define GLSTATE_UNKNOWN           0xFFFFFFFFu
+#define GLSTATE_MAX_TEXTURE_UNITS 32
+
+// Alvos de glBindBuffer() guardados no cache
+static const GLenum g_BufferTargets[] = {
+    GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER,
+    GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, GL_UNIFORM_BUFFER, GL_TEXTURE_BUFFER,
+};
+#define GLSTATE_NUM_BUFFER_TARGETS (int)(sizeof(g_BufferTargets) / sizeof(g_BufferTargets[0]))
+
+// Capacidades de glEnable()/glDisable() guardadas no cache
+static const GLenum g_Capabilities[] = { GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST };
+#define GLSTATE_NUM_CAPABILITIES (int)(sizeof(g_Capabilities) / sizeof(g_Capabilities[0]))
+
+// Todos os campos valem GLSTATE_UNKNOWN enquanto o estado for desconhecido
+struct GlStateCache
+{
+    GLuint program;
+    GLuint vertex_array;
+    GLuint buffers[GLSTATE_NUM_BUFFER_TARGETS];
+    GLuint draw_framebuffer;
+    GLuint read_framebuffer;
+    GLuint active_texture; // Índice da unidade
+    GLuint textures_2d[GLSTATE_MAX_TEXTURE_UNITS];
+    GLuint samplers[GLSTATE_MAX_TEXTURE_UNITS];
+    GLuint capabilities[GLSTATE_NUM_CAPABILITIES];
+    GLuint blend_src;
+    GLuint blend_dst;
+    GLuint depth_func;
+    GLuint depth_mask;
+    GLuint polygon_mode;
+    GLuint cull_face;
+    GLuint front_face;
+    GLuint viewport_known;
+    GLint  viewport[4];
+};
+
+static GlStateCache g_State;
+static bool         g_StateInstalled = false;
+
+// Funções interceptadas: o ponteiro anterior (do driver, ou de "glstats.cpp")
+// fica em g_Next_NOME
+#define GLSTATE_FUNCTIONS(X)                      \
+    X(UseProgram, USEPROGRAM)                     \
+    X(BindVertexArray, BINDVERTEXARRAY)           \
+    X(BindBuffer, BINDBUFFER)                     \
+    X(BindBufferBase, BINDBUFFERBASE)             \
+    X(BindBufferRange, BINDBUFFERRANGE)           \
+    X(BindFramebuffer, BINDFRAMEBUFFER)           \
+    X(ActiveTexture, ACTIVETEXTURE)               \
+    X(BindTexture, BINDTEXTURE)                   \
+    X(BindSampler, BINDSAMPLER)                   \
+    X(Enable, ENABLE)                             \
+    X(Disable, DISABLE)                           \
+    X(BlendFunc, BLENDFUNC)                       \
+    X(DepthFunc, DEPTHFUNC)                       \
+    X(DepthMask, DEPTHMASK)                       \
+    X(PolygonMode, POLYGONMODE)                   \
+    X(CullFace, CULLFACE)                         \
+    X(FrontFace, FRONTFACE)                       \
+    X(Viewport, VIEWPORT)                         \
+    X(DeleteProgram, DELETEPROGRAM)               \
+    X(DeleteVertexArrays, DELETEVERTEXARRAYS)     \
+    X(DeleteBuffers, DELETEBUFFERS)               \
+    X(DeleteFramebuffers, DELETEFRAMEBUFFERS)     \
+    X(DeleteTextures, DELETETEXTURES)             \
+    X(DeleteSamplers, DELETESAMPLERS)
+
+#define GLSTATE_DECLARE_NEXT(name, NAME) static PFNGL##NAME##PROC g_Next_##NAME = NULL;
+GLSTATE_FUNCTIONS(GLSTATE_DECLARE_NEXT)
+
+static int BufferTargetIndex(GLenum target)
+{
+    for (int i = 0; i < GLSTATE_NUM_BUFFER_TARGETS; ++i)
+        if (g_BufferTargets[i] == target)
+            return i;
+    return -1;
+}
+
+static int CapabilityIndex(GLenum cap)
+{
+    for (int i = 0; i < GLSTATE_NUM_CAPABILITIES; ++i)
+        if (g_Capabilities[i] == cap)
+            return i;
+    return -1;
+}
+
+static void APIENTRY Hook_UseProgram(GLuint program)
+{
+    if (g_State.program == program)
+        return;
+    g_State.program = program;
+    g_Next_USEPROGRAM(program);
+}
+
+static void APIENTRY Hook_BindVertexArray(GLuint array)
+{
+    if (g_State.vertex_array == array)
+        return;
+    g_State.vertex_array = array;
+    g_Next_BINDVERTEXARRAY(array);
+
+    // O GL_ELEMENT_ARRAY_BUFFER faz parte do estado do VAO
+    g_State.buffers[BufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = GLSTATE_UNKNOWN;
+}
+
+static void APIENTRY Hook_BindBuffer(GLenum target, GLuint buffer)
+{
+    int index = BufferTargetIndex(target);
+    if (index >= 0)
+    {
+        if (g_State.buffers[index] == buffer)
+            return;
+        g_State.buffers[index] = buffer;
+    }
+    g_Next_BINDBUFFER(target, buffer);
+}
+
+// Também mudam a ligação genérica do alvo, como glBindBuffer()
+static void APIENTRY Hook_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    int target_index = BufferTargetIndex(target);
+    if (target_index >= 0)
+        g_State.buffers[target_index] = buffer;
+    g_Next_BINDBUFFERBASE(target, index, buffer);
+}
+
+static void APIENTRY Hook_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    int target_index = BufferTargetIndex(target);
+    if (target_index >= 0)
+        g_State.buffers[target_index] = buffer;
+    g_Next_BINDBUFFERRANGE(target, index, buffer, offset, size);
+}
+
+static void APIENTRY Hook_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+    bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+    if ((!draw || g_State.draw_framebuffer == framebuffer) && (!read || g_State.read_framebuffer == framebuffer))
+        return;
+
+    if (draw)
+        g_State.draw_framebuffer = framebuffer;
+    if (read)
+        g_State.read_framebuffer = framebuffer;
+    g_Next_BINDFRAMEBUFFER(target, framebuffer);
+}
+
+static void APIENTRY Hook_ActiveTexture(GLenum texture)
+{
+    GLuint unit = texture - GL_TEXTURE0;
+    if (g_State.active_texture == unit)
+        return;
+    g_State.active_texture = unit < GLSTATE_MAX_TEXTURE_UNITS ? unit : GLSTATE_UNKNOWN;
+    g_Next_ACTIVETEXTURE(texture);
+}
+
+static void APIENTRY Hook_BindTexture(GLenum target, GLuint texture)
+{
+    GLuint unit = g_State.active_texture;
+    if (target == GL_TEXTURE_2D && unit != GLSTATE_UNKNOWN)
+    {
+        if (g_State.textures_2d[unit] == texture)
+            return;
+        g_State.textures_2d[unit] = texture;
+    }
+    g_Next_BINDTEXTURE(target, texture);
+}
+
+static void APIENTRY Hook_BindSampler(GLuint unit, GLuint sampler)
+{
+    if (unit < GLSTATE_MAX_TEXTURE_UNITS)
+    {
+        if (g_State.samplers[unit] == sampler)
+            return;
+        g_State.samplers[unit] = sampler;
+    }
+    g_Next_BINDSAMPLER(unit, sampler);
+}
+
+static void APIENTRY Hook_Enable(GLenum cap)
+{
+    int index = CapabilityIndex(cap);
+    if (index >= 0)
+    {
+        if (g_State.capabilities[index] == GL_TRUE)
+            return;
+        g_State.capabilities[index] = GL_TRUE;
+    }
+    g_Next_ENABLE(cap);
+}
+
+static void APIENTRY Hook_Disable(GLenum cap)
+{
+    int index = CapabilityIndex(cap);
+    if (index >= 0)
+    {
+        if (g_State.capabilities[index] == GL_FALSE)
+            return;
+        g_State.capabilities[index] = GL_FALSE;
+    }
+    g_Next_DISABLE(cap);
+}
+
+static void APIENTRY Hook_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    if (g_State.blend_src == sfactor && g_State.blend_dst == dfactor)
+        return;
+    g_State.blend_src = sfactor;
+    g_State.blend_dst = dfactor;
+    g_Next_BLENDFUNC(sfactor, dfactor);
+}
+
+static void APIENTRY Hook_DepthFunc(GLenum func)
+{
+    if (g_State.depth_func == func)
+        return;
+    g_State.depth_func = func;
+    g_Next_DEPTHFUNC(func);
+}
+
+static void APIENTRY Hook_DepthMask(GLboolean flag)
+{
+    if (g_State.depth_mask == flag)
+        return;
+    g_State.depth_mask = flag;
+    g_Next_DEPTHMASK(flag);
+}
+
+static void APIENTRY Hook_PolygonMode(GLenum face, GLenum mode)
+{
+    // No perfil core só existe GL_FRONT_AND_BACK
+    if (face == GL_FRONT_AND_BACK)
+    {
+        if (g_State.polygon_mode == mode)
+            return;
+        g_State.polygon_mode = mode;
+    }
+    g_Next_POLYGONMODE(face, mode);
+}
+
+static void APIENTRY Hook_CullFace(GLenum mode)
+{
+    if (g_State.cull_face == mode)
+        return;
+    g_State.cull_face = mode;
+    g_Next_CULLFACE(mode);
+}
+
+static void APIENTRY Hook_FrontFace(GLenum mode)
+{
+    if (g_State.front_face == mode)
+        return;
+    g_State.front_face = mode;
+    g_Next_FRONTFACE(mode);
+}
+
+static void APIENTRY Hook_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    if (g_State.viewport_known == GL_TRUE && g_State.viewport[0] == x && g_State.viewport[1] == y
+        && g_State.viewport[2] == width && g_State.viewport[3] == height)
+        return;
+    g_State.viewport_known = GL_TRUE;
+    g_State.viewport[0] = x;
+    g_State.viewport[1] = y;
+    g_State.viewport[2] = width;
+    g_State.viewport[3] = height;
+    g_Next_VIEWPORT(x, y, width, height);
+}
+
+// Apagar um objeto ligado volta a ligação para 0. Um novo objeto poderia
+// receber o mesmo nome, e o cache o consideraria ligado sem estar.
+static void APIENTRY Hook_DeleteProgram(GLuint program)
+{
+    if (g_State.program == program)
+        g_State.program = GLSTATE_UNKNOWN;
+    g_Next_DELETEPROGRAM(program);
+}
+
+static void APIENTRY Hook_DeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        if (arrays[i] != 0 && g_State.vertex_array == arrays[i])
+        {
+            g_State.vertex_array = 0;
+            g_State.buffers[BufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = GLSTATE_UNKNOWN;
+        }
+    }
+    g_Next_DELETEVERTEXARRAYS(n, arrays);
+}
+
+static void APIENTRY Hook_DeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; ++i)
+        for (int j = 0; j < GLSTATE_NUM_BUFFER_TARGETS; ++j)
+            if (buffers[i] != 0 && g_State.buffers[j] == buffers[i])
+                g_State.buffers[j] = 0;
+    g_Next_DELETEBUFFERS(n, buffers);
+}
+
+static void APIENTRY Hook_DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+{
+    for (GLsizei i = 0; i < n; ++i)
+    {
+        if (framebuffers[i] == 0)
+            continue;
+        if (g_State.draw_framebuffer == framebuffers[i])
+            g_State.draw_framebuffer = 0;
+        if (g_State.read_framebuffer == framebuffers[i])
+            g_State.read_framebuffer = 0;
+    }
+    g_Next_DELETEFRAMEBUFFERS(n, framebuffers);
+}
+
+static void APIENTRY Hook_DeleteTextures(GLsizei n, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; ++i)
+        for (int unit = 0; unit < GLSTATE_MAX_TEXTURE_UNITS; ++unit)
+            if (textures[i] != 0 && g_State.textures_2d[unit] == textures[i])
+                g_State.textures_2d[unit] = 0;
+    g_Next_DELETETEXTURES(n, textures);
+}
+
+static void APIENTRY Hook_DeleteSamplers(GLsizei count, const GLuint* samplers)
+{
+    for (GLsizei i = 0; i < count; ++i)
+        for (int unit = 0; unit < GLSTATE_MAX_TEXTURE_UNITS; ++unit)
+            if (samplers[i] != 0 && g_State.samplers[unit] == samplers[i])
+                g_State.samplers[unit] = 0;
+    g_Next_DELETESAMPLERS(count, samplers);
+}
+
+#define GLSTATE_INSTALL(name, NAME)        \
+    if (glad_gl##name != NULL)             \
+    {                                      \
+        g_Next_##NAME = glad_gl##name;     \
+        glad_gl##name = Hook_##name;       \
+    }
+
+#define GLSTATE_UNINSTALL(name, NAME)      \
+    if (g_Next_##NAME != NULL)             \
+    {                                      \
+        glad_gl##name = g_Next_##NAME;     \
+        g_Next_##NAME = NULL;              \
+    }
+
+void GlState_Init()
+{
+    GlState_Invalidate();
+    GLSTATE_FUNCTIONS(GLSTATE_INSTALL)
+    g_StateInstalled = true;
+}
+
+void GlState_Shutdown()
+{
+    if (!g_StateInstalled)
+        return;
+
+    GLSTATE_FUNCTIONS(GLSTATE_UNINSTALL)
+    g_StateInstalled = false;
+}
+
+void GlState_Invalidate()
+{
+    g_State.program          = GLSTATE_UNKNOWN;
+    g_State.vertex_array     = GLSTATE_UNKNOWN;
+    g_State.draw_framebuffer = GLSTATE_UNKNOWN;
+    g_State.read_framebuffer = GLSTATE_UNKNOWN;
+    g_State.active_texture   = GLSTATE_UNKNOWN;
+    g_State.blend_src        = GLSTATE_UNKNOWN;
+    g_State.blend_dst        = GLSTATE_UNKNOWN;
+    g_State.depth_func       = GLSTATE_UNKNOWN;
+    g_State.depth_mask       = GLSTATE_UNKNOWN;
+    g_State.polygon_mode     = GLSTATE_UNKNOWN;
+    g_State.cull_face        = GLSTATE_UNKNOWN;
+    g_State.front_face       = GLSTATE_UNKNOWN;
+    g_State.viewport_known   = GLSTATE_UNKNOWN;
+
+    for (int i = 0; i < GLSTATE_NUM_BUFFER_TARGETS; ++i)
+        g_State.buffers[i] = GLSTATE_UNKNOWN;
+    for (int i = 0; i < GLSTATE_MAX_TEXTURE_UNITS; ++i)
+        g_State.textures_2d[i] = g_State.samplers[i] = GLSTATE_UNKNOWN;
+    for (int i = 0; i < GLSTATE_NUM_CAPABILITIES; ++i)
+        g_State.capabilities[i] = GLSTATE_UNKNOWN;
+}
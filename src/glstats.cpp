@@ -0,0 +1,332 @@
+#include "../include/glstats.hpp"
+
+#ifdef GLSTATS_ENABLED
+
+#include <cstring>
+
+#include "../include/glad/glad.h"
+
+// Todas as chamadas OpenGL são feitas na thread principal, então os
+// contadores não precisam ser atômicos
+static GlStatsCounters g_GlStatsFrame;
+static GlStatsCounters g_GlStatsLastFrame;
+static bool            g_GlStatsHasLastFrame = false;
+static uint64_t        g_GlStatsFrameNumber  = 0;
+static FILE*           g_GlStatsCsv          = NULL;
+
+// Bytes por pixel de uma imagem não comprimida
+static uint64_t PixelSize(GLenum format, GLenum type)
+{
+    uint64_t components;
+    switch (format)
+    {
+        case GL_RED: case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG:                           components = 2; break;
+        case GL_RGB: case GL_BGR:             components = 3; break;
+        default:                              components = 4; break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE: case GL_BYTE:   return components;
+        case GL_UNSIGNED_SHORT: case GL_SHORT:
+        case GL_HALF_FLOAT:                    return components * 2;
+        default:                               return components * 4;
+    }
+}
+
+// Funções interceptadas: para cada uma, o ponteiro original carregado pela
+// GLAD fica em g_Real_NOME, e Hook_Nome conta a chamada e a repassa
+#define GLSTATS_FUNCTIONS(X)                                           \
+    X(DrawArrays, DRAWARRAYS)                                          \
+    X(DrawElements, DRAWELEMENTS)                                      \
+    X(DrawArraysInstanced, DRAWARRAYSINSTANCED)                        \
+    X(DrawElementsInstanced, DRAWELEMENTSINSTANCED)                    \
+    X(DrawElementsBaseVertex, DRAWELEMENTSBASEVERTEX)                  \
+    X(DrawRangeElements, DRAWRANGEELEMENTS)                            \
+    X(MultiDrawArrays, MULTIDRAWARRAYS)                                \
+    X(MultiDrawElements, MULTIDRAWELEMENTS)                            \
+    X(MultiDrawElementsBaseVertex, MULTIDRAWELEMENTSBASEVERTEX)        \
+    X(Enable, ENABLE)                                                  \
+    X(Disable, DISABLE)                                                \
+    X(BlendFunc, BLENDFUNC)                                            \
+    X(DepthFunc, DEPTHFUNC)                                            \
+    X(DepthMask, DEPTHMASK)                                            \
+    X(PolygonMode, POLYGONMODE)                                        \
+    X(CullFace, CULLFACE)                                              \
+    X(FrontFace, FRONTFACE)                                            \
+    X(Viewport, VIEWPORT)                                              \
+    X(ActiveTexture, ACTIVETEXTURE)                                    \
+    X(BindFramebuffer, BINDFRAMEBUFFER)                                \
+    X(BindSampler, BINDSAMPLER)                                        \
+    X(UseProgram, USEPROGRAM)                                          \
+    X(BindVertexArray, BINDVERTEXARRAY)                                \
+    X(BindTexture, BINDTEXTURE)                                        \
+    X(BindBuffer, BINDBUFFER)                                          \
+    X(BufferData, BUFFERDATA)                                          \
+    X(BufferSubData, BUFFERSUBDATA)                                    \
+    X(TexImage2D, TEXIMAGE2D)                                          \
+    X(TexSubImage2D, TEXSUBIMAGE2D)                                    \
+    X(CompressedTexImage2D, COMPRESSEDTEXIMAGE2D)
+
+#define GLSTATS_DECLARE_REAL(name, NAME) static PFNGL##NAME##PROC g_Real_##NAME = NULL;
+GLSTATS_FUNCTIONS(GLSTATS_DECLARE_REAL)
+
+static void APIENTRY Hook_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWARRAYS(mode, first, count);
+}
+
+static void APIENTRY Hook_DrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWELEMENTS(mode, count, type, indices);
+}
+
+static void APIENTRY Hook_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWARRAYSINSTANCED(mode, first, count, instancecount);
+}
+
+static void APIENTRY Hook_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWELEMENTSINSTANCED(mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY Hook_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWELEMENTSBASEVERTEX(mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY Hook_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_DRAWRANGEELEMENTS(mode, start, end, count, type, indices);
+}
+
+// Uma chamada "multi" conta como uma só: é exatamente o custo de CPU que ela
+// economiza
+static void APIENTRY Hook_MultiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_MULTIDRAWARRAYS(mode, first, count, drawcount);
+}
+
+static void APIENTRY Hook_MultiDrawElements(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_MULTIDRAWELEMENTS(mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY Hook_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex)
+{
+    g_GlStatsFrame.draw_calls++;
+    g_Real_MULTIDRAWELEMENTSBASEVERTEX(mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY Hook_Enable(GLenum cap)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_ENABLE(cap);
+}
+
+static void APIENTRY Hook_Disable(GLenum cap)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_DISABLE(cap);
+}
+
+static void APIENTRY Hook_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_BLENDFUNC(sfactor, dfactor);
+}
+
+static void APIENTRY Hook_DepthFunc(GLenum func)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_DEPTHFUNC(func);
+}
+
+static void APIENTRY Hook_DepthMask(GLboolean flag)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_DEPTHMASK(flag);
+}
+
+static void APIENTRY Hook_PolygonMode(GLenum face, GLenum mode)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_POLYGONMODE(face, mode);
+}
+
+static void APIENTRY Hook_CullFace(GLenum mode)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_CULLFACE(mode);
+}
+
+static void APIENTRY Hook_FrontFace(GLenum mode)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_FRONTFACE(mode);
+}
+
+static void APIENTRY Hook_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_VIEWPORT(x, y, width, height);
+}
+
+static void APIENTRY Hook_ActiveTexture(GLenum texture)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_ACTIVETEXTURE(texture);
+}
+
+static void APIENTRY Hook_BindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_BINDFRAMEBUFFER(target, framebuffer);
+}
+
+static void APIENTRY Hook_BindSampler(GLuint unit, GLuint sampler)
+{
+    g_GlStatsFrame.state_changes++;
+    g_Real_BINDSAMPLER(unit, sampler);
+}
+
+static void APIENTRY Hook_UseProgram(GLuint program)
+{
+    g_GlStatsFrame.program_binds++;
+    g_Real_USEPROGRAM(program);
+}
+
+static void APIENTRY Hook_BindVertexArray(GLuint array)
+{
+    g_GlStatsFrame.vertex_array_binds++;
+    g_Real_BINDVERTEXARRAY(array);
+}
+
+static void APIENTRY Hook_BindTexture(GLenum target, GLuint texture)
+{
+    g_GlStatsFrame.texture_binds++;
+    g_Real_BINDTEXTURE(target, texture);
+}
+
+static void APIENTRY Hook_BindBuffer(GLenum target, GLuint buffer)
+{
+    g_GlStatsFrame.buffer_binds++;
+    g_Real_BINDBUFFER(target, buffer);
+}
+
+static void APIENTRY Hook_BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    if (data != NULL)
+        g_GlStatsFrame.upload_bytes += size;
+    g_Real_BUFFERDATA(target, size, data, usage);
+}
+
+static void APIENTRY Hook_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    g_GlStatsFrame.upload_bytes += size;
+    g_Real_BUFFERSUBDATA(target, offset, size, data);
+}
+
+static void APIENTRY Hook_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+{
+    if (pixels != NULL)
+        g_GlStatsFrame.upload_bytes += (uint64_t)width * height * PixelSize(format, type);
+    g_Real_TEXIMAGE2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY Hook_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+    g_GlStatsFrame.upload_bytes += (uint64_t)width * height * PixelSize(format, type);
+    g_Real_TEXSUBIMAGE2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY Hook_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data)
+{
+    g_GlStatsFrame.upload_bytes += imageSize;
+    g_Real_COMPRESSEDTEXIMAGE2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+// Troca glad_glFoo por Hook_Foo, guardando o original. Funções que o driver
+// não oferece (ponteiro nulo) continuam nulas.
+#define GLSTATS_INSTALL(name, NAME)        \
+    if (glad_gl##name != NULL)             \
+    {                                      \
+        g_Real_##NAME = glad_gl##name;     \
+        glad_gl##name = Hook_##name;       \
+    }
+
+#define GLSTATS_UNINSTALL(name, NAME)      \
+    if (g_Real_##NAME != NULL)             \
+    {                                      \
+        glad_gl##name = g_Real_##NAME;     \
+        g_Real_##NAME = NULL;              \
+    }
+
+void GlStats_Init()
+{
+    memset(&g_GlStatsFrame, 0, sizeof(g_GlStatsFrame));
+    GLSTATS_FUNCTIONS(GLSTATS_INSTALL)
+}
+
+void GlStats_Shutdown()
+{
+    GLSTATS_FUNCTIONS(GLSTATS_UNINSTALL)
+
+    if (g_GlStatsCsv != NULL)
+        fclose(g_GlStatsCsv);
+    g_GlStatsCsv = NULL;
+}
+
+void GlStats_BeginFrame()
+{
+    memset(&g_GlStatsFrame, 0, sizeof(g_GlStatsFrame));
+}
+
+void GlStats_EndFrame()
+{
+    g_GlStatsLastFrame    = g_GlStatsFrame;
+    g_GlStatsHasLastFrame = true;
+
+    if (g_GlStatsCsv != NULL)
+    {
+        const GlStatsCounters& c = g_GlStatsLastFrame;
+        fprintf(g_GlStatsCsv, "%llu,%u,%u,%u,%u,%u,%u,%llu\n", (unsigned long long)g_GlStatsFrameNumber,
+                c.draw_calls, c.state_changes, c.program_binds, c.vertex_array_binds, c.texture_binds, c.buffer_binds,
+                (unsigned long long)c.upload_bytes);
+    }
+    g_GlStatsFrameNumber++;
+}
+
+bool GlStats_GetLastFrame(GlStatsCounters* counters)
+{
+    if (!g_GlStatsHasLastFrame)
+        return false;
+    *counters = g_GlStatsLastFrame;
+    return true;
+}
+
+bool GlStats_OpenCsv(const char* filename)
+{
+    g_GlStatsCsv = fopen(filename, "w");
+    if (g_GlStatsCsv == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+
+    fprintf(g_GlStatsCsv, "frame,draw_calls,state_changes,program_binds,vertex_array_binds,texture_binds,buffer_binds,upload_bytes\n");
+    printf("Gravando estatísticas OpenGL em \"%s\".\n", filename);
+    return true;
+}
+
+#endif // GLSTATS_ENABLED
@@ -0,0 +1,161 @@
+#include "../include/gpuresources.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+struct GpuResource
+{
+    std::string name;
+    size_t      bytes;
+};
+
+static const char* const g_TypeNames[GPU_NUM_RESOURCE_TYPES] =
+{
+    "buffer", "vertex array", "texture", "sampler", "program",
+    "framebuffer", "renderbuffer", "query", "fence"
+};
+
+// Chave: tipo nos 32 bits altos e ID nos baixos, pois IDs de tipos diferentes
+// podem coincidir
+static std::map<uint64_t, GpuResource> g_Resources;
+static std::map<GLsync, GpuResource>   g_Fences;
+static size_t g_Counts[GPU_NUM_RESOURCE_TYPES];
+static size_t g_Bytes[GPU_NUM_RESOURCE_TYPES];
+static bool   g_Closed = false;
+
+static uint64_t ResourceKey(GpuResourceType type, GLuint id)
+{
+    return ((uint64_t)type << 32) | id;
+}
+
+static double ToMiB(size_t bytes)
+{
+    return bytes / (1024.0 * 1024.0);
+}
+
+GLuint GpuResources_Create(GpuResourceType type, const char* name)
+{
+    GLuint id = 0;
+    switch (type)
+    {
+    case GPU_BUFFER:       glGenBuffers(1, &id);       break;
+    case GPU_VERTEX_ARRAY: glGenVertexArrays(1, &id);  break;
+    case GPU_TEXTURE:      glGenTextures(1, &id);      break;
+    case GPU_SAMPLER:      glGenSamplers(1, &id);      break;
+    case GPU_PROGRAM:      id = glCreateProgram();     break;
+    case GPU_FRAMEBUFFER:  glGenFramebuffers(1, &id);  break;
+    case GPU_RENDERBUFFER: glGenRenderbuffers(1, &id); break;
+    case GPU_QUERY:        glGenQueries(1, &id);       break;
+    default:               break;
+    }
+
+    if (id == 0)
+    {
+        fprintf(stderr, "ERROR: Cannot create GPU %s \"%s\".\n", g_TypeNames[type], name);
+        return 0;
+    }
+
+    GpuResource& resource = g_Resources[ResourceKey(type, id)];
+    resource.name  = name;
+    resource.bytes = 0;
+    g_Counts[type] += 1;
+    return id;
+}
+
+void GpuResources_Destroy(GpuResourceType type, GLuint id)
+{
+    if (g_Closed)
+        return;
+
+    switch (type)
+    {
+    case GPU_BUFFER:       glDeleteBuffers(1, &id);      break;
+    case GPU_VERTEX_ARRAY: glDeleteVertexArrays(1, &id); break;
+    case GPU_TEXTURE:      glDeleteTextures(1, &id);     break;
+    case GPU_SAMPLER:      glDeleteSamplers(1, &id);     break;
+    case GPU_PROGRAM:      glDeleteProgram(id);          break;
+    case GPU_FRAMEBUFFER:  glDeleteFramebuffers(1, &id);  break;
+    case GPU_RENDERBUFFER: glDeleteRenderbuffers(1, &id); break;
+    case GPU_QUERY:        glDeleteQueries(1, &id);       break;
+    default:               break;
+    }
+
+    std::map<uint64_t, GpuResource>::iterator it = g_Resources.find(ResourceKey(type, id));
+    if (it == g_Resources.end())
+        return;
+
+    g_Counts[type] -= 1;
+    g_Bytes[type]  -= it->second.bytes;
+    g_Resources.erase(it);
+}
+
+void GpuResources_SetSize(GpuResourceType type, GLuint id, size_t bytes)
+{
+    std::map<uint64_t, GpuResource>::iterator it = g_Resources.find(ResourceKey(type, id));
+    if (it == g_Resources.end())
+        return;
+
+    g_Bytes[type] = g_Bytes[type] - it->second.bytes + bytes;
+    it->second.bytes = bytes;
+}
+
+GLsync GpuResources_CreateFence(const char* name)
+{
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (fence == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create GPU %s \"%s\".\n", g_TypeNames[GPU_FENCE], name);
+        return NULL;
+    }
+
+    GpuResource& resource = g_Fences[fence];
+    resource.name  = name;
+    resource.bytes = 0;
+    g_Counts[GPU_FENCE] += 1;
+    return fence;
+}
+
+void GpuResources_DestroyFence(GLsync fence)
+{
+    if (g_Closed)
+        return;
+
+    glDeleteSync(fence);
+    if (g_Fences.erase(fence) > 0)
+        g_Counts[GPU_FENCE] -= 1;
+}
+
+size_t GpuResources_GetTotalBytes()
+{
+    size_t total = 0;
+    for (int i = 0; i < GPU_NUM_RESOURCE_TYPES; ++i)
+        total += g_Bytes[i];
+    return total;
+}
+
+void GpuResources_PrintSummary()
+{
+    printf("Recursos da GPU: %.2f MiB\n", ToMiB(GpuResources_GetTotalBytes()));
+    for (int i = 0; i < GPU_NUM_RESOURCE_TYPES; ++i)
+        printf("  %-12s %4d  %8.2f MiB\n", g_TypeNames[i], (int)g_Counts[i], ToMiB(g_Bytes[i]));
+}
+
+void GpuResources_Shutdown()
+{
+    if (g_Resources.empty() && g_Fences.empty())
+        printf("Todos os recursos da GPU foram liberados.\n");
+
+    for (std::map<uint64_t, GpuResource>::iterator it = g_Resources.begin(); it != g_Resources.end(); ++it)
+    {
+        GpuResourceType type = (GpuResourceType)(it->first >> 32);
+        GLuint          id   = (GLuint)(it->first & 0xFFFFFFFFu);
+        fprintf(stderr, "WARNING: GPU %s %u \"%s\" (%.2f MiB) was not released.\n",
+                g_TypeNames[type], id, it->second.name.c_str(), ToMiB(it->second.bytes));
+    }
+    for (std::map<GLsync, GpuResource>::iterator it = g_Fences.begin(); it != g_Fences.end(); ++it)
+        fprintf(stderr, "WARNING: GPU %s %p \"%s\" was not released.\n", g_TypeNames[GPU_FENCE], (void*)it->first, it->second.name.c_str());
+
+    g_Closed = true;
+}
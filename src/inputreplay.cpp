@@ -0,0 +1,177 @@
+#include "../include/inputreplay.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../include/archive.hpp"
+
+enum InputReplayMode
+{
+    INPUT_REPLAY_OFF,
+    INPUT_REPLAY_RECORDING,
+    INPUT_REPLAY_REPLAYING
+};
+
+static InputReplayMode          g_InputMode = INPUT_REPLAY_OFF;
+static std::string              g_InputFilename;
+static std::vector<InputChange> g_InputChanges;
+static uint32_t                 g_InputTick     = 0; // Próximo passo
+static uint32_t                 g_InputNumTicks = 0;
+static size_t                   g_InputNext     = 0; // Próxima mudança a reproduzir
+static SimulationInput          g_InputCurrent  = { 0, 0 };
+
+bool InputReplay_StartRecording(const char* filename)
+{
+    InputReplay_Stop();
+
+    // Verificamos já no início se o arquivo poderá ser escrito
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+    fclose(file);
+
+    g_InputMode     = INPUT_REPLAY_RECORDING;
+    g_InputFilename = filename;
+    g_InputChanges.clear();
+    g_InputTick     = 0;
+    g_InputCurrent.purple = g_InputCurrent.orange = 0;
+
+    printf("Gravando comandos em \"%s\".\n", filename);
+    return true;
+}
+
+bool InputReplay_StartReplay(const char* filename)
+{
+    InputReplay_Stop();
+
+    AssetFile file;
+    if (!Asset_Load(filename, &file))
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    InputFileHeader header;
+    bool valid = file.size >= sizeof(header);
+    if (valid)
+    {
+        memcpy(&header, file.data, sizeof(header));
+        valid = header.magic == INPUT_FILE_MAGIC
+             && header.version == INPUT_FILE_VERSION
+             && (file.size - sizeof(header)) / sizeof(InputChange) >= header.num_changes;
+    }
+    if (!valid)
+    {
+        fprintf(stderr, "ERROR: Invalid input recording \"%s\".\n", filename);
+        return false;
+    }
+    if (header.tick_rate != SIMULATION_TICK_RATE)
+    {
+        fprintf(stderr, "ERROR: Input recording \"%s\" uses %u ticks per second, expected %u.\n", filename, header.tick_rate, (unsigned)SIMULATION_TICK_RATE);
+        return false;
+    }
+
+    g_InputChanges.resize(header.num_changes);
+    if (header.num_changes > 0)
+        memcpy(g_InputChanges.data(), file.data + sizeof(header), header.num_changes * sizeof(InputChange));
+
+    g_InputMode     = INPUT_REPLAY_REPLAYING;
+    g_InputFilename = filename;
+    g_InputTick     = 0;
+    g_InputNumTicks = header.num_ticks;
+    g_InputNext     = 0;
+    g_InputCurrent.purple = g_InputCurrent.orange = 0;
+
+    printf("Reproduzindo \"%s\" (%u passos, %.1f segundos).\n", filename, header.num_ticks, header.num_ticks / (float)SIMULATION_TICK_RATE);
+    return true;
+}
+
+static bool WriteRecording()
+{
+    InputFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic       = INPUT_FILE_MAGIC;
+    header.version     = INPUT_FILE_VERSION;
+    header.tick_rate   = SIMULATION_TICK_RATE;
+    header.num_ticks   = g_InputTick;
+    header.num_changes = (uint32_t)g_InputChanges.size();
+
+    FILE* file = fopen(g_InputFilename.c_str(), "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", g_InputFilename.c_str());
+        return false;
+    }
+
+    fwrite(&header, sizeof(header), 1, file);
+    if (!g_InputChanges.empty())
+        fwrite(g_InputChanges.data(), sizeof(InputChange), g_InputChanges.size(), file);
+
+    bool ok = !ferror(file);
+    fclose(file);
+    if (!ok)
+    {
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", g_InputFilename.c_str());
+        return false;
+    }
+
+    printf("Gravação salva em \"%s\" (%u passos, %u mudanças).\n", g_InputFilename.c_str(), header.num_ticks, header.num_changes);
+    return true;
+}
+
+void InputReplay_Stop()
+{
+    if (g_InputMode == INPUT_REPLAY_RECORDING)
+        WriteRecording();
+
+    g_InputMode = INPUT_REPLAY_OFF;
+    g_InputChanges.clear();
+}
+
+bool InputReplay_IsRecording()
+{
+    return g_InputMode == INPUT_REPLAY_RECORDING;
+}
+
+bool InputReplay_IsReplaying()
+{
+    return g_InputMode == INPUT_REPLAY_REPLAYING;
+}
+
+bool InputReplay_Tick(SimulationInput* input)
+{
+    if (g_InputMode == INPUT_REPLAY_RECORDING)
+    {
+        if (input->purple != g_InputCurrent.purple || input->orange != g_InputCurrent.orange)
+        {
+            InputChange change;
+            memset(&change, 0, sizeof(change));
+            change.tick   = g_InputTick;
+            change.purple = input->purple;
+            change.orange = input->orange;
+            g_InputChanges.push_back(change);
+            g_InputCurrent = *input;
+        }
+        g_InputTick++;
+    }
+    else if (g_InputMode == INPUT_REPLAY_REPLAYING)
+    {
+        if (g_InputTick >= g_InputNumTicks)
+            return false;
+
+        while (g_InputNext < g_InputChanges.size() && g_InputChanges[g_InputNext].tick <= g_InputTick)
+        {
+            g_InputCurrent.purple = g_InputChanges[g_InputNext].purple;
+            g_InputCurrent.orange = g_InputChanges[g_InputNext].orange;
+            g_InputNext++;
+        }
+        *input = g_InputCurrent;
+        g_InputTick++;
+    }
+    return true;
+}
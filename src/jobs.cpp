@@ -0,0 +1,251 @@
+#include "../include/jobs.hpp"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <condition_variable>
+
+// Fila de uma thread auxiliar. A dona retira do fim; as demais roubam do
+// início.
+struct WorkerQueue
+{
+    std::mutex      mutex;
+    std::deque<Job> jobs;
+};
+
+static std::vector<std::unique_ptr<WorkerQueue>> g_WorkerQueues;
+static std::vector<std::thread>                  g_WorkerThreads;
+static std::atomic<int>                          g_WorkerQueued(0);    // Tarefas em todas as filas
+static std::atomic<unsigned int>                 g_WorkerNextQueue(0); // Distribuição das tarefas externas
+static std::atomic<bool>                         g_WorkersStop(false);
+
+// Índice da fila da thread atual, ou -1 fora das threads auxiliares
+static thread_local int t_WorkerIndex = -1;
+
+static std::deque<Job>          g_MainThreadQueue;
+static std::mutex               g_MainThreadMutex;
+static std::atomic<int>         g_MainThreadQueued(0);
+static std::thread::id          g_MainThreadId;
+
+// Threads auxiliares sem tarefas dormem em g_WorkerCondition; Jobs_Wait()
+// dorme em g_WaitCondition até surgir uma tarefa ou o grupo terminar
+static std::mutex               g_SleepMutex;
+static std::condition_variable  g_WorkerCondition;
+static std::condition_variable  g_WaitCondition;
+
+static void WakeWaiters()
+{
+    // O lock garante que quem está prestes a dormir veja a mudança
+    std::lock_guard<std::mutex> lock(g_SleepMutex);
+    g_WaitCondition.notify_all();
+}
+
+static Job CountedJob(Job job, JobCounter* counter)
+{
+    if (counter == NULL)
+        return job;
+
+    counter->count++;
+    return [job, counter]
+    {
+        job();
+        if (--counter->count == 0)
+            WakeWaiters();
+    };
+}
+
+// Retira a tarefa mais recente da fila "own" (se não for -1) ou rouba a mais
+// antiga de outra fila
+static bool PopWorkerJob(int own, Job* job)
+{
+    int num_queues = (int)g_WorkerQueues.size();
+    if (own >= 0)
+    {
+        WorkerQueue& queue = *g_WorkerQueues[own];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            *job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            g_WorkerQueued--;
+            return true;
+        }
+    }
+
+    // Começamos pela fila seguinte, para que as vítimas variem
+    int start = own >= 0 ? own + 1 : 0;
+    for (int i = 0; i < num_queues; ++i)
+    {
+        int victim = (start + i) % num_queues;
+        if (victim == own)
+            continue;
+
+        WorkerQueue& queue = *g_WorkerQueues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            *job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            g_WorkerQueued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool PopMainThreadJob(Job* job)
+{
+    std::lock_guard<std::mutex> lock(g_MainThreadMutex);
+    if (g_MainThreadQueue.empty())
+        return false;
+    *job = std::move(g_MainThreadQueue.front());
+    g_MainThreadQueue.pop_front();
+    g_MainThreadQueued--;
+    return true;
+}
+
+static void WorkerLoop(int index)
+{
+    t_WorkerIndex = index;
+    for (;;)
+    {
+        Job job;
+        if (PopWorkerJob(index, &job))
+        {
+            job();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(g_SleepMutex);
+        g_WorkerCondition.wait(lock, [] { return g_WorkersStop || g_WorkerQueued > 0; });
+        if (g_WorkersStop)
+            return;
+    }
+}
+
+void Jobs_Init(unsigned int num_threads)
+{
+    // Deixamos um núcleo para a thread principal. hardware_concurrency() pode
+    // retornar 0 quando o número de núcleos é desconhecido.
+    if (num_threads == 0)
+    {
+        unsigned int hardware_threads = std::thread::hardware_concurrency();
+        num_threads = hardware_threads > 1 ? hardware_threads - 1 : 1;
+    }
+
+    g_MainThreadId = std::this_thread::get_id();
+    g_WorkersStop = false;
+    for (unsigned int i = 0; i < num_threads; ++i)
+        g_WorkerQueues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue));
+    for (unsigned int i = 0; i < num_threads; ++i)
+        g_WorkerThreads.push_back(std::thread(WorkerLoop, (int)i));
+}
+
+void Jobs_Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_SleepMutex);
+        g_WorkersStop = true;
+    }
+    g_WorkerCondition.notify_all();
+
+    for (size_t i = 0; i < g_WorkerThreads.size(); ++i)
+        g_WorkerThreads[i].join();
+    g_WorkerThreads.clear();
+    g_WorkerQueues.clear();
+    g_WorkerQueued = 0;
+}
+
+void Jobs_Submit(Job job, JobCounter* counter)
+{
+    // Sem threads auxiliares (antes de Jobs_Init() ou depois de
+    // Jobs_Shutdown()), a tarefa executa aqui mesmo
+    if (g_WorkerQueues.empty())
+    {
+        CountedJob(std::move(job), counter)();
+        return;
+    }
+
+    int index = t_WorkerIndex;
+    if (index < 0)
+        index = (int)(g_WorkerNextQueue++ % g_WorkerQueues.size());
+
+    WorkerQueue& queue = *g_WorkerQueues[index];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(CountedJob(std::move(job), counter));
+    }
+    g_WorkerQueued++;
+
+    {
+        std::lock_guard<std::mutex> lock(g_SleepMutex);
+        g_WorkerCondition.notify_one();
+        g_WaitCondition.notify_all();
+    }
+}
+
+void Jobs_SubmitMainThread(Job job, JobCounter* counter)
+{
+    {
+        std::lock_guard<std::mutex> lock(g_MainThreadMutex);
+        g_MainThreadQueue.push_back(CountedJob(std::move(job), counter));
+    }
+    g_MainThreadQueued++;
+    WakeWaiters();
+}
+
+int Jobs_RunMainThread(int max_jobs)
+{
+    int executed = 0;
+    Job job;
+    while ((max_jobs < 0 || executed < max_jobs) && PopMainThreadJob(&job))
+    {
+        job();
+        executed += 1;
+    }
+    return executed;
+}
+
+void Jobs_Wait(JobCounter* counter)
+{
+    bool is_main_thread = std::this_thread::get_id() == g_MainThreadId;
+    while (counter->count > 0)
+    {
+        Job job;
+        if ((is_main_thread && PopMainThreadJob(&job)) || PopWorkerJob(t_WorkerIndex, &job))
+        {
+            job();
+            continue;
+        }
+
+        // Nada a executar: as tarefas restantes estão em andamento em outras
+        // threads
+        std::unique_lock<std::mutex> lock(g_SleepMutex);
+        g_WaitCondition.wait(lock, [counter, is_main_thread]
+        {
+            return counter->count == 0 || g_WorkerQueued > 0 || (is_main_thread && g_MainThreadQueued > 0);
+        });
+    }
+}
+
+void Jobs_ParallelFor(int count, int batch_size, const std::function<void(int begin, int end)>& body)
+{
+    batch_size = std::max(1, batch_size);
+
+    // "body" vive até o fim desta função, que só retorna depois de todas as
+    // tarefas
+    JobCounter counter;
+    for (int begin = batch_size; begin < count; begin += batch_size)
+    {
+        int end = std::min(count, begin + batch_size);
+        Jobs_Submit([&body, begin, end] { body(begin, end); }, &counter);
+    }
+
+    // O primeiro intervalo executa aqui mesmo
+    if (count > 0)
+        body(0, std::min(count, batch_size));
+    Jobs_Wait(&counter);
+}
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 // Headers abaixo são específicos de C++
 #include <map>
@@ -30,6 +31,8 @@
 #include <stdexcept>
 #include <algorithm>
 #include <iostream>
+#include <atomic>
+#include <memory>
 
 // Headers das bibliotecas OpenGL
 #include "../include/glad/glad.h"   // Criação de contexto OpenGL 3.3
@@ -50,6 +53,26 @@
 
 #include "../include/constants.hpp"
 #include "../include/collisions.hpp"
+#include "../include/objstream.hpp"
+#include "../include/normals.hpp"
+#include "../include/textureloader.hpp"
+#include "../include/jobs.hpp"
+#include "../include/archive.hpp"
+#include "../include/cookedmesh.hpp"
+#include "../include/meshpool.hpp"
+#include "../include/gpuresources.hpp"
+#include "../include/gpuprogram.hpp"
+#include "../include/profiler.hpp"
+#include "../include/frametime.hpp"
+#include "../include/simulation.hpp"
+#include "../include/simthread.hpp"
+#include "../include/inputreplay.hpp"
+#include "../include/flythrough.hpp"
+#include "../include/capture.hpp"
+#include "../include/regression.hpp"
+#include "../include/glstats.hpp"
+#include "../include/glstate.hpp"
+#include "../include/gldebug.hpp"
 
 // Estrutura que representa um modelo geométrico carregado a partir de um
 // arquivo ".obj". Veja https://en.wikipedia.org/wiki/Wavefront_.obj_file .
@@ -65,8 +88,21 @@ struct ObjModel
     {
         printf("Carregando modelo \"%s\"... ", filename);
 
+        // O arquivo vem do pacote de assets, se este estiver aberto, ou do
+        // disco. Veja "archive.cpp".
         std::string err;
-        bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err, filename, basepath, triangulate);
+        bool ret = false;
+        AssetFile file;
+        if (Asset_Load(filename, &file))
+        {
+            AssetStream stream(file);
+            tinyobj::MaterialFileReader material_reader(basepath ? basepath : "");
+            ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err, &stream, &material_reader, triangulate);
+        }
+        else
+        {
+            err = "Cannot open file [" + std::string(filename) + "]";
+        }
 
         if (!err.empty())
             fprintf(stderr, "\n%s\n", err.c_str());
@@ -86,21 +122,39 @@ void PopMatrix(glm::mat4& M);
 // Declaração de várias funções utilizadas em main().  Essas estão definidas
 // logo após a definição de main() neste arquivo.
 void BuildTrianglesAndAddToVirtualScene(ObjModel*); // Constrói representação de um ObjModel como malha de triângulos para renderização
+void AddStreamedMeshToVirtualScene(const StreamedMesh& mesh); // Adiciona os shapes de um ".obj" carregado diretamente para a GPU
+bool LoadAssetsInParallel(); // Carrega shaders, texturas e modelos utilizando as threads auxiliares
+bool LoadExtraModels(); // Carrega os modelos ".obj" passados como argumento
+void ReloadAssets(); // Recarrega shaders, texturas e modelos, substituindo os atuais
+const char* CookedAssetPath(const char* cooked, const char* source); // Escolhe entre um asset pré-processado e o original
 void ComputeNormals(ObjModel* model); // Computa normais de um ObjModel, caso não existam.
 void LoadShadersFromFiles(); // Carrega os shaders de vértice e fragmento, criando um programa de GPU
 void DrawVirtualObject(const char* object_name); // Desenha um objeto armazenado em g_VirtualScene
+void BuildStaticRenderQueue(); // Coloca o chão e as paredes na fila de desenho
+void BuildDynamicRenderQueue(const SimulationSnapshot& state); // Coloca a bola e os carros do quadro atual na fila de desenho
+void DrawRenderQueue(); // Desenha todos os objetos da fila de desenho
 GLuint LoadShader_Vertex(const char* filename);   // Carrega um vertex shader
 GLuint LoadShader_Fragment(const char* filename); // Carrega um fragment shader
 void LoadShader(const char* filename, GLuint shader_id); // Função utilizada pelas duas acima
-GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Cria um programa de GPU
+bool ReadShaderFile(const char* filename, std::string* source); // Lê o código GLSL de um arquivo
+void CompileShader(const char* filename, const std::string& source, GLuint shader_id); // Compila código GLSL já lido
+void BuildGpuProgramFromSources(const std::string& vertex_source, const std::string& fragment_source); // Cria o programa de GPU principal
 void PrintObjModelInfo(ObjModel*); // Função para debugging
 
 // Declaração de funções auxiliares para renderizar texto dentro da janela
 // OpenGL. Estas funções estão definidas no arquivo "textrendering.cpp".
 void TextRendering_Init();
+void TextRendering_Shutdown();
 float TextRendering_LineHeight(GLFWwindow* window);
 float TextRendering_CharWidth(GLFWwindow* window);
 void TextRendering_PrintString(GLFWwindow* window, const std::string &str, float x, float y, float scale = 1.0f);
+void TextRendering_Flush(GLFWwindow* window);
+
+// Textos retidos: o layout é feito uma vez e refeito somente quando a string
+// ou a posição mudam. TextRendering_DrawText() apenas agenda o desenho.
+int  TextRendering_CreateText();
+void TextRendering_SetText(int text_id, const std::string &str, float x, float y, float scale = 1.0f);
+void TextRendering_DrawText(int text_id);
 void TextRendering_PrintMatrix(GLFWwindow* window, glm::mat4 M, float x, float y, float scale = 1.0f);
 void TextRendering_PrintVector(GLFWwindow* window, glm::vec4 v, float x, float y, float scale = 1.0f);
 void TextRendering_PrintMatrixVectorProduct(GLFWwindow* window, glm::mat4 M, glm::vec4 v, float x, float y, float scale = 1.0f);
@@ -118,8 +172,6 @@ void TextRendering_ShowFramesPerSecond(GLFWwindow* window);
 void ErrorCallback(int error, const char* description);
 void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mode);
 
-void LoadTextureImage(const char* filename);
-
 // Definimos uma estrutura que armazenará dados necessários para renderizar
 // cada objeto da cena virtual.
 struct SceneObject
@@ -128,7 +180,8 @@ struct SceneObject
     size_t       first_index; // Índice do primeiro vértice dentro do vetor indices[] definido em BuildTrianglesAndAddToVirtualScene()
     size_t       num_indices; // Número de índices do objeto dentro do vetor indices[] definido em BuildTrianglesAndAddToVirtualScene()
     GLenum       rendering_mode; // Modo de rasterização (GL_TRIANGLES, GL_TRIANGLE_STRIP, etc.)
-    GLuint       vertex_array_object_id; // ID do VAO onde estão armazenados os atributos do modelo
+    GLuint       vertex_array_object_id; // ID do VAO compartilhado onde estão armazenados os atributos do modelo (veja "meshpool.hpp")
+    GLint        base_vertex; // Primeiro vértice do modelo dentro do buffer de vértices compartilhado
 };
 
 // Abaixo definimos variáveis globais utilizadas em várias funções do código.
@@ -139,6 +192,32 @@ struct SceneObject
 // estes são acessados.
 std::map<std::string, SceneObject> g_VirtualScene;
 
+// Tipos de objeto, passados ao shader de fragmentos em "object_id"
+#define BALL 0
+#define FLOOR 1
+#define WALL 2
+#define PURPLE_CAR 3
+#define ORANGE_CAR 4
+
+// Comando de desenho de um objeto da cena. A matriz de modelagem e o objeto
+// de g_VirtualScene são calculados uma vez por quadro, e o mesmo comando é
+// repetido em cada viewport, que troca apenas as matrizes "view" e
+// "projection".
+struct RenderCommand
+{
+    glm::mat4          model;
+    GLint              object_id;
+    const SceneObject* object;
+};
+
+// Fila de desenho da cena. Os primeiros g_NumStaticRenderCommands comandos
+// (chão e paredes) não mudam durante a partida, e são montados uma só vez.
+std::vector<RenderCommand> g_RenderQueue;
+size_t g_NumStaticRenderCommands = 0;
+
+void DrawSceneObject(const SceneObject& object); // Desenha um objeto de g_VirtualScene já encontrado
+void AddToRenderQueue(const char* object_name, glm::mat4 model, GLint object_id); // Adiciona um objeto à fila de desenho
+
 // Pilha que guardará as matrizes de modelagem.
 std::stack<glm::mat4>  g_MatrixStack;
 
@@ -157,7 +236,7 @@ bool g_ShowInfoText = true;
 // Variáveis que definem um programa de GPU (shaders). Veja função LoadShadersFromFiles().
 GLuint vertex_shader_id;
 GLuint fragment_shader_id;
-GLuint program_id = 0;
+GpuProgram g_GpuProgram;
 GLint model_uniform;
 GLint view_uniform;
 GLint projection_uniform;
@@ -165,53 +244,82 @@ GLint object_id_uniform;
 
 GLuint g_NumLoadedTextures = 0;
 
- // Variaveis de posição
-glm::vec4 purple_car_position;
-glm::vec4 orange_car_position;
-glm::vec4 ball_position;
+// Modelos ".obj" extras passados como argumento. Veja LoadExtraModels().
+std::vector<const char*> g_ExtraModelFilenames;
 
-// Variaveis de velocidade
-glm::vec4 purple_car_speed = ZERO;
-glm::vec4 orange_car_speed = ZERO;
-glm::vec4 ball_speed = ZERO;
+// Verdadeiro durante ReloadAssets(). Veja CookedAssetPath().
+bool g_ReloadingAssets = false;
 
-// Inicialização da direção dos carros
-glm::vec4 purple_car_direction = NORTH;
-glm::vec4 orange_car_direction = SOUTH;
-
-GLfloat purple_car_direction_angle;
-GLfloat orange_car_direction_angle;
-
- 
-GLboolean is_purple_car_looking_at_ball = false;
-GLboolean is_orange_car_looking_at_ball = false;
+// Chamadas de desenho da cena no quadro atual. Veja DrawSceneObject().
+unsigned int g_NumDrawCalls = 0;
 
 // Declaração e inicialização das variaveis de tempo
 GLfloat last_frame_time;
 GLfloat current_frame_time = glfwGetTime();
 GLfloat time_between_frames;
 
-GLboolean is_purple_car_moving_left = false;
-GLboolean is_purple_car_moving_right = false;
-GLboolean is_purple_car_moving_front = false;
-GLboolean is_purple_car_moving_back = false;
-GLboolean is_purple_camera_looking_back = false;
-
-GLboolean is_orange_car_moving_left = false;
-GLboolean is_orange_car_moving_right = false;
-GLboolean is_orange_car_moving_front = false;
-GLboolean is_orange_car_moving_back = false;
-GLboolean is_orange_camera_looking_back = false;
-
-GLboolean is_ball_returning = false;
-GLfloat ball_returning_progress;
-glm::vec4 ball_returning_point_1;
-glm::vec4 ball_returning_point_2;
-glm::vec4 ball_returning_point_3;
-glm::vec4 ball_returning_point_4;
-
 int main(int argc, char* argv[])
 {
+    // Argumentos: "--record arquivo" grava os comandos da partida, "--replay
+    // arquivo" reproduz uma gravação no lugar do teclado, "--flythrough
+    // [quadros]" executa o benchmark de renderização (veja "flythrough.hpp")
+    // e "--capture saída" grava os quadros sem janela visível (veja
+    // "capture.hpp"). "--regression pasta" compara cenas fixas com imagens de
+    // referência, e "--regression-update pasta" as recria (veja
+    // "regression.hpp"). "--glstats arquivo.csv" grava os contadores de
+    // chamadas OpenGL de cada quadro (veja "glstats.hpp"), e "--no-glstate"
+    // desliga o cache de estado OpenGL (veja "glstate.hpp"), para comparação.
+    // Qualquer outro argumento é um modelo ".obj" extra.
+    const char* record_filename      = NULL;
+    const char* replay_filename      = NULL;
+    const char* capture_filename     = NULL;
+    const char* regression_directory = NULL;
+    bool        regression_update    = false;
+    const char* glstats_filename     = NULL;
+    bool        glstate_enabled      = true;
+    int flythrough_frames = 0;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            record_filename = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            replay_filename = argv[++i];
+        else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc)
+            capture_filename = argv[++i];
+        else if (strcmp(argv[i], "--glstats") == 0 && i + 1 < argc)
+            glstats_filename = argv[++i];
+        else if (strcmp(argv[i], "--no-glstate") == 0)
+            glstate_enabled = false;
+        else if (strcmp(argv[i], "--regression") == 0 && i + 1 < argc)
+            regression_directory = argv[++i];
+        else if (strcmp(argv[i], "--regression-update") == 0 && i + 1 < argc)
+        {
+            regression_directory = argv[++i];
+            regression_update = true;
+        }
+        else if (strcmp(argv[i], "--flythrough") == 0)
+        {
+            flythrough_frames = FLYTHROUGH_DEFAULT_FRAMES;
+            if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9')
+                flythrough_frames = std::max(1, atoi(argv[++i]));
+        }
+        else
+            g_ExtraModelFilenames.push_back(argv[i]);
+    }
+
+    // Sem janela visível, ninguém pode controlar os carros nem fechar o jogo:
+    // a captura precisa de uma gravação ou do benchmark, que terminam sozinhos
+    if (capture_filename != NULL && replay_filename == NULL && flythrough_frames == 0)
+    {
+        fprintf(stderr, "ERROR: --capture requires --replay or --flythrough.\n");
+        std::exit(EXIT_FAILURE);
+    }
+    if (regression_directory != NULL && (capture_filename != NULL || replay_filename != NULL || flythrough_frames > 0))
+    {
+        fprintf(stderr, "ERROR: --regression cannot be combined with --capture, --replay or --flythrough.\n");
+        std::exit(EXIT_FAILURE);
+    }
+
     // Inicializamos a biblioteca GLFW, utilizada para criar uma janela do
     // sistema operacional, onde poderemos renderizar com OpenGL.
     int success = glfwInit();
@@ -236,10 +344,23 @@ int main(int argc, char* argv[])
     // funções modernas de OpenGL.
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+    // Pedimos um contexto de depuração, onde o driver reporta erros e avisos
+    // de desempenho por um callback. Veja "gldebug.hpp".
+    GlDebug_RequestContext();
+
     // Criamos uma janela do sistema operacional, com 800 colunas e 600 linhas
     // de pixels, e com título "INF01047 ...".
+    // No benchmark e na captura a janela não ocupa o monitor, para que
+    // possam rodar sem supervisão (inclusive com llvmpipe, sem GPU). Na
+    // captura e na regressão a janela fica escondida: os quadros são
+    // desenhados fora da tela.
+    bool offscreen  = capture_filename != NULL || regression_directory != NULL;
+    bool unattended = flythrough_frames > 0 || offscreen;
+    if (offscreen)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
     GLFWwindow* window;
-    window = glfwCreateWindow(1920, 1080, "Carritos", glfwGetPrimaryMonitor(), NULL);
+    window = glfwCreateWindow(1920, 1080, "Carritos", unattended ? NULL : glfwGetPrimaryMonitor(), NULL);
     g_ScreenRatio = 1920.0f / 1080.0f / 2;
     if (!window)
     {
@@ -255,10 +376,29 @@ int main(int argc, char* argv[])
     // Indicamos que as chamadas OpenGL deverão renderizar nesta janela
     glfwMakeContextCurrent(window);
 
+    // O benchmark mede quão rápido os quadros são desenhados, e a captura
+    // gera quadros o mais rápido possível, então não esperamos pela
+    // sincronização vertical
+    if (unattended)
+        glfwSwapInterval(0);
+
     // Carregamento de todas funções definidas por OpenGL 3.3, utilizando a
     // biblioteca GLAD.
     gladLoadGLLoader((GLADloadproc) glfwGetProcAddress);
 
+    // Erros e avisos do driver, sem consultas a glGetError()
+    GlDebug_Init();
+
+    // Contadores de chamadas OpenGL, apenas em builds com -DGLSTATS_ENABLED
+    GlStats_Init();
+    if (glstats_filename != NULL && !GlStats_OpenCsv(glstats_filename))
+        std::exit(EXIT_FAILURE);
+
+    // Cache de estado OpenGL. Instalado depois dos contadores, que assim
+    // contam apenas as chamadas que chegam ao driver.
+    if (glstate_enabled)
+        GlState_Init();
+
     // Imprimimos no terminal informações sobre a GPU do sistema
     const GLubyte *vendor      = glGetString(GL_VENDOR);
     const GLubyte *renderer    = glGetString(GL_RENDERER);
@@ -267,36 +407,53 @@ int main(int argc, char* argv[])
 
     printf("GPU: %s, %s, OpenGL %s, GLSL %s\n", vendor, renderer, glversion, glslversion);
 
-    // Carregamos os shaders de vértices e de fragmentos que serão utilizados
-    // para renderização. Veja slides 176-196 do documento Aula_03_Rendering_Pipeline_Grafico.pdf.
-    //
-    LoadShadersFromFiles();
-
-    LoadTextureImage("../../data/grass.jpg");
-    LoadTextureImage("../../data/wall.jpg");
+    // Iniciamos as threads auxiliares, utilizadas para leitura de arquivos e
+    // decodificação de imagens. Veja "jobs.cpp".
+    Jobs_Init();
 
-    // Construímos a representação de objetos geométricos através de malhas de triângulos
-    ObjModel spheremodel("../../data/sphere.obj");
-    ComputeNormals(&spheremodel);
-    BuildTrianglesAndAddToVirtualScene(&spheremodel);
+    // Abrimos o pacote de assets gerado por "tools/packer.cpp", se existir.
+    // Os carregadores leem diretamente da memória mapeada; na sua ausência,
+    // os arquivos soltos em "data/" e "src/" são utilizados.
+    if (!Archive_Open("../../assets.pak"))
+        printf("Pacote de assets não encontrado; lendo arquivos soltos.\n");
 
-    ObjModel planemodel("../../data/plane.obj");
-    ComputeNormals(&planemodel);
-    BuildTrianglesAndAddToVirtualScene(&planemodel);
+    // Textura provisória, usada enquanto as imagens carregam
+    TextureLoader_Init();
 
-    ObjModel carritomodel("../../data/carrito.obj");
-    ComputeNormals(&carritomodel);
-    BuildTrianglesAndAddToVirtualScene(&carritomodel);
+    // Carregamos os shaders, as texturas e os modelos. Veja slides 176-196 do
+    // documento Aula_03_Rendering_Pipeline_Grafico.pdf.
+    if (!LoadAssetsInParallel() || !LoadExtraModels())
+        std::exit(EXIT_FAILURE);
+    GpuResources_PrintSummary();
 
-    if (argc > 1)
-    {
-        ObjModel model(argv[1]);
-        BuildTrianglesAndAddToVirtualScene(&model);
-    }
+    if (record_filename != NULL && !InputReplay_StartRecording(record_filename))
+        std::exit(EXIT_FAILURE);
+    if (replay_filename != NULL && !InputReplay_StartReplay(replay_filename))
+        std::exit(EXIT_FAILURE);
 
     // Inicializamos o código para renderização de texto.
     TextRendering_Init();
 
+    // Inicializamos o profiler (consultas de tempo da GPU). Veja "profiler.cpp".
+    Profiler_Init();
+
+    // Inicializamos o registro de tempos de quadro. Veja "frametime.cpp".
+    FrameTime_Init();
+
+    if (flythrough_frames > 0)
+        Flythrough_Start(flythrough_frames);
+
+    // Framebuffer fora da tela e leitura assíncrona dos quadros
+    if (offscreen && !Capture_Init(1920, 1080, capture_filename, CAPTURE_FRAME_RATE))
+        std::exit(EXIT_FAILURE);
+
+    // Na regressão o texto é omitido, pois o FPS mudaria as imagens
+    if (regression_directory != NULL)
+    {
+        g_ShowInfoText = false;
+        Regression_Start(regression_directory, regression_update);
+    }
+
     // Habilitamos o Z-buffer. Veja slides 104-116 do documento Aula_09_Projecoes.pdf.
     glEnable(GL_DEPTH_TEST);
 
@@ -311,573 +468,440 @@ int main(int argc, char* argv[])
     glm::mat4 the_model;
     glm::mat4 the_view;
 
+    // O chão e as paredes entram na fila de desenho uma só vez
+    BuildStaticRenderQueue();
+
     // Inicialização da posição da bola e dos carros
-    ball_position = glm::vec4(0, BALL_RADIUS, 0, 1); 
-    purple_car_position = glm::vec4(0, CAR_HEIGHT / 2, CAR_TO_BALL_INITIAL_DISTANCE, 1);
-    orange_car_position = glm::vec4(0, CAR_HEIGHT / 2, -CAR_TO_BALL_INITIAL_DISTANCE, 1);
+    Simulation_Reset();
+
+    // Na partida, a simulação executa em sua própria thread; no benchmark e
+    // na regressão ela fica parada, e na captura avança na thread principal
+    // exatamente um quadro de vídeo por vez. Veja "simthread.hpp".
+    if (!Flythrough_IsActive() && !Regression_IsActive() && !Capture_IsActive())
+        SimThread_Start();
+
+    // Estado da partida desenhado no quadro atual
+    SimulationSnapshot state;
 
     // Ficamos em loop, renderizando, até que o usuário feche a janela
     while (!glfwWindowShouldClose(window))
     {
+        // No benchmark, os carros, a bola e as câmeras seguem os caminhos
+        // fixos até o último quadro
+        if (!Flythrough_Update())
+            break;
+
+        // Na regressão, o mesmo para cada uma das cenas fixas
+        if (!Regression_Update())
+            break;
+
+        Profiler_BeginFrame();
+        GlStats_BeginFrame();
+        g_NumDrawCalls = 0;
+
+        // Executamos as tarefas que precisam do contexto OpenGL, como o upload
+        // das texturas que terminaram de ser decodificadas
+        Jobs_RunMainThread();
+
         // Atualização do tempo passado entre os frames
         last_frame_time = current_frame_time;
         current_frame_time = glfwGetTime();
         time_between_frames = current_frame_time - last_frame_time;
 
+        // O intervalo entre quadros alimenta os percentis (o primeiro quadro
+        // inclui o carregamento e é ignorado)
+        if (last_frame_time > 0)
+            FrameTime_Record(FRAME_TIME_CPU, time_between_frames * 1000.0);
+
+        // Na captura, cada quadro do vídeo avança a partida pelo mesmo tempo,
+        // independentemente de quanto demorou para ser desenhado
+        if (Capture_IsActive())
+            time_between_frames = 1.0f / CAPTURE_FRAME_RATE;
+
         // Aqui executamos as operações de renderização
 
         // Definição da cor do céu 
         //           R     G     B      A
         glClearColor(0.6f, 0.8f, 0.95f, 1.0f);
 
+        // Na captura, desenhamos no framebuffer fora da tela
+        Capture_BeginFrame();
+
         // "Pintamos" todos os pixels do framebuffer com a cor definida acima,
         // e também resetamos todos os pixels do Z-buffer (depth buffer).
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // Pedimos para a GPU utilizar o programa de GPU criado acima (contendo
         // os shaders de vértice e fragmentos).
-        glUseProgram(program_id);
+        glUseProgram(g_GpuProgram.Get());
         
         // As texturas são passadas para a GPU
-        glUniform1i(glGetUniformLocation(program_id, "floor_color"), 0);
-        glUniform1i(glGetUniformLocation(program_id, "walls_color"), 1);
-
-
-        // Funções de atrito da bola e dos carros, se o carro estão de lado o atrito é maior 
-        if (norm(purple_car_speed) > 0)
-        {
-            purple_car_speed *= std::pow(0.6, time_between_frames);
-            purple_car_speed *= std::pow(0.02, time_between_frames * (1 - abs(purple_car_direction.x * purple_car_speed.x + purple_car_direction.z * purple_car_speed.z) / norm(purple_car_speed)));
-        }
-        if (norm(orange_car_speed) > 0)
-        {
-            orange_car_speed *= std::pow(0.6, time_between_frames);
-            orange_car_speed *= std::pow(0.02, time_between_frames * (1 - abs(orange_car_direction.x * orange_car_speed.x + orange_car_direction.z * orange_car_speed.z) / norm(orange_car_speed)));
-        }
-        ball_speed *= std::pow(0.8, time_between_frames);
-        
-        // Criação de variaveis temporarias para possivel novo valor da posição, velocidade e direção do carro
-        glm::vec4 purple_car_new_position = purple_car_position;
-        glm::vec4 purple_car_new_speed = purple_car_speed;
-        glm::vec4 purple_car_new_direction = purple_car_direction;
-
+        glUniform1i(glGetUniformLocation(g_GpuProgram.Get(), "floor_color"), 0);
+        glUniform1i(glGetUniformLocation(g_GpuProgram.Get(), "walls_color"), 1);
 
-        // Atualiza a velocidade do carro, usando o tempo entre os frames. Se o carro está dando ré, a aceleração é menor
-        if (is_purple_car_moving_front)
-        {
-            purple_car_new_speed += 30.0f * time_between_frames * purple_car_direction;
-        }
-        if (is_purple_car_moving_back)
-        {
-            purple_car_new_speed -= 20.0f * time_between_frames * purple_car_direction;
-        }
-
-        // Atualiza a posição do carro 
-        purple_car_new_position += time_between_frames * purple_car_new_speed;
-
-        // Atualiza a direção do carro, quanto maior a velocidade do carro, mais rápido ele gira
-        if (is_purple_car_moving_right)
-        {
-            purple_car_new_direction = Matrix_Rotate_Y(-norm(purple_car_speed) / 8 * time_between_frames) * purple_car_new_direction;
-        }
-        if (is_purple_car_moving_left)
-        {
-            purple_car_new_direction = Matrix_Rotate_Y(+norm(purple_car_speed) / 8 * time_between_frames) * purple_car_new_direction;
-        }
 
-        // Verifica se há colisão do carro com o cenário, se tiver a velocidade do carro é zerada, senão, a posição, velocidade e direção são definitivamente atualizadas
-        if (not is_colliding_car_to_scenario(purple_car_new_position, purple_car_new_direction))
+        // A simulação avança em passos fixos. Com a thread da simulação,
+        // desenhamos o estado mais recente publicado por ela. Sem a thread, a
+        // simulação avança aqui, ou, no benchmark e na regressão, o estado é
+        // o definido pelas poses fixas (os comandos definem as câmeras).
+        if (SimThread_IsRunning())
         {
-            purple_car_position = purple_car_new_position;
-            purple_car_speed = purple_car_new_speed;
-            purple_car_direction = purple_car_new_direction;
-        }
-        else
-        {
-            purple_car_speed = ZERO;
-        }
-        
-        // Aqui as mesmas funções são implementadas, porém para o carro laranja
-
-        glm::vec4 orange_car_new_position = orange_car_position;
-        glm::vec4 orange_car_new_speed = orange_car_speed;
-        glm::vec4 orange_car_new_direction = orange_car_direction;
-
-        if (is_orange_car_moving_front)
-        {
-            orange_car_new_speed += 30.0f * time_between_frames * orange_car_direction;
-        }
-        if (is_orange_car_moving_back)
-        {
-            orange_car_new_speed -= 20.0f * time_between_frames * orange_car_direction;
-        }
-
-        orange_car_new_position += time_between_frames * orange_car_new_speed;
-
-        if (is_orange_car_moving_right)
-        {
-            orange_car_new_direction = Matrix_Rotate_Y(-norm(orange_car_speed) / 8 * time_between_frames) * orange_car_new_direction;
-        }
-        if (is_orange_car_moving_left)
-        {
-            orange_car_new_direction = Matrix_Rotate_Y(+norm(orange_car_speed) / 8 * time_between_frames) * orange_car_new_direction;
-        }
-
-        if (not is_colliding_car_to_scenario(orange_car_new_position, orange_car_new_direction))
-        {
-            orange_car_position = orange_car_new_position;
-            orange_car_speed = orange_car_new_speed;
-            orange_car_direction = orange_car_new_direction;
-        }
-        else
-        {
-            orange_car_speed = ZERO;
-        }
-
-        // Define o angulo da direção
-        purple_car_direction_angle = atan2(-purple_car_direction.x, -purple_car_direction.z);
-        orange_car_direction_angle = atan2(-orange_car_direction.x, -orange_car_direction.z);
-
-        // Funções de movimentação da bola
-        // Se a bola está voltando do gol ou não
-        if (is_ball_returning)
-        {
-            //  Se a bola está voltando do gol, é usado curvas de Bezier para fazer a movimentação da bola de volta ao centro. 
-            ball_returning_progress += time_between_frames / 6;
-
-            if (ball_returning_progress >= 1)
+            if (SimThread_IsReplayFinished())
             {
-                ball_returning_progress = 1;
-                is_ball_returning = false;
-                ball_speed = ZERO;
+                printf("Fim da reprodução.\n");
+                glfwSetWindowShouldClose(window, GL_TRUE);
             }
-
-            float p = ball_returning_progress * ball_returning_progress * ball_returning_progress;
-            float q = 1 - p;
-
-            ball_position = 
-                1 * q*q*q * ball_returning_point_1 +
-                3 * p*q*q * ball_returning_point_2 +
-                3 * p*p*q * ball_returning_point_3 +
-                1 * p*p*p * ball_returning_point_4;
-            ball_position.w = 1;
+            SimThread_GetSnapshot(&state);
         }
         else
         {
-            // A possivel nova posição da bola é salva em uma variavel temporaria
-            glm::vec4 ball_new_position = ball_position;
-
-            ball_new_position += time_between_frames * ball_speed;
-
-            // Se a bola colide com algum dos carros, ela vai na direção contrária do carro, e ambos, a bola e o carro, perdem velocidade, mas a bola ganha velocidade do impacto (quanto mais velocidade o carro possuia, mais veloz é o "retorno" da bola)
-            if (is_colliding_ball_to_car(ball_new_position, purple_car_position, purple_car_direction))
-            {
-                ball_speed = (1.3f * norm(purple_car_speed) + norm(ball_speed) / 1.3f) * (ball_new_position - purple_car_position) / norm(ball_new_position - purple_car_position);
-                ball_speed.y = 0;
-                purple_car_speed /= 1.5f;
-            }
-            if (is_colliding_ball_to_car(ball_new_position, orange_car_position, orange_car_direction))
-            {
-                ball_speed = (1.3f * norm(orange_car_speed) + norm(ball_speed) / 1.3f) * (ball_new_position - orange_car_position) / norm(ball_new_position - orange_car_position);
-                ball_speed.y = 0;
-                orange_car_speed /= 1.5f;
-            }
-
-            // Se a bola colide com alguma parede, ela reflete 
-            if (is_colliding_ball_to_north_wall(ball_new_position) or is_colliding_ball_to_south_wall(ball_new_position))
+            if (Flythrough_IsActive() || Regression_IsActive())
             {
-                ball_speed.z = -ball_speed.z;
+                Simulation_SetInput(Simulation_GetInput());
             }
-            if (is_colliding_ball_to_east_wall(ball_new_position) or is_colliding_ball_to_west_wall(ball_new_position))
+            else if (!SimThread_Advance(time_between_frames, Simulation_GetInput()))
             {
-                ball_speed.x = -ball_speed.x;
-            }
-
-            // Verica se a bola saiu do cenário, se sim, ela cai
-            if (abs(ball_new_position.z) > FIELD_LENGTH / 2)
-            {
-                ball_speed.y -= std::pow(9.8f, time_between_frames); 
-            }
-
-            ball_position = ball_new_position;
-
-            // Se a bola está abaixo de -5 metros, ela retorna ao centro
-            if (ball_position.y <= -5)
-            {
-                is_ball_returning = true;
-                ball_returning_progress = 0;
-
-                if (ball_position.z > 0)
-                {
-                    ball_returning_point_1 = ball_position;
-                    ball_returning_point_2 = glm::vec4(0, FIELD_HEIGHT + 5, FIELD_LENGTH / 2 + 10, 1);
-                    ball_returning_point_3 = glm::vec4(0, FIELD_HEIGHT + 12, FIELD_LENGTH / 2, 1);
-                    ball_returning_point_4 = glm::vec4(0, BALL_RADIUS, 0, 1);
-                }
-                else
-                {
-                    ball_returning_point_1 = ball_position;
-                    ball_returning_point_2 = glm::vec4(0, FIELD_HEIGHT + 5, -FIELD_LENGTH / 2 - 10, 1);
-                    ball_returning_point_3 = glm::vec4(0, FIELD_HEIGHT + 12, -FIELD_LENGTH / 2, 1);
-                    ball_returning_point_4 = glm::vec4(0, BALL_RADIUS, 0, 1);
-                }
+                printf("Fim da reprodução.\n");
+                glfwSetWindowShouldClose(window, GL_TRUE);
             }
+            Simulation_GetSnapshot(&state);
         }
 
-        // Abaixo definimos as varáveis que efetivamente definem a câmera virtual.
-        // Veja slides 195-227 e 229-234 do documento Aula_08_Sistemas_de_Coordenadas.pdf.
-        glm::vec4 car_position;
-        GLfloat car_direction_angle;
-        GLboolean is_camera_looking_back;
-        glm::vec4 camera_offset_to_car;
-        glm::vec4 camera_position;
-        glm::vec4 camera_view_vector;
-        glm::vec4 camera_up_vector;
-        glm::mat4 view;
-        float field_of_view;
-        glm::mat4 projection;
+        // Os objetos da cena e suas matrizes de modelagem são os mesmos nas
+        // duas viewports: calculamos uma vez e desenhamos em cada uma
+        BuildDynamicRenderQueue(state);
 
         // Note que, no sistema de coordenadas da câmera, os planos near e far
         // estão no sentido negativo! Veja slides 176-204 do documento Aula_09_Projecoes.pdf.
         float nearplane = -0.1f;  // Posição do "near plane"
         float farplane  = FIELD_WIDTH + FIELD_LENGTH + FIELD_HEIGHT; // Posição do "far plane"
 
-        glm::mat4 model = Matrix_Identity(); // Transformação identidade de modelagem
-
-        
-        car_position = purple_car_position;
-        car_direction_angle = purple_car_direction_angle;
-        is_camera_looking_back = is_purple_camera_looking_back;
-
-        // Definição da tela do carro roxo
-        glViewport(0, 0, 1920/2, 1080);
+        // Projeção Perspectiva.
+        // Para definição do field of view (FOV), veja slides 205-215 do documento Aula_09_Projecoes.pdf.
+        float field_of_view = PI * 2/5;
+        glm::mat4 projection = Matrix_Perspective(field_of_view, g_ScreenRatio, nearplane, farplane);
 
-        //  Posicionamento da cãmera, se o jogador estiver olhando para bola, a câmera á posicionada 1.8m acima do carro, caso contrário, a câmera é posicionada acima do carro ,e , se estiver olhando para a frente, um pouco para trás dele, caso o contrário, um pouco a frente dele 
-        if (is_purple_car_looking_at_ball)
-        {
-            camera_offset_to_car = glm::vec4(0, 1.8, 0, 1);
-        }
-        else
-        {
-            camera_offset_to_car = glm::vec4(0, 1.8, (is_purple_camera_looking_back? -7 : 7), 1);
-        }
-        camera_position = Matrix_Translate(car_position.x, car_position.y, car_position.z) * Matrix_Rotate_Y(car_direction_angle) * camera_offset_to_car;
-        if (is_purple_car_looking_at_ball)
+        // Cada metade da tela mostra a câmera de um dos carros: roxo à
+        // esquerda e laranja à direita
+        struct ViewportCamera
         {
-            camera_view_vector = ball_position - camera_position; // Câmera Lookat
-        }
-        else
+            const char* name; // Zona do profiler
+            int         x;
+            glm::vec4   car_position;
+            GLfloat     car_direction_angle;
+            uint8_t     input; // Comandos do carro, que definem a câmera
+        };
+        const ViewportCamera viewports[] = {
+            { "viewport roxo",    0,        state.purple_car_position, state.purple_car_direction_angle, state.input.purple },
+            { "viewport laranja", 1920 / 2, state.orange_car_position, state.orange_car_direction_angle, state.input.orange },
+        };
+
+        for (size_t i = 0; i < sizeof(viewports) / sizeof(viewports[0]); ++i)
         {
-            camera_view_vector = Matrix_Rotate_Y((is_camera_looking_back? PI : 0) + car_direction_angle) * NORTH;
-        }
-        camera_up_vector = UP;
+            const ViewportCamera& viewport = viewports[i];
+            bool is_camera_looking_at_ball = (viewport.input & INPUT_LOOK_AT_BALL) != 0;
+            bool is_camera_looking_back    = (viewport.input & INPUT_LOOK_BACK) != 0;
+
+            Profiler_BeginZone(viewport.name);
+            Profiler_BeginGpuZone(viewport.name);
+            glViewport(viewport.x, 0, 1920/2, 1080);
+
+            // Abaixo definimos as varáveis que efetivamente definem a câmera virtual.
+            // Veja slides 195-227 e 229-234 do documento Aula_08_Sistemas_de_Coordenadas.pdf.
+            glm::vec4 camera_offset_to_car;
+            glm::vec4 camera_position;
+            glm::vec4 camera_view_vector;
+            glm::vec4 camera_up_vector;
+
+            //  Posicionamento da cãmera, se o jogador estiver olhando para bola, a câmera á posicionada 1.8m acima do carro, caso contrário, a câmera é posicionada acima do carro ,e , se estiver olhando para a frente, um pouco para trás dele, caso o contrário, um pouco a frente dele 
+            if (is_camera_looking_at_ball)
+            {
+                camera_offset_to_car = glm::vec4(0, 1.8, 0, 1);
+            }
+            else
+            {
+                camera_offset_to_car = glm::vec4(0, 1.8, (is_camera_looking_back? -7 : 7), 1);
+            }
+            camera_position = Matrix_Translate(viewport.car_position.x, viewport.car_position.y, viewport.car_position.z) * Matrix_Rotate_Y(viewport.car_direction_angle) * camera_offset_to_car;
+            if (is_camera_looking_at_ball)
+            {
+                camera_view_vector = state.ball_position - camera_position; // Câmera Lookat
+            }
+            else
+            {
+                camera_view_vector = Matrix_Rotate_Y((is_camera_looking_back? PI : 0) + viewport.car_direction_angle) * NORTH;
+            }
+            camera_up_vector = UP;
 
-        view = Matrix_Camera_View(camera_position, camera_view_vector, camera_up_vector);
+            glm::mat4 view = Matrix_Camera_View(camera_position, camera_view_vector, camera_up_vector);
 
-        // Projeção Perspectiva.
-        // Para definição do field of view (FOV), veja slides 205-215 do documento Aula_09_Projecoes.pdf.
-        field_of_view = PI * 2/5;
-        projection = Matrix_Perspective(field_of_view, g_ScreenRatio, nearplane, farplane);
-
-        // Enviamos as matrizes "view" e "projection" para a placa de vídeo
-        // (GPU). Veja o arquivo "shader_vertex.glsl", onde estas são
-        // efetivamente aplicadas em todos os pontos.
-        glUniformMatrix4fv(view_uniform       , 1 , GL_FALSE , glm::value_ptr(view));
-        glUniformMatrix4fv(projection_uniform , 1 , GL_FALSE , glm::value_ptr(projection));
-        
-        // Definição de constantes para os objetos 
-        #define BALL 0
-        #define FLOOR 1
-        #define WALL 2
-        #define PURPLE_CAR 3
-        #define ORANGE_CAR 4
-
-        // Desenho a bola
-        model = Matrix_Translate(ball_position.x, ball_position.y, ball_position.z)
-                * Matrix_Scale(BALL_DIAMETER / 2, BALL_DIAMETER / 2, BALL_DIAMETER / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, BALL);
-        DrawVirtualObject("sphere");
-
-        // Desenho o chão
-        model = Matrix_Translate(0, 0, 0)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, FLOOR);
-        DrawVirtualObject("plane");
-
-        // Desenho as paredes laterais
-        model = Matrix_Translate(FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
-                * Matrix_Rotate_Z(PI / 2)
-                * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
-                * Matrix_Rotate_Z(-PI / 2)
-                * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        // Desenho as paredes traseiras
-        // XXXXXXXXXXXXX
-        // XXXXXXXXXXXXX
-        // XXXXXXXXXXXXX
-        // XXXXX   XXXXX
-        // XXXXX   XXXXX
-
-        model = Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-
-        model = Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        // Desenho os carros
-
-        model = Matrix_Translate(purple_car_position.x, purple_car_position.y, purple_car_position.z)
-                * Matrix_Rotate_Y(purple_car_direction_angle + PI)
-                * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, PURPLE_CAR);
-        DrawVirtualObject("carrito");
-
-        model = Matrix_Translate(orange_car_position.x, orange_car_position.y, orange_car_position.z)
-                * Matrix_Rotate_Y(orange_car_direction_angle + PI)
-                * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, ORANGE_CAR);
-        DrawVirtualObject("carrito");
-
-        car_position = orange_car_position;
-        car_direction_angle = orange_car_direction_angle;
-        is_camera_looking_back = is_orange_camera_looking_back;
-        
-        glViewport(1920/2, 0, 1920/2, 1080); // Definição da tela  do carro laranja
+            // Enviamos as matrizes "view" e "projection" para a placa de vídeo
+            // (GPU). Veja o arquivo "shader_vertex.glsl", onde estas são
+            // efetivamente aplicadas em todos os pontos.
+            glUniformMatrix4fv(view_uniform       , 1 , GL_FALSE , glm::value_ptr(view));
+            glUniformMatrix4fv(projection_uniform , 1 , GL_FALSE , glm::value_ptr(projection));
 
+            // Desenho a bola, o chão, as paredes e os carros
+            DrawRenderQueue();
 
-        // Aqui são os mesmos comandos, porém para o carro laranja  
-        if (is_orange_car_looking_at_ball)
-        {
-            camera_offset_to_car = glm::vec4(0, 1.8, 0, 1);
-        }
-        else
-        {
-            camera_offset_to_car = glm::vec4(0, 1.8, (is_orange_camera_looking_back? -7 : 7), 1);
-        }
-        camera_position = Matrix_Translate(car_position.x, car_position.y, car_position.z) * Matrix_Rotate_Y(car_direction_angle) * camera_offset_to_car;
-        if (is_orange_car_looking_at_ball)
-        {
-            camera_view_vector = ball_position - camera_position; // Câmera Lookat
-        }
-        else
-        {
-            camera_view_vector = Matrix_Rotate_Y((is_camera_looking_back? PI : 0) + car_direction_angle) * NORTH;
+            Profiler_EndGpuZone();
+            Profiler_EndZone();
         }
-        camera_up_vector = UP;
-
-        view = Matrix_Camera_View(camera_position, camera_view_vector, camera_up_vector);
 
-        // Projeção Perspectiva.
-        // Para definição do field of view (FOV), veja slides 205-215 do documento Aula_09_Projecoes.pdf.
-        field_of_view = PI * 2/5;
-        projection = Matrix_Perspective(field_of_view, g_ScreenRatio, nearplane, farplane);
-
-        // Enviamos as matrizes "view" e "projection" para a placa de vídeo
-        // (GPU). Veja o arquivo "shader_vertex.glsl", onde estas são
-        // efetivamente aplicadas em todos os pontos.
-        glUniformMatrix4fv(view_uniform       , 1 , GL_FALSE , glm::value_ptr(view));
-        glUniformMatrix4fv(projection_uniform , 1 , GL_FALSE , glm::value_ptr(projection));
-        
-        #define BALL 0
-        #define FLOOR 1
-        #define WALL 2
-        #define PURPLE_CAR 3
-        #define ORANGE_CAR 4
-
-        // Desenho a bola
-        model = Matrix_Translate(ball_position.x, ball_position.y, ball_position.z)
-                * Matrix_Scale(BALL_DIAMETER / 2, BALL_DIAMETER / 2, BALL_DIAMETER / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, BALL);
-        DrawVirtualObject("sphere");
-
-        // Desenho o chão
-        model = Matrix_Translate(0, 0, 0)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, FLOOR);
-        DrawVirtualObject("plane");
-
-        // Desenho as paredes laterais
-        model = Matrix_Translate(FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
-                * Matrix_Rotate_Z(PI / 2)
-                * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
-                * Matrix_Rotate_Z(-PI / 2)
-                * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        // Desenho as paredes traseiras
-        // XXXXXXXXXXXXX
-        // XXXXXXXXXXXXX
-        // XXXXXXXXXXXXX
-        // XXXXX   XXXXX
-        // XXXXX   XXXXX
-
-        model = Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(-PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-
-        model = Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        model = Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
-                * Matrix_Rotate_X(PI / 2)
-                * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2);
-        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, WALL);
-        DrawVirtualObject("plane");
-
-        // Desenho os carros
-
-        model = Matrix_Translate(purple_car_position.x, purple_car_position.y, purple_car_position.z)
-                * Matrix_Rotate_Y(purple_car_direction_angle + PI)
-                * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1, GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, PURPLE_CAR);
-        DrawVirtualObject("carrito");
-
-        model = Matrix_Translate(orange_car_position.x, orange_car_position.y, orange_car_position.z)
-                * Matrix_Rotate_Y(orange_car_direction_angle + PI)
-                * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2);
-        glUniformMatrix4fv(model_uniform, 1, GL_FALSE , glm::value_ptr(model));
-        glUniform1i(object_id_uniform, ORANGE_CAR);
-        DrawVirtualObject("carrito");
+        Profiler_BeginZone("texto");
+        Profiler_BeginGpuZone("texto");
 
         // Imprimimos na tela informação sobre o número de quadros renderizados
         // por segundo (frames per second).
         TextRendering_ShowFramesPerSecond(window);
 
+        // Tempos médios de cada etapa do quadro (tecla F1) e gráfico dos
+        // tempos de quadro com os percentis (tecla F3)
+        Profiler_DrawOverlay(window);
+        FrameTime_DrawGraph(window);
+
+        // Todo o texto acumulado acima é desenhado de uma só vez
+        TextRendering_Flush(window);
+
+        Profiler_EndGpuZone();
+        Profiler_EndZone();
+
+        // Agenda a leitura do quadro para a captura, ou o compara com a
+        // referência na regressão
+        Capture_EndFrame();
+        Regression_EndFrame();
+
         // O framebuffer onde OpenGL executa as operações de renderização não
         // é o mesmo que está sendo mostrado para o usuário, caso contrário
         // seria possível ver artefatos conhecidos como "screen tearing". A
         // chamada abaixo faz a troca dos buffers, mostrando para o usuário
         // tudo que foi renderizado pelas funções acima.
         // Veja o link: Veja o link: https://en.wikipedia.org/w/index.php?title=Multiple_buffering&oldid=793452829#Double_buffering_in_computer_graphics
+        Profiler_BeginZone("swap");
         glfwSwapBuffers(window);
+        Profiler_EndZone();
 
         // Verificamos com o sistema operacional se houve alguma interação do
         // usuário (teclado, mouse, ...). Caso positivo, as funções de callback
         // definidas anteriormente usando glfwSet*Callback() serão chamadas
         // pela biblioteca GLFW.
         glfwPollEvents();
+
+        // Comandos do teclado para a thread da simulação
+        SimThread_SetInput(Simulation_GetInput());
+
+        GlStats_EndFrame();
+        Profiler_EndFrame();
+        Flythrough_EndFrame(g_NumDrawCalls);
     }
 
+    // A partir daqui o estado da partida volta a pertencer a esta thread
+    SimThread_Stop();
+
+    // Resultados do benchmark e da regressão, se estiverem ativos
+    Flythrough_PrintReport();
+    bool regression_passed = Regression_PrintReport();
+
+    // Imprimimos os percentis dos tempos de quadro da partida
+    FrameTime_PrintReport();
+
+    // Salvamos a gravação dos comandos, se houver
+    InputReplay_Stop();
+
+    // Escrevemos os últimos quadros capturados (usa as threads auxiliares)
+    Capture_Shutdown();
+
     // Finalizamos o uso dos recursos do sistema operacional
+    Profiler_Shutdown();
+    FrameTime_Shutdown();
+    TextRendering_Shutdown();
+    MeshPool_Shutdown();
+    TextureLoader_Shutdown();
+    g_GpuProgram.Reset();
+    GpuResources_Shutdown();
+    GlState_Shutdown();
+    GlStats_Shutdown();
+    Jobs_Shutdown();
+    Archive_Close();
     glfwTerminate();
 
     // Fim do programa
-    return 0;
+    return regression_passed ? 0 : EXIT_FAILURE;
 }
 
 // Função que desenha um objeto armazenado em g_VirtualScene. Veja definição
 // dos objetos na função BuildTrianglesAndAddToVirtualScene().
 void DrawVirtualObject(const char* object_name)
+{
+    DrawSceneObject(g_VirtualScene[object_name]);
+}
+
+// Desenha um objeto de g_VirtualScene já encontrado
+void DrawSceneObject(const SceneObject& object)
 {
     // "Ligamos" o VAO. Informamos que queremos utilizar os atributos de
     // vértices apontados pelo VAO criado pela função BuildTrianglesAndAddToVirtualScene(). Veja
     // comentários detalhados dentro da definição de BuildTrianglesAndAddToVirtualScene().
-    glBindVertexArray(g_VirtualScene[object_name].vertex_array_object_id);
+    glBindVertexArray(object.vertex_array_object_id);
 
     // Pedimos para a GPU rasterizar os vértices dos eixos XYZ
     // apontados pelo VAO como linhas. Veja a definição de
     // g_VirtualScene[""] dentro da função BuildTrianglesAndAddToVirtualScene(), e veja
-    // a documentação da função glDrawElements() em
-    // http://docs.gl/gl3/glDrawElements.
-    glDrawElements(
-        g_VirtualScene[object_name].rendering_mode,
-        g_VirtualScene[object_name].num_indices,
+    // a documentação da função glDrawElementsBaseVertex() em
+    // http://docs.gl/gl3/glDrawElementsBaseVertex. Os índices do objeto são
+    // relativos ao seu primeiro vértice dentro do buffer compartilhado (veja
+    // "meshpool.hpp").
+    glDrawElementsBaseVertex(
+        object.rendering_mode,
+        object.num_indices,
         GL_UNSIGNED_INT,
-        (void*)(g_VirtualScene[object_name].first_index * sizeof(GLuint))
+        (void*)(object.first_index * sizeof(GLuint)),
+        object.base_vertex
     );
+    g_NumDrawCalls++;
+
+    // O VAO não é "desligado" aqui: assim objetos consecutivos que usam o
+    // mesmo VAO (os planos da arena, por exemplo) não o religam, pois o
+    // cache de "glstate.cpp" descarta a chamada repetida. Todo código que
+    // liga um GL_ELEMENT_ARRAY_BUFFER liga antes o seu próprio VAO.
+}
+
+// Adiciona um objeto de g_VirtualScene à fila de desenho
+void AddToRenderQueue(const char* object_name, glm::mat4 model, GLint object_id)
+{
+    RenderCommand command;
+    command.model     = model;
+    command.object_id = object_id;
+    command.object    = &g_VirtualScene[object_name];
+    g_RenderQueue.push_back(command);
+}
+
+void BuildStaticRenderQueue()
+{
+    g_RenderQueue.clear();
+
+    // Desenho o chão
+    AddToRenderQueue("plane", Matrix_Translate(0, 0, 0)
+                            * Matrix_Scale(FIELD_WIDTH / 2, 1, FIELD_LENGTH / 2), FLOOR);
+
+    // Desenho as paredes laterais
+    AddToRenderQueue("plane", Matrix_Translate(FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
+                            * Matrix_Rotate_Z(PI / 2)
+                            * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2), WALL);
+
+    AddToRenderQueue("plane", Matrix_Translate(-FIELD_WIDTH / 2, FIELD_HEIGHT / 2, 0)
+                            * Matrix_Rotate_Z(-PI / 2)
+                            * Matrix_Scale(FIELD_HEIGHT / 2, 1, FIELD_LENGTH / 2), WALL);
+
+    // Desenho as paredes traseiras
+    // XXXXXXXXXXXXX
+    // XXXXXXXXXXXXX
+    // XXXXXXXXXXXXX
+    // XXXXX   XXXXX
+    // XXXXX   XXXXX
+
+    AddToRenderQueue("plane", Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(-PI / 2)
+                            * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2), WALL);
+
+    AddToRenderQueue("plane", Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(-PI / 2)
+                            * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2), WALL);
+
+    AddToRenderQueue("plane", Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(-PI / 2)
+                            * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2), WALL);
+
+    AddToRenderQueue("plane", Matrix_Translate(0, GOAL_HEIGHT + (FIELD_HEIGHT - GOAL_HEIGHT) / 2, -FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(PI / 2)
+                            * Matrix_Scale(FIELD_WIDTH / 2, 1, (FIELD_HEIGHT - GOAL_HEIGHT) / 2), WALL);
+
+    AddToRenderQueue("plane", Matrix_Translate(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4, GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(PI / 2)
+                            * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2), WALL);
 
-    // "Desligamos" o VAO, evitando assim que operações posteriores venham a
-    // alterar o mesmo. Isso evita bugs.
-    glBindVertexArray(0);
+    AddToRenderQueue("plane", Matrix_Translate(-(GOAL_WIDTH / 2 + (FIELD_WIDTH - GOAL_WIDTH) / 4), GOAL_HEIGHT / 2, -FIELD_LENGTH / 2)
+                            * Matrix_Rotate_X(PI / 2)
+                            * Matrix_Scale((FIELD_WIDTH / 2 - GOAL_WIDTH / 2) / 2, 1, GOAL_HEIGHT / 2), WALL);
+
+    g_NumStaticRenderCommands = g_RenderQueue.size();
+}
+
+void BuildDynamicRenderQueue(const SimulationSnapshot& state)
+{
+    // Descartamos os objetos do quadro anterior
+    g_RenderQueue.resize(g_NumStaticRenderCommands);
+
+    // Desenho a bola
+    AddToRenderQueue("sphere", Matrix_Translate(state.ball_position.x, state.ball_position.y, state.ball_position.z)
+                             * Matrix_Scale(BALL_DIAMETER / 2, BALL_DIAMETER / 2, BALL_DIAMETER / 2), BALL);
+
+    // Desenho os carros
+    AddToRenderQueue("carrito", Matrix_Translate(state.purple_car_position.x, state.purple_car_position.y, state.purple_car_position.z)
+                              * Matrix_Rotate_Y(state.purple_car_direction_angle + PI)
+                              * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2), PURPLE_CAR);
+
+    AddToRenderQueue("carrito", Matrix_Translate(state.orange_car_position.x, state.orange_car_position.y, state.orange_car_position.z)
+                              * Matrix_Rotate_Y(state.orange_car_direction_angle + PI)
+                              * Matrix_Scale(CAR_WIDTH / 2, CAR_HEIGHT / 2, CAR_LENGTH / 2), ORANGE_CAR);
+}
+
+// Dois comandos podem ser desenhados na mesma chamada se usam o mesmo VAO, o
+// mesmo modo de rasterização e os mesmos valores das variáveis "uniform"
+static bool CanMergeRenderCommands(const RenderCommand& a, const RenderCommand& b)
+{
+    return a.object->vertex_array_object_id == b.object->vertex_array_object_id
+        && a.object->rendering_mode == b.object->rendering_mode
+        && a.object_id == b.object_id
+        && a.model == b.model;
+}
+
+void DrawRenderQueue()
+{
+    // Como os modelos estão nos buffers compartilhados (veja "meshpool.hpp"),
+    // comandos consecutivos compatíveis (por exemplo, os vários shapes de um
+    // mesmo modelo) viram uma única chamada a glMultiDrawElementsBaseVertex().
+    // O OpenGL 3.3 não tem gl_DrawID, então a matriz "model" e o "object_id"
+    // de cada objeto ainda exigem uma chamada própria.
+    std::vector<GLsizei>     counts;
+    std::vector<const void*> offsets;
+    std::vector<GLint>       base_vertices;
+
+    size_t i = 0;
+    while (i < g_RenderQueue.size())
+    {
+        const RenderCommand& command = g_RenderQueue[i];
+        glUniformMatrix4fv(model_uniform, 1 , GL_FALSE , glm::value_ptr(command.model));
+        glUniform1i(object_id_uniform, command.object_id);
+
+        size_t end = i + 1;
+        while (end < g_RenderQueue.size() && CanMergeRenderCommands(command, g_RenderQueue[end]))
+            ++end;
+
+        if (end == i + 1)
+        {
+            DrawSceneObject(*command.object);
+        }
+        else
+        {
+            counts.clear();
+            offsets.clear();
+            base_vertices.clear();
+            for (size_t j = i; j < end; ++j)
+            {
+                const SceneObject& object = *g_RenderQueue[j].object;
+                counts.push_back((GLsizei)object.num_indices);
+                offsets.push_back((const void*)(object.first_index * sizeof(GLuint)));
+                base_vertices.push_back(object.base_vertex);
+            }
+
+            glBindVertexArray(command.object->vertex_array_object_id);
+            glMultiDrawElementsBaseVertex(command.object->rendering_mode, counts.data(), GL_UNSIGNED_INT,
+                                          (const void* const*)offsets.data(), (GLsizei)counts.size(), base_vertices.data());
+            g_NumDrawCalls++;
+        }
+        i = end;
+    }
 }
 
 // Função que carrega os shaders de vértices e de fragmentos que serão
@@ -903,15 +927,37 @@ void LoadShadersFromFiles()
     //       |
     //       o-- shader_fragment.glsl
     //
-    vertex_shader_id = LoadShader_Vertex("../../src/shader_vertex.glsl");
-    fragment_shader_id = LoadShader_Fragment("../../src/shader_fragment.glsl");
+    std::string vertex_source;
+    std::string fragment_source;
+    if (!ReadShaderFile("../../src/shader_vertex.glsl", &vertex_source) ||
+        !ReadShaderFile("../../src/shader_fragment.glsl", &fragment_source))
+        std::exit(EXIT_FAILURE);
+
+    BuildGpuProgramFromSources(vertex_source, fragment_source);
+}
 
-    // Deletamos o programa de GPU anterior, caso ele exista.
-    if ( program_id != 0 )
-        glDeleteProgram(program_id);
+// Compila os shaders de vértices e de fragmentos, cujo código já foi lido, e
+// cria o programa de GPU principal.
+void BuildGpuProgramFromSources(const std::string& vertex_source, const std::string& fragment_source)
+{
+    vertex_shader_id = glCreateShader(GL_VERTEX_SHADER);
+    CompileShader("../../src/shader_vertex.glsl", vertex_source, vertex_shader_id);
+    fragment_shader_id = glCreateShader(GL_FRAGMENT_SHADER);
+    CompileShader("../../src/shader_fragment.glsl", fragment_source, fragment_shader_id);
 
     // Criamos um programa de GPU utilizando os shaders carregados acima.
-    program_id = CreateGpuProgram(vertex_shader_id, fragment_shader_id);
+    GpuProgram program = CreateTrackedGpuProgram("main", vertex_shader_id, fragment_shader_id);
+
+    // Ao recarregar, um shader com erro não substitui o programa atual
+    if (!program.IsValid() && g_GpuProgram.IsValid())
+    {
+        fprintf(stderr, "ERROR: Shader reload failed; keeping the previous GPU program.\n");
+        return;
+    }
+
+    // O programa de GPU anterior, caso exista, é liberado aqui.
+    g_GpuProgram = std::move(program);
+    GLuint program_id = g_GpuProgram.Get();
 
     // Buscamos o endereço das variáveis definidas dentro do Vertex Shader.
     // Utilizaremos estas variáveis para enviar dados para a placa de vídeo
@@ -949,16 +995,14 @@ void ComputeNormals(ObjModel* model)
     if ( !model->attrib.normals.empty() )
         return;
 
-    // Primeiro computamos as normais para todos os TRIÂNGULOS.
-    // Segundo, computamos as normais dos VÉRTICES através do método proposto
-    // por Gouraud, onde a normal de cada vértice vai ser a média das normais de
-    // todas as faces que compartilham este vértice.
+    // Computamos uma normal para cada canto de triângulo, utilizando o método
+    // proposto por Gouraud: a normal de cada vértice é a média (ponderada) das
+    // normais de todas as faces que compartilham este vértice. Veja
+    // "normals.cpp", onde este cálculo é dividido entre várias threads.
 
     size_t num_vertices = model->attrib.vertices.size() / 3;
 
-    std::vector<int> num_triangles_per_vertex(num_vertices, 0);
-    std::vector<glm::vec4> vertex_normals(num_vertices, ZERO);
-
+    std::vector<GLuint> triangle_positions;
     for (size_t shape = 0; shape < model->shapes.size(); ++shape)
     {
         size_t num_triangles = model->shapes[shape].mesh.num_face_vertices.size();
@@ -967,59 +1011,35 @@ void ComputeNormals(ObjModel* model)
         {
             assert(model->shapes[shape].mesh.num_face_vertices[triangle] == 3);
 
-            glm::vec4  vertices[3];
             for (size_t vertex = 0; vertex < 3; ++vertex)
             {
-                tinyobj::index_t idx = model->shapes[shape].mesh.indices[3*triangle + vertex];
-                const float vx = model->attrib.vertices[3*idx.vertex_index + 0];
-                const float vy = model->attrib.vertices[3*idx.vertex_index + 1];
-                const float vz = model->attrib.vertices[3*idx.vertex_index + 2];
-                vertices[vertex] = glm::vec4(vx,vy,vz,1.0);
-            }
-
-            const glm::vec4  a = vertices[0];
-            const glm::vec4  b = vertices[1];
-            const glm::vec4  c = vertices[2];
-
-            // PREENCHA AQUI o cálculo da normal de um triângulo cujos vértices
-            // estão nos pontos "a", "b", e "c", definidos no sentido anti-horário.
-            const glm::vec4 u = c-a;
-            const glm::vec4 v = b-a;
-            const glm::vec4  n = crossproduct(v,u);
-
-            for (size_t vertex = 0; vertex < 3; ++vertex)
-            {
-                tinyobj::index_t idx = model->shapes[shape].mesh.indices[3*triangle + vertex];
-                num_triangles_per_vertex[idx.vertex_index] += 1;
-                vertex_normals[idx.vertex_index] += n;
-                model->shapes[shape].mesh.indices[3*triangle + vertex].normal_index = idx.vertex_index;
+                tinyobj::index_t& idx = model->shapes[shape].mesh.indices[3*triangle + vertex];
+                idx.normal_index = (int)triangle_positions.size();
+                triangle_positions.push_back(idx.vertex_index);
             }
         }
     }
 
-    model->attrib.normals.resize( 3*num_vertices );
+    model->attrib.normals.resize( 3*triangle_positions.size() );
 
-    for (size_t i = 0; i < vertex_normals.size(); ++i)
-    {
-        glm::vec4 n = vertex_normals[i] / (float)num_triangles_per_vertex[i];
-        n /= norm(n);
-        model->attrib.normals[3*i + 0] = n.x;
-        model->attrib.normals[3*i + 1] = n.y;
-        model->attrib.normals[3*i + 2] = n.z;
-    }
+    NormalsOptions options = Normals_DefaultOptions();
+    Normals_Compute(
+        model->attrib.vertices.data(), num_vertices,
+        triangle_positions.data(), triangle_positions.size() / 3,
+        options,
+        model->attrib.normals.data(), 3 * sizeof(float)
+    );
 }
 
 // Constrói triângulos para futura renderização a partir de um ObjModel.
 void BuildTrianglesAndAddToVirtualScene(ObjModel* model)
 {
-    GLuint vertex_array_object_id;
-    glGenVertexArrays(1, &vertex_array_object_id);
-    glBindVertexArray(vertex_array_object_id);
-
-    std::vector<GLuint> indices;
-    std::vector<float>  model_coefficients;
-    std::vector<float>  normal_coefficients;
-    std::vector<float>  texture_coefficients;
+    // Os atributos de cada vértice ficam intercalados, no mesmo layout do
+    // carregador "streaming" (veja "objstream.hpp"), para que o modelo use
+    // os mesmos buffers compartilhados
+    std::vector<GLuint>         indices;
+    std::vector<StreamedVertex> vertices;
+    std::vector<SceneObject>    objects;
 
     for (size_t shape = 0; shape < model->shapes.size(); ++shape)
     {
@@ -1036,38 +1056,43 @@ void BuildTrianglesAndAddToVirtualScene(ObjModel* model)
 
                 indices.push_back(first_index + 3*triangle + vertex);
 
-                const float vx = model->attrib.vertices[3*idx.vertex_index + 0];
-                const float vy = model->attrib.vertices[3*idx.vertex_index + 1];
-                const float vz = model->attrib.vertices[3*idx.vertex_index + 2];
-                //printf("tri %d vert %d = (%.2f, %.2f, %.2f)\n", (int)triangle, (int)vertex, vx, vy, vz);
-                model_coefficients.push_back( vx ); // X
-                model_coefficients.push_back( vy ); // Y
-                model_coefficients.push_back( vz ); // Z
-                model_coefficients.push_back( 1.0f ); // W
+                StreamedVertex v;
+                v.position[0] = model->attrib.vertices[3*idx.vertex_index + 0]; // X
+                v.position[1] = model->attrib.vertices[3*idx.vertex_index + 1]; // Y
+                v.position[2] = model->attrib.vertices[3*idx.vertex_index + 2]; // Z
+                v.position[3] = 1.0f; // W
 
                 // Inspecionando o código da tinyobjloader, o aluno Bernardo
                 // Sulzbach (2017/1) apontou que a maneira correta de testar se
                 // existem normais e coordenadas de textura no ObjModel é
                 // comparando se o índice retornado é -1. Fazemos isso abaixo.
+                // Na falta deles, usamos os mesmos valores que o OpenGL
+                // fornece para um atributo desabilitado.
 
                 if ( idx.normal_index != -1 )
                 {
-                    const float nx = model->attrib.normals[3*idx.normal_index + 0];
-                    const float ny = model->attrib.normals[3*idx.normal_index + 1];
-                    const float nz = model->attrib.normals[3*idx.normal_index + 2];
-                    normal_coefficients.push_back( nx ); // X
-                    normal_coefficients.push_back( ny ); // Y
-                    normal_coefficients.push_back( nz ); // Z
-                    normal_coefficients.push_back( 0.0f ); // W
+                    v.normal[0] = model->attrib.normals[3*idx.normal_index + 0]; // X
+                    v.normal[1] = model->attrib.normals[3*idx.normal_index + 1]; // Y
+                    v.normal[2] = model->attrib.normals[3*idx.normal_index + 2]; // Z
+                    v.normal[3] = 0.0f; // W
+                }
+                else
+                {
+                    v.normal[0] = v.normal[1] = v.normal[2] = 0.0f;
+                    v.normal[3] = 1.0f;
                 }
 
                 if ( idx.texcoord_index != -1 )
                 {
-                    const float u = model->attrib.texcoords[2*idx.texcoord_index + 0];
-                    const float v = model->attrib.texcoords[2*idx.texcoord_index + 1];
-                    texture_coefficients.push_back( u );
-                    texture_coefficients.push_back( v );
+                    v.texcoord[0] = model->attrib.texcoords[2*idx.texcoord_index + 0];
+                    v.texcoord[1] = model->attrib.texcoords[2*idx.texcoord_index + 1];
+                }
+                else
+                {
+                    v.texcoord[0] = v.texcoord[1] = 0.0f;
                 }
+
+                vertices.push_back(v);
             }
         }
 
@@ -1078,63 +1103,294 @@ void BuildTrianglesAndAddToVirtualScene(ObjModel* model)
         theobject.first_index    = first_index; // Primeiro índice
         theobject.num_indices    = last_index - first_index + 1; // Número de indices
         theobject.rendering_mode = GL_TRIANGLES;       // Índices correspondem ao tipo de rasterização GL_TRIANGLES.
-        theobject.vertex_array_object_id = vertex_array_object_id;
+        objects.push_back(theobject);
+    }
+
+    // Vértices e índices vão para os buffers compartilhados; os índices
+    // continuam relativos ao primeiro vértice do modelo
+    MeshAllocation allocation = MeshPool_Upload(MESH_FORMAT_STREAMED, vertices.data(), vertices.size(), indices.data(), indices.size());
 
-        g_VirtualScene[model->shapes[shape].name] = theobject;
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        objects[i].first_index           += allocation.first_index;
+        objects[i].vertex_array_object_id = allocation.vertex_array_object_id;
+        objects[i].base_vertex            = allocation.base_vertex;
+        g_VirtualScene[objects[i].name] = objects[i];
     }
+}
 
-    GLuint VBO_model_coefficients_id;
-    glGenBuffers(1, &VBO_model_coefficients_id);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO_model_coefficients_id);
-    glBufferData(GL_ARRAY_BUFFER, model_coefficients.size() * sizeof(float), NULL, GL_STATIC_DRAW);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, model_coefficients.size() * sizeof(float), model_coefficients.data());
-    GLuint location = 0; // "(location = 0)" em "shader_vertex.glsl"
-    GLint  number_of_dimensions = 4; // vec4 em "shader_vertex.glsl"
-    glVertexAttribPointer(location, number_of_dimensions, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(location);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-    if ( !normal_coefficients.empty() )
+// Adiciona em g_VirtualScene cada um dos shapes de um arquivo ".obj"
+// carregado diretamente para a GPU (veja "objstream.cpp"). Ao contrário do
+// caminho ObjModel -> ComputeNormals() -> BuildTrianglesAndAddToVirtualScene(),
+// que mantém várias cópias do modelo em memória, lá cada vértice é gravado uma
+// única vez, já no seu formato final.
+void AddStreamedMeshToVirtualScene(const StreamedMesh& mesh)
+{
+    for (size_t shape = 0; shape < mesh.shapes.size(); ++shape)
     {
-        GLuint VBO_normal_coefficients_id;
-        glGenBuffers(1, &VBO_normal_coefficients_id);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO_normal_coefficients_id);
-        glBufferData(GL_ARRAY_BUFFER, normal_coefficients.size() * sizeof(float), NULL, GL_STATIC_DRAW);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, normal_coefficients.size() * sizeof(float), normal_coefficients.data());
-        location = 1; // "(location = 1)" em "shader_vertex.glsl"
-        number_of_dimensions = 4; // vec4 em "shader_vertex.glsl"
-        glVertexAttribPointer(location, number_of_dimensions, GL_FLOAT, GL_FALSE, 0, 0);
-        glEnableVertexAttribArray(location);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        SceneObject theobject;
+        theobject.name           = mesh.shapes[shape].name;
+        theobject.first_index    = mesh.shapes[shape].first_index;
+        theobject.num_indices    = mesh.shapes[shape].num_indices;
+        theobject.rendering_mode = GL_TRIANGLES;
+        theobject.vertex_array_object_id = mesh.vertex_array_object_id;
+        theobject.base_vertex    = mesh.base_vertex;
+
+        g_VirtualScene[mesh.shapes[shape].name] = theobject;
     }
+}
+
+// Carrega todos os recursos do jogo. A leitura e decodificação dos arquivos é
+// feita pelas threads auxiliares (veja "jobs.cpp"), e somente a criação dos
+// objetos OpenGL é feita nesta thread. Cada recurso é uma sequência de etapas
+// dependentes; recursos diferentes avançam em paralelo, então o tempo total é
+// limitado pelo recurso mais lento, e não pela soma de todos.
+//
+// Esta função retorna quando shaders e modelos estão prontos. As texturas
+// continuam carregando em segundo plano (veja "textureloader.cpp"); até
+// ficarem prontas, uma textura provisória é utilizada.
+//
+// Retorna falso se algum modelo não pôde ser carregado. Um shader com erro
+// não interrompe o carregamento: na recarga, o programa anterior é mantido.
+bool LoadAssetsInParallel()
+{
+    // Etapas que ainda precisam terminar antes de retornarmos. Cada etapa
+    // submete a seguinte antes de terminar, mantendo o grupo aberto.
+    JobCounter pending;
+
+    // Nenhuma exceção pode sair de um job (o contador não seria
+    // decrementado): as etapas que falham apenas marcam esta variável.
+    std::atomic<bool> failed(false);
 
-    if ( !texture_coefficients.empty() )
+    // Shaders: os dois arquivos são lidos em paralelo, e o programa de GPU é
+    // criado quando ambos estiverem prontos.
+    struct ShaderSources
+    {
+        std::string       vertex;
+        std::string       fragment;
+        std::atomic<int>  remaining;
+        std::atomic<bool> ok;
+    };
+    std::shared_ptr<ShaderSources> sources = std::make_shared<ShaderSources>();
+    sources->remaining = 2;
+    sources->ok        = true;
+
+    std::function<void()> on_shader_read = [sources, &pending]
     {
-        GLuint VBO_texture_coefficients_id;
-        glGenBuffers(1, &VBO_texture_coefficients_id);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO_texture_coefficients_id);
-        glBufferData(GL_ARRAY_BUFFER, texture_coefficients.size() * sizeof(float), NULL, GL_STATIC_DRAW);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, texture_coefficients.size() * sizeof(float), texture_coefficients.data());
-        location = 2; // "(location = 1)" em "shader_vertex.glsl"
-        number_of_dimensions = 2; // vec2 em "shader_vertex.glsl"
-        glVertexAttribPointer(location, number_of_dimensions, GL_FLOAT, GL_FALSE, 0, 0);
-        glEnableVertexAttribArray(location);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (--sources->remaining == 0)
+        {
+            Jobs_SubmitMainThread([sources]
+            {
+                // Sem um programa anterior para manter, não há como continuar
+                if (!sources->ok)
+                {
+                    if (!g_GpuProgram.IsValid())
+                        std::exit(EXIT_FAILURE);
+                    fprintf(stderr, "ERROR: Shader reload failed; keeping the previous GPU program.\n");
+                    return;
+                }
+                BuildGpuProgramFromSources(sources->vertex, sources->fragment);
+            }, &pending);
+        }
+    };
+    Jobs_Submit([sources, on_shader_read]
+    {
+        if (!ReadShaderFile("../../src/shader_vertex.glsl", &sources->vertex))
+            sources->ok = false;
+        on_shader_read();
+    }, &pending);
+    Jobs_Submit([sources, on_shader_read]
+    {
+        if (!ReadShaderFile("../../src/shader_fragment.glsl", &sources->fragment))
+            sources->ok = false;
+        on_shader_read();
+    }, &pending);
+
+    // Texturas. As versões pré-processadas por "tools/cooker.cpp" (com os
+    // mipmaps prontos) têm preferência sobre as imagens originais. Ao
+    // recarregar, cada imagem volta para a mesma unidade.
+    g_NumLoadedTextures = 0;
+    TextureLoader_Request(CookedAssetPath("../../data/cooked/grass.ctex", "../../data/grass.jpg"), g_NumLoadedTextures++);
+    TextureLoader_Request(CookedAssetPath("../../data/cooked/wall.ctex", "../../data/wall.jpg"), g_NumLoadedTextures++);
+
+    // Modelos: os vértices são escritos diretamente na memória da GPU, sem
+    // cópias intermediárias. As etapas alternam entre as threads auxiliares
+    // (leitura do arquivo) e esta thread (mapeamento dos buffers).
+    const char* model_filenames[][2] = {
+        { "../../data/cooked/sphere.cmsh",  "../../data/sphere.obj"  },
+        { "../../data/cooked/plane.cmsh",   "../../data/plane.obj"   },
+        { "../../data/cooked/carrito.cmsh", "../../data/carrito.obj" },
+    };
+    for (size_t i = 0; i < sizeof(model_filenames) / sizeof(model_filenames[0]); ++i)
+    {
+        std::shared_ptr<StreamedMesh> mesh = std::make_shared<StreamedMesh>();
+
+        // Modelo pré-processado: basta copiá-lo para a GPU
+        const char* path = CookedAssetPath(model_filenames[i][0], model_filenames[i][1]);
+        if (path == model_filenames[i][0])
+        {
+            std::string filename = path;
+            printf("Carregando modelo \"%s\"...\n", filename.c_str());
+            Jobs_Submit([filename, mesh, &pending, &failed]
+            {
+                CookedMeshLoad* load = CookedMesh_Read(filename.c_str());
+                Jobs_SubmitMainThread([load, mesh, &failed]
+                {
+                    try
+                    {
+                        CookedMesh_Upload(load, mesh.get());
+                        AddStreamedMeshToVirtualScene(*mesh);
+                    }
+                    catch (const std::runtime_error&)
+                    {
+                        failed = true;
+                    }
+                }, &pending);
+            }, &pending);
+            continue;
+        }
+
+        std::string filename = path;
+        printf("Carregando modelo \"%s\"...\n", filename.c_str());
+        Jobs_Submit([filename, mesh, &pending, &failed]
+        {
+            ObjStreamLoad* load = ObjStream_Begin(filename.c_str());
+            Jobs_SubmitMainThread([load, mesh, &pending, &failed]
+            {
+                ObjStream_MapBuffers(load, mesh.get());
+                Jobs_Submit([load, mesh, &pending, &failed]
+                {
+                    ObjStream_Parse(load);
+                    Jobs_SubmitMainThread([load, mesh, &failed]
+                    {
+                        try
+                        {
+                            ObjStream_Finish(load, mesh.get());
+                            AddStreamedMeshToVirtualScene(*mesh);
+                        }
+                        catch (const std::runtime_error&)
+                        {
+                            failed = true;
+                        }
+                    }, &pending);
+                }, &pending);
+            }, &pending);
+        }, &pending);
     }
 
-    GLuint indices_id;
-    glGenBuffers(1, &indices_id);
+    // Executamos as etapas que precisam do contexto OpenGL à medida que as
+    // threads auxiliares as liberam, e ajudamos a ler e interpretar os
+    // arquivos enquanto isso.
+    Jobs_Wait(&pending);
+    return !failed;
+}
 
-    // "Ligamos" o buffer. Note que o tipo agora é GL_ELEMENT_ARRAY_BUFFER.
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indices_id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), NULL, GL_STATIC_DRAW);
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indices.size() * sizeof(GLuint), indices.data());
-    // glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0); // XXX Errado!
-    //
+// Retorna "cooked" se o asset pré-processado existe (no pacote ou no disco),
+// e "source" caso contrário. Durante uma recarga (F5), o original tem
+// preferência se foi editado depois do pré-processamento, ou se o
+// pré-processado só existe no pacote, para que a edição seja vista sem
+// rodar o "cooker" novamente.
+const char* CookedAssetPath(const char* cooked, const char* source)
+{
+    if (g_ReloadingAssets)
+    {
+        int64_t source_time = Asset_GetModificationTime(source);
+        if (source_time != 0 && source_time > Asset_GetModificationTime(cooked))
+            return source;
+    }
+    return Asset_Exists(cooked) ? cooked : source;
+}
+
+// Modelos ".obj" extras passados como argumento. Retorna falso se algum não
+// pôde ser carregado.
+bool LoadExtraModels()
+{
+    for (size_t i = 0; i < g_ExtraModelFilenames.size(); ++i)
+    {
+        try
+        {
+            ObjModel model(g_ExtraModelFilenames[i]);
+            BuildTrianglesAndAddToVirtualScene(&model);
+        }
+        catch (const std::runtime_error&)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Recarrega shaders, texturas e modelos, substituindo os atuais. Os arquivos
+// soltos no disco têm preferência sobre o pacote de assets, de modo que os
+// arquivos editados são vistos sem refazer o pacote (veja também
+// CookedAssetPath()).
+//
+// Os modelos novos são escritos em outros buffers compartilhados, que só
+// substituem os atuais se todos os modelos carregarem; caso contrário, são
+// descartados e g_VirtualScene volta ao estado anterior. Os objetos de
+// g_VirtualScene são atualizados no lugar (a fila de desenho continua
+// apontando para eles). Shaders e texturas com erro também mantêm as versões
+// anteriores. Os recursos substituídos são liberados, então a memória usada
+// na GPU não cresce a cada recarga.
+void ReloadAssets()
+{
+    printf("Recarregando assets...\n");
+
+    // Cópia para desfazer a recarga. Os objetos são marcados com o VAO 0 para
+    // sabermos quais foram recarregados.
+    std::map<std::string, SceneObject> previous_scene = g_VirtualScene;
+    for (std::map<std::string, SceneObject>::iterator it = g_VirtualScene.begin(); it != g_VirtualScene.end(); ++it)
+        it->second.vertex_array_object_id = 0;
+
+    // A partir da primeira recarga, os arquivos soltos continuam com
+    // preferência, pois as texturas terminam de carregar depois que esta
+    // função retorna
+    Archive_SetPreferLooseFiles(true);
 
-    // "Desligamos" o VAO, evitando assim que operações posteriores venham a
-    // alterar o mesmo. Isso evita bugs.
-    glBindVertexArray(0);
+    g_ReloadingAssets = true;
+    MeshPool_BeginReload();
+
+    bool ok = LoadAssetsInParallel();
+    ok = LoadExtraModels() && ok;
+
+    g_ReloadingAssets = false;
+
+    // Um objeto que deixou de existir nos arquivos continuaria apontando para
+    // os buffers antigos
+    for (std::map<std::string, SceneObject>::iterator it = g_VirtualScene.begin(); ok && it != g_VirtualScene.end(); ++it)
+    {
+        if (it->second.vertex_array_object_id == 0)
+        {
+            fprintf(stderr, "ERROR: Reloaded models no longer define \"%s\".\n", it->first.c_str());
+            ok = false;
+        }
+    }
+
+    if (ok)
+    {
+        MeshPool_CommitReload();
+    }
+    else
+    {
+        MeshPool_CancelReload();
+
+        // Restauramos os objetos anteriores nos mesmos nós do std::map e
+        // removemos os que a recarga adicionou
+        for (std::map<std::string, SceneObject>::iterator it = g_VirtualScene.begin(); it != g_VirtualScene.end(); )
+        {
+            std::map<std::string, SceneObject>::iterator previous = previous_scene.find(it->first);
+            if (previous == previous_scene.end())
+            {
+                it = g_VirtualScene.erase(it);
+                continue;
+            }
+            it->second = previous->second;
+            ++it;
+        }
+        fprintf(stderr, "ERROR: Model reload failed; keeping the previous models.\n");
+    }
+
+    GpuResources_PrintSummary();
 }
 
 // Carrega um Vertex Shader de um arquivo GLSL. Veja definição de LoadShader() abaixo.
@@ -1169,22 +1425,33 @@ GLuint LoadShader_Fragment(const char* filename)
 // um arquivo GLSL e faz sua compilação.
 void LoadShader(const char* filename, GLuint shader_id)
 {
-    // Lemos o arquivo de texto indicado pela variável "filename"
-    // e colocamos seu conteúdo em memória, apontado pela variável
-    // "shader_string".
-    std::ifstream file;
-    try {
-        file.exceptions(std::ifstream::failbit);
-        file.open(filename);
-    } catch ( std::exception& e ) {
-        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+    std::string source;
+    if (!ReadShaderFile(filename, &source))
         std::exit(EXIT_FAILURE);
+    CompileShader(filename, source, shader_id);
+}
+
+// Lê o arquivo de texto indicado pela variável "filename" para "source".
+// Retorna falso (após imprimir o erro) se o arquivo não existe. Pode ser
+// chamada por qualquer thread, pois não utiliza OpenGL.
+bool ReadShaderFile(const char* filename, std::string* source)
+{
+    AssetFile file;
+    if (!Asset_Load(filename, &file))
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
     }
-    std::stringstream shader;
-    shader << file.rdbuf();
-    std::string str = shader.str();
-    const GLchar* shader_string = str.c_str();
-    const GLint   shader_string_length = static_cast<GLint>( str.length() );
+    source->assign(file.data, file.size);
+    return true;
+}
+
+// Compila o código GLSL contido em "source". O nome do arquivo é utilizado
+// somente nas mensagens de erro.
+void CompileShader(const char* filename, const std::string& source, GLuint shader_id)
+{
+    const GLchar* shader_string = source.c_str();
+    const GLint   shader_string_length = static_cast<GLint>( source.length() );
 
     // Define o código do shader GLSL, contido na string "shader_string"
     glShaderSource(shader_id, 1, &shader_string, &shader_string_length);
@@ -1236,64 +1503,10 @@ void LoadShader(const char* filename, GLuint shader_id)
 }
 
 
-void LoadTextureImage(const char* filename)
-{
-    printf("Carregando imagem \"%s\"... ", filename);
-
-    // Primeiro fazemos a leitura da imagem do disco
-    stbi_set_flip_vertically_on_load(true);
-    int width;
-    int height;
-    int channels;
-    unsigned char *data = stbi_load(filename, &width, &height, &channels, 3);
-
-    if ( data == NULL )
-    {
-        fprintf(stderr, "ERROR: Cannot open image file \"%s\".\n", filename);
-        std::exit(EXIT_FAILURE);
-    }
-
-    printf("OK (%dx%d).\n", width, height);
-
-    // Agora criamos objetos na GPU com OpenGL para armazenar a textura
-    GLuint texture_id;
-    GLuint sampler_id;
-    glGenTextures(1, &texture_id);
-    glGenSamplers(1, &sampler_id);
-
-    // Veja slides 95-96 do documento Aula_20_Mapeamento_de_Texturas.pdf
-    glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
-    glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
-
-    // Parâmetros de amostragem da textura.
-    glSamplerParameteri(sampler_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glSamplerParameteri(sampler_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    // Agora enviamos a imagem lida do disco para a GPU
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
-    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-
-    GLuint textureunit = g_NumLoadedTextures;
-    glActiveTexture(GL_TEXTURE0 + textureunit);
-    glBindTexture(GL_TEXTURE_2D, texture_id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-    glGenerateMipmap(GL_TEXTURE_2D);
-    glBindSampler(textureunit, sampler_id);
-
-    stbi_image_free(data);
-
-    g_NumLoadedTextures += 1;
-}
-
-// Esta função cria um programa de GPU, o qual contém obrigatoriamente um
-// Vertex Shader e um Fragment Shader.
-GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id)
+// Liga os dois shaders ao programa "program_id" e o linka. Retorna falso
+// (após imprimir o log) se a linkagem falhar.
+static bool LinkGpuProgram(GLuint program_id, GLuint vertex_shader_id, GLuint fragment_shader_id)
 {
-    // Criamos um identificador (ID) para este programa de GPU
-    GLuint program_id = glCreateProgram();
-
     // Definição dos dois shaders GLSL que devem ser executados pelo programa
     glAttachShader(program_id, vertex_shader_id);
     glAttachShader(program_id, fragment_shader_id);
@@ -1334,10 +1547,33 @@ GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id)
     glDeleteShader(vertex_shader_id);
     glDeleteShader(fragment_shader_id);
 
+    return linked_ok != GL_FALSE;
+}
+
+// Esta função cria um programa de GPU, o qual contém obrigatoriamente um
+// Vertex Shader e um Fragment Shader.
+GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id)
+{
+    // Criamos um identificador (ID) para este programa de GPU
+    GLuint program_id = glCreateProgram();
+
+    LinkGpuProgram(program_id, vertex_shader_id, fragment_shader_id);
+
     // Retornamos o ID gerado acima
     return program_id;
 }
 
+// Como CreateGpuProgram(), mas o programa pertence a um handle registrado,
+// e um programa que não foi linkado não é retornado
+GpuProgram CreateTrackedGpuProgram(const char* name, GLuint vertex_shader_id, GLuint fragment_shader_id)
+{
+    GpuProgram program;
+    program.Create(name);
+    if (!LinkGpuProgram(program.Get(), vertex_shader_id, fragment_shader_id))
+        program.Reset();
+    return program;
+}
+
 // Definição da função que será chamada sempre que o usuário pressionar alguma
 // tecla do teclado. Veja http://www.glfw.org/docs/latest/input_guide.html#input_key
 void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mod)
@@ -1346,6 +1582,30 @@ void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mod)
     if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS)
         glfwSetWindowShouldClose(window, GL_TRUE);
 
+    // Se o usuário apertar a tecla F1, mostramos/escondemos os tempos do profiler.
+    if (key == GLFW_KEY_F1 && action == GLFW_PRESS)
+        Profiler_ToggleOverlay();
+
+    // Se o usuário apertar a tecla F2, salvamos os últimos quadros medidos pelo
+    // profiler, para análise em chrome://tracing.
+    if (key == GLFW_KEY_F2 && action == GLFW_PRESS)
+        Profiler_ExportTrace("profiler_trace.json");
+
+    // Se o usuário apertar a tecla F3, mostramos/escondemos o gráfico dos
+    // tempos de quadro.
+    if (key == GLFW_KEY_F3 && action == GLFW_PRESS)
+        FrameTime_ToggleGraph();
+
+    // Se o usuário apertar a tecla F5, recarregamos shaders, texturas e
+    // modelos, sem reiniciar a partida.
+    if (key == GLFW_KEY_F5 && action == GLFW_PRESS)
+        ReloadAssets();
+
+    // Durante a reprodução de uma gravação, os carros e câmeras são
+    // controlados pelo arquivo, e durante o benchmark pelos caminhos fixos
+    if (InputReplay_IsReplaying() || Flythrough_IsActive())
+        return;
+
     // Se o usuário apertar a tecla W, o carro anda pra frente.
     if (key == GLFW_KEY_W && action == GLFW_PRESS)
     {
@@ -1540,6 +1800,7 @@ void TextRendering_ShowFramesPerSecond(GLFWwindow* window)
     static int   ellapsed_frames = 0;
     static char  buffer[20] = "?? fps";
     static int   numchars = 7;
+    static int   text_id = TextRendering_CreateText();
 
     ellapsed_frames += 1;
 
@@ -1560,7 +1821,10 @@ void TextRendering_ShowFramesPerSecond(GLFWwindow* window)
     float lineheight = TextRendering_LineHeight(window);
     float charwidth = TextRendering_CharWidth(window);
 
-    TextRendering_PrintString(window, buffer, 1.0f-(numchars + 1)*charwidth, 1.0f-lineheight, 1.0f);
+    // O texto só é refeito quando o valor muda (uma vez por segundo) ou a
+    // janela é redimensionada
+    TextRendering_SetText(text_id, buffer, 1.0f-(numchars + 1)*charwidth, 1.0f-lineheight, 1.0f);
+    TextRendering_DrawText(text_id);
 }
 
 // Função para debugging: imprime no terminal todas informações de um modelo
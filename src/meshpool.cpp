@@ -0,0 +1,204 @@
+#include "../include/meshpool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "../include/cookedformat.hpp"
+#include "../include/gpuresources.hpp"
+#include "../include/objstream.hpp"
+
+struct MeshPool
+{
+    GpuVertexArray vertex_array;
+    GpuBuffer      vertex_buffer;
+    GpuBuffer      index_buffer;
+    size_t num_vertices;
+    size_t vertex_capacity;
+    size_t num_indices;
+    size_t index_capacity;
+};
+
+static MeshPool g_MeshPools[MESH_NUM_FORMATS];
+
+// Buffers em construção durante uma recarga (veja MeshPool_BeginReload())
+static MeshPool g_ReloadPools[MESH_NUM_FORMATS];
+static bool     g_Reloading = false;
+
+static size_t VertexSize(MeshFormat format)
+{
+    return format == MESH_FORMAT_COOKED ? sizeof(CookedVertex) : sizeof(StreamedVertex);
+}
+
+// Configura os atributos do VAO (ligado) para o buffer em GL_ARRAY_BUFFER,
+// com as "locations" de "shader_vertex.glsl"
+static void SetVertexAttributes(MeshFormat format)
+{
+    if (format == MESH_FORMAT_COOKED)
+    {
+        // Atributos quantizados: o OpenGL converte para float ao ler, e o
+        // "w" = 1 da posição é preenchido automaticamente.
+        const GLsizei stride = sizeof(CookedVertex);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(CookedVertex, position));
+        glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void*)offsetof(CookedVertex, normal));
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride, (void*)offsetof(CookedVertex, texcoord));
+    }
+    else
+    {
+        const GLsizei stride = sizeof(StreamedVertex);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(StreamedVertex, position));
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(StreamedVertex, normal));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(StreamedVertex, texcoord));
+    }
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+}
+
+// Troca "*buffer" por um buffer de "new_size" bytes, copiando os
+// "used_size" primeiros bytes do anterior, que é liberado
+static void GrowBuffer(GpuBuffer* buffer, const char* name, size_t used_size, size_t new_size)
+{
+    GpuBuffer new_buffer;
+    new_buffer.Create(name);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, new_buffer.Get());
+    glBufferData(GL_COPY_WRITE_BUFFER, new_size, NULL, GL_STATIC_DRAW);
+    new_buffer.SetSize(new_size);
+
+    if (buffer->IsValid() && used_size > 0)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, buffer->Get());
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, used_size);
+    }
+    *buffer = std::move(new_buffer);
+}
+
+// Garante espaço para mais "num_vertices" vértices e "num_indices" índices
+static MeshPool& Reserve(MeshFormat format, size_t num_vertices, size_t num_indices)
+{
+    MeshPool& pool = g_Reloading ? g_ReloadPools[format] : g_MeshPools[format];
+    size_t vertex_size = VertexSize(format);
+
+    bool grew = false;
+    if (pool.num_vertices + num_vertices > pool.vertex_capacity)
+    {
+        size_t capacity = std::max(pool.num_vertices + num_vertices, std::max(2 * pool.vertex_capacity, (size_t)MESHPOOL_INITIAL_VERTICES));
+        GrowBuffer(&pool.vertex_buffer, "meshpool vertices", pool.num_vertices * vertex_size, capacity * vertex_size);
+        pool.vertex_capacity = capacity;
+        grew = true;
+    }
+    if (pool.num_indices + num_indices > pool.index_capacity)
+    {
+        size_t capacity = std::max(pool.num_indices + num_indices, std::max(2 * pool.index_capacity, (size_t)MESHPOOL_INITIAL_INDICES));
+        GrowBuffer(&pool.index_buffer, "meshpool indices", pool.num_indices * sizeof(uint32_t), capacity * sizeof(uint32_t));
+        pool.index_capacity = capacity;
+        grew = true;
+    }
+
+    // O VAO passa a apontar para os buffers novos
+    if (grew)
+    {
+        if (!pool.vertex_array.IsValid())
+            pool.vertex_array.Create("meshpool");
+
+        glBindVertexArray(pool.vertex_array.Get());
+        glBindBuffer(GL_ARRAY_BUFFER, pool.vertex_buffer.Get());
+        SetVertexAttributes(format);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool.index_buffer.Get());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+    return pool;
+}
+
+static MeshAllocation Allocate(MeshPool& pool, size_t num_vertices, size_t num_indices)
+{
+    MeshAllocation allocation;
+    allocation.vertex_array_object_id = pool.vertex_array.Get();
+    allocation.base_vertex            = (GLint)pool.num_vertices;
+    allocation.first_index            = pool.num_indices;
+
+    pool.num_vertices += num_vertices;
+    pool.num_indices  += num_indices;
+    return allocation;
+}
+
+MeshAllocation MeshPool_Upload(MeshFormat format, const void* vertices, size_t num_vertices, const uint32_t* indices, size_t num_indices)
+{
+    MeshPool& pool = Reserve(format, num_vertices, num_indices);
+    size_t vertex_size = VertexSize(format);
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, pool.vertex_buffer.Get());
+    glBufferSubData(GL_COPY_WRITE_BUFFER, pool.num_vertices * vertex_size, num_vertices * vertex_size, vertices);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, pool.index_buffer.Get());
+    glBufferSubData(GL_COPY_WRITE_BUFFER, pool.num_indices * sizeof(uint32_t), num_indices * sizeof(uint32_t), indices);
+
+    return Allocate(pool, num_vertices, num_indices);
+}
+
+MeshAllocation MeshPool_CopyFromBuffers(MeshFormat format, GLuint vertex_buffer_id, size_t num_vertices, GLuint index_buffer_id, size_t num_indices)
+{
+    MeshPool& pool = Reserve(format, num_vertices, num_indices);
+    size_t vertex_size = VertexSize(format);
+
+    if (num_vertices > 0)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, vertex_buffer_id);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, pool.vertex_buffer.Get());
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, pool.num_vertices * vertex_size, num_vertices * vertex_size);
+    }
+    if (num_indices > 0)
+    {
+        glBindBuffer(GL_COPY_READ_BUFFER, index_buffer_id);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, pool.index_buffer.Get());
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, pool.num_indices * sizeof(uint32_t), num_indices * sizeof(uint32_t));
+    }
+
+    return Allocate(pool, num_vertices, num_indices);
+}
+
+static void ClearPool(MeshPool& pool)
+{
+    pool.vertex_array.Reset();
+    pool.vertex_buffer.Reset();
+    pool.index_buffer.Reset();
+    pool.num_vertices    = 0;
+    pool.vertex_capacity = 0;
+    pool.num_indices     = 0;
+    pool.index_capacity  = 0;
+}
+
+void MeshPool_BeginReload()
+{
+    for (int i = 0; i < MESH_NUM_FORMATS; ++i)
+        ClearPool(g_ReloadPools[i]);
+    g_Reloading = true;
+}
+
+void MeshPool_CommitReload()
+{
+    // A atribuição dos handles libera os buffers anteriores
+    for (int i = 0; i < MESH_NUM_FORMATS; ++i)
+    {
+        g_MeshPools[i] = std::move(g_ReloadPools[i]);
+        ClearPool(g_ReloadPools[i]);
+    }
+    g_Reloading = false;
+}
+
+void MeshPool_CancelReload()
+{
+    for (int i = 0; i < MESH_NUM_FORMATS; ++i)
+        ClearPool(g_ReloadPools[i]);
+    g_Reloading = false;
+}
+
+void MeshPool_Shutdown()
+{
+    for (int i = 0; i < MESH_NUM_FORMATS; ++i)
+    {
+        ClearPool(g_MeshPools[i]);
+        ClearPool(g_ReloadPools[i]);
+    }
+    g_Reloading = false;
+}
@@ -0,0 +1,306 @@
+#include "../include/normals.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+#include "../include/glm/vec3.hpp"
+#include "../include/glm/geometric.hpp"
+
+#ifndef NORMALS_SERIAL
+#include "../include/jobs.hpp"
+#endif
+
+// Abaixo deste número de triângulos por parte não vale a pena dividir o
+// trabalho
+#define NORMALS_MIN_TRIANGLES_PER_THREAD 4096
+
+NormalsOptions Normals_DefaultOptions()
+{
+    NormalsOptions options;
+    options.weighting       = NORMALS_WEIGHT_AREA;
+    options.smoothing_angle = 0.0f;
+    options.weld            = false;
+    options.weld_epsilon    = 1e-5f;
+    options.num_threads     = 0;
+    return options;
+}
+
+// Executa fn(part, begin, end) dividindo o intervalo [0, count) em
+// num_parts partes, executadas como tarefas de "jobs.cpp". Também é chamada
+// de dentro de tarefas (ObjStream_Parse()): Jobs_ParallelFor() executa
+// tarefas enquanto espera, sem criar threads. Compilado com -DNORMALS_SERIAL
+// (o "cooker", que não usa o sistema de tarefas), tudo executa aqui mesmo.
+template <typename Function>
+static void ParallelFor(unsigned int num_parts, size_t count, Function fn)
+{
+#ifndef NORMALS_SERIAL
+    if (num_parts > 1)
+    {
+        size_t chunk = (count + num_parts - 1) / num_parts;
+        Jobs_ParallelFor((int)num_parts, 1, [&](int begin, int end)
+        {
+            for (int part = begin; part < end; ++part)
+            {
+                size_t first = std::min(count, part * chunk);
+                fn((unsigned int)part, first, std::min(count, first + chunk));
+            }
+        });
+        return;
+    }
+#else
+    (void)num_parts;
+#endif
+    fn(0u, (size_t)0, count);
+}
+
+// Célula da grade de solda que contém "value". As coordenadas são inteiros
+// de 64 bits, limitados para que posições enormes (ou NaN) não estourem a
+// conversão.
+static int64_t WeldCell(float value, double inverse)
+{
+    const double limit = 4e18;
+    double cell = std::floor(value * inverse);
+    if (!(cell >= -limit))
+        cell = -limit;
+    if (cell > limit)
+        cell = limit;
+    return (int64_t)cell;
+}
+
+// Agrupa posições coincidentes, retornando para cada posição o índice do seu
+// representante: a primeira posição a menos de "epsilon" dela. Usamos uma
+// grade de células de tamanho "epsilon"; duas posições próximas podem estar
+// em células vizinhas, então verificamos as 3x3x3 células ao redor.
+static void WeldPositions(const float* positions, size_t num_positions, float epsilon, std::vector<GLuint>* remap)
+{
+    struct Cell
+    {
+        int64_t x, y, z;
+        bool operator==(const Cell& other) const { return x == other.x && y == other.y && z == other.z; }
+    };
+    struct CellHash
+    {
+        size_t operator()(const Cell& c) const
+        {
+            return (size_t)((uint64_t)c.x * 73856093u ^ (uint64_t)c.y * 19349663u ^ (uint64_t)c.z * 83492791u);
+        }
+    };
+
+    // Primeiro representante de cada célula; os demais da mesma célula
+    // formam uma lista em "next"
+    const GLuint none = (GLuint)-1;
+    std::unordered_map<Cell, GLuint, CellHash> cells;
+    cells.reserve(num_positions);
+    std::vector<GLuint> next(num_positions, none);
+    remap->resize(num_positions);
+
+    double inverse = 1.0 / epsilon;
+    float  epsilon2 = epsilon * epsilon;
+    for (size_t i = 0; i < num_positions; ++i)
+    {
+        const float* p = &positions[3*i];
+        Cell cell = { WeldCell(p[0], inverse), WeldCell(p[1], inverse), WeldCell(p[2], inverse) };
+
+        GLuint found = none;
+        for (int dx = -1; dx <= 1 && found == none; ++dx)
+        for (int dy = -1; dy <= 1 && found == none; ++dy)
+        for (int dz = -1; dz <= 1 && found == none; ++dz)
+        {
+            Cell neighbor = { cell.x + dx, cell.y + dy, cell.z + dz };
+            std::unordered_map<Cell, GLuint, CellHash>::const_iterator it = cells.find(neighbor);
+            for (GLuint r = it != cells.end() ? it->second : none; r != none; r = next[r])
+            {
+                const float* q = &positions[3*r];
+                float ex = p[0] - q[0], ey = p[1] - q[1], ez = p[2] - q[2];
+                if (ex*ex + ey*ey + ez*ez <= epsilon2)
+                {
+                    found = r;
+                    break;
+                }
+            }
+        }
+
+        if (found != none)
+        {
+            (*remap)[i] = found;
+            continue;
+        }
+
+        // Novo representante, no início da lista da sua célula
+        std::pair<std::unordered_map<Cell, GLuint, CellHash>::iterator, bool> it =
+            cells.insert(std::make_pair(cell, (GLuint)i));
+        if (!it.second)
+        {
+            next[i] = it.first->second;
+            it.first->second = (GLuint)i;
+        }
+        (*remap)[i] = (GLuint)i;
+    }
+}
+
+// Ângulo interno do triângulo no vértice "a"
+static float CornerAngle(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+    glm::vec3 u = b - a;
+    glm::vec3 v = c - a;
+    float lu = glm::length(u);
+    float lv = glm::length(v);
+    if (lu == 0.0f || lv == 0.0f)
+        return 0.0f;
+    float cosine = glm::dot(u, v) / (lu * lv);
+    return std::acos(std::max(-1.0f, std::min(1.0f, cosine)));
+}
+
+void Normals_Compute(
+    const float*  positions,
+    size_t        num_positions,
+    const GLuint* triangle_positions,
+    size_t        num_triangles,
+    const NormalsOptions& options,
+    float*        out_normals,
+    size_t        out_stride
+)
+{
+    unsigned int num_threads = options.num_threads;
+    if (num_threads == 0)
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+#ifdef NORMALS_SERIAL
+    num_threads = 1; // Os buffers parciais abaixo seriam desperdiçados
+#endif
+    num_threads = (unsigned int)std::max<size_t>(1, std::min<size_t>(num_threads, num_triangles / NORMALS_MIN_TRIANGLES_PER_THREAD));
+
+    // Índice (possivelmente soldado) de cada canto
+    std::vector<GLuint> remap;
+    if (options.weld)
+        WeldPositions(positions, num_positions, options.weld_epsilon, &remap);
+
+    std::vector<GLuint> corners(3 * num_triangles);
+    for (size_t i = 0; i < corners.size(); ++i)
+        corners[i] = options.weld ? remap[triangle_positions[i]] : triangle_positions[i];
+
+    // Primeiro computamos a normal unitária de cada TRIÂNGULO e o peso de
+    // cada um de seus cantos.
+    std::vector<glm::vec3> face_normals(num_triangles);
+    std::vector<float>     corner_weights(3 * num_triangles);
+
+    ParallelFor(num_threads, num_triangles, [&](unsigned int, size_t begin, size_t end)
+    {
+        for (size_t t = begin; t < end; ++t)
+        {
+            glm::vec3 p[3];
+            for (size_t k = 0; k < 3; ++k)
+            {
+                const float* src = &positions[3 * triangle_positions[3*t + k]];
+                p[k] = glm::vec3(src[0], src[1], src[2]);
+            }
+
+            // Triângulo no sentido anti-horário; o comprimento do produto
+            // vetorial é o dobro da área.
+            glm::vec3 n = glm::cross(p[1] - p[0], p[2] - p[0]);
+            float double_area = glm::length(n);
+            face_normals[t] = double_area > 0.0f ? n / double_area : glm::vec3(0.0f);
+
+            for (size_t k = 0; k < 3; ++k)
+            {
+                float weight = 1.0f;
+                if (options.weighting == NORMALS_WEIGHT_AREA)
+                    weight = double_area;
+                else if (options.weighting == NORMALS_WEIGHT_ANGLE)
+                    weight = CornerAngle(p[k], p[(k+1)%3], p[(k+2)%3]);
+                corner_weights[3*t + k] = weight;
+            }
+        }
+    });
+
+    if (options.smoothing_angle <= 0.0f)
+    {
+        // Sem divisão por ângulo: a normal de cada VÉRTICE é a média
+        // ponderada das normais das faces que o compartilham. Cada thread
+        // acumula em seu próprio buffer, evitando sincronização; os buffers
+        // são somados em seguida.
+        std::vector< std::vector<glm::vec3> > partial(num_threads);
+
+        ParallelFor(num_threads, num_triangles, [&](unsigned int thread, size_t begin, size_t end)
+        {
+            std::vector<glm::vec3>& accumulator = partial[thread];
+            accumulator.assign(num_positions, glm::vec3(0.0f));
+            for (size_t t = begin; t < end; ++t)
+                for (size_t k = 0; k < 3; ++k)
+                    accumulator[corners[3*t + k]] += corner_weights[3*t + k] * face_normals[t];
+        });
+
+        std::vector<glm::vec3>& vertex_normals = partial[0];
+        ParallelFor(num_threads, num_positions, [&](unsigned int, size_t begin, size_t end)
+        {
+            for (size_t v = begin; v < end; ++v)
+            {
+                glm::vec3 sum = vertex_normals[v];
+                for (size_t thread = 1; thread < partial.size(); ++thread)
+                    sum += partial[thread][v];
+                float length = glm::length(sum);
+                vertex_normals[v] = length > 0.0f ? sum / length : glm::vec3(0.0f);
+            }
+        });
+
+        ParallelFor(num_threads, corners.size(), [&](unsigned int, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                float* dst = (float*)((char*)out_normals + i * out_stride);
+                const glm::vec3& n = vertex_normals[corners[i]];
+                dst[0] = n.x;
+                dst[1] = n.y;
+                dst[2] = n.z;
+            }
+        });
+        return;
+    }
+
+    // Com divisão por ângulo a normal depende do canto: somamos apenas as
+    // faces vizinhas cuja normal forma um ângulo menor que smoothing_angle
+    // com a face do canto. Para isso construímos a lista de triângulos
+    // incidentes em cada vértice (formato CSR).
+    std::vector<GLuint> offsets(num_positions + 1, 0);
+    for (size_t i = 0; i < corners.size(); ++i)
+        offsets[corners[i] + 1] += 1;
+    for (size_t v = 0; v < num_positions; ++v)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<GLuint> incident(corners.size());
+    std::vector<GLuint> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < corners.size(); ++i)
+        incident[fill[corners[i]]++] = (GLuint)i;
+
+    const float cos_threshold = std::cos(options.smoothing_angle);
+
+    ParallelFor(num_threads, num_triangles, [&](unsigned int, size_t begin, size_t end)
+    {
+        for (size_t t = begin; t < end; ++t)
+        {
+            for (size_t k = 0; k < 3; ++k)
+            {
+                GLuint vertex = corners[3*t + k];
+                glm::vec3 sum(0.0f);
+                for (GLuint j = offsets[vertex]; j < offsets[vertex + 1]; ++j)
+                {
+                    GLuint other = incident[j];
+                    const glm::vec3& other_normal = face_normals[other / 3];
+                    if (glm::dot(other_normal, face_normals[t]) >= cos_threshold)
+                        sum += corner_weights[other] * other_normal;
+                }
+
+                float length = glm::length(sum);
+                glm::vec3 n = length > 0.0f ? sum / length : face_normals[t];
+
+                float* dst = (float*)((char*)out_normals + (3*t + k) * out_stride);
+                dst[0] = n.x;
+                dst[1] = n.y;
+                dst[2] = n.z;
+            }
+        }
+    });
+}
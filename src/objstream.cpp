@@ -0,0 +1,408 @@
+#include "../include/objstream.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "../include/glad/glad.h"
+#include "../include/archive.hpp"
+#include "../include/gpuresources.hpp"
+#include "../include/meshpool.hpp"
+#include "../include/normals.hpp"
+#include "../include/tiny_obj_loader.h"
+
+// Estado de um carregamento em andamento. Também é o estado compartilhado
+// entre as funções de callback da tinyobjloader.
+struct ObjStreamLoad
+{
+    std::string filename;
+
+    // Conteúdo do arquivo (no pacote de assets ou lido do disco), usado pela
+    // pré-leitura e pela leitura das faces
+    AssetFile file;
+
+    // Resultado da pré-leitura
+    size_t num_positions;
+    size_t num_normals;
+    size_t num_texcoords;
+    size_t num_corners;
+
+    // Falso se alguma etapa falhou; "err" contém a mensagem
+    bool        ok;
+    std::string err;
+
+    // Atributos "v", "vn" e "vt" do arquivo. Estes são necessários pois as
+    // faces referenciam os atributos por índice.
+    std::vector<float> positions;
+    std::vector<float> normals;
+    std::vector<float> texcoords;
+
+    // Buffers temporários da GPU, liberados por ObjStream_Finish(), e a sua
+    // memória mapeada
+    GpuBuffer       vertex_buffer;
+    GpuBuffer       index_buffer;
+    StreamedVertex* vertices;
+    GLuint*         indices;
+    size_t          capacity;    // Número de vértices reservados na pré-leitura
+    size_t          num_written; // Número de vértices já gravados
+
+    // Para cada vértice gravado, o índice da sua posição. Só é utilizado
+    // quando o arquivo não possui normais e precisamos computá-las no final.
+    bool                  needs_normals;
+    std::vector<GLuint>   corner_positions;
+
+    std::vector<StreamedShape>  shapes;
+    std::string                 current_name;
+    size_t                      current_first;
+    bool                        overflow;
+    bool                        bad_index; // Face com índice fora dos limites
+};
+
+// Converte um índice "cru" do arquivo ".obj" (começando em 1, ou negativo
+// relativo ao final) para um índice começando em 0. Retorna -1 se ausente.
+static int ResolveObjIndex(int index, size_t count)
+{
+    if (index > 0)
+        return index - 1;
+    if (index < 0)
+        return (int)count + index;
+    return -1;
+}
+
+// Fecha o shape atual, caso ele possua algum triângulo.
+static void CloseCurrentShape(ObjStreamLoad* ctx)
+{
+    if (ctx->num_written > ctx->current_first)
+    {
+        StreamedShape shape;
+        shape.name        = ctx->current_name;
+        shape.first_index = ctx->current_first;
+        shape.num_indices = ctx->num_written - ctx->current_first;
+        ctx->shapes.push_back(shape);
+    }
+    ctx->current_first = ctx->num_written;
+}
+
+static void VertexCallback(void* user_data, float x, float y, float z, float /*w*/)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    ctx->positions.push_back(x);
+    ctx->positions.push_back(y);
+    ctx->positions.push_back(z);
+}
+
+static void NormalCallback(void* user_data, float x, float y, float z)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    ctx->normals.push_back(x);
+    ctx->normals.push_back(y);
+    ctx->normals.push_back(z);
+}
+
+static void TexcoordCallback(void* user_data, float x, float y, float /*z*/)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    ctx->texcoords.push_back(x);
+    ctx->texcoords.push_back(y);
+}
+
+// Grava um vértice final (já desindexado) na memória mapeada.
+static void WriteCorner(ObjStreamLoad* ctx, const tinyobj::index_t& raw)
+{
+    if (ctx->num_written >= ctx->capacity)
+    {
+        ctx->overflow = true;
+        return;
+    }
+
+    int v  = ResolveObjIndex(raw.vertex_index, ctx->positions.size() / 3);
+    int vn = ResolveObjIndex(raw.normal_index, ctx->normals.size() / 3);
+    int vt = ResolveObjIndex(raw.texcoord_index, ctx->texcoords.size() / 2);
+
+    // Índices fora dos limites (arquivo corrompido) invalidam o modelo. Um
+    // índice 0 indica normal ou coordenada de textura ausente.
+    bool has_normal   = raw.normal_index != 0;
+    bool has_texcoord = raw.texcoord_index != 0;
+    if (v < 0 || 3*(size_t)v >= ctx->positions.size()
+        || (has_normal && (vn < 0 || 3*(size_t)vn >= ctx->normals.size()))
+        || (has_texcoord && (vt < 0 || 2*(size_t)vt >= ctx->texcoords.size())))
+    {
+        ctx->bad_index = true;
+        return;
+    }
+
+    StreamedVertex vertex;
+    vertex.position[0] = ctx->positions[3*v + 0];
+    vertex.position[1] = ctx->positions[3*v + 1];
+    vertex.position[2] = ctx->positions[3*v + 2];
+    vertex.position[3] = 1.0f;
+
+    if (has_normal)
+    {
+        vertex.normal[0] = ctx->normals[3*vn + 0];
+        vertex.normal[1] = ctx->normals[3*vn + 1];
+        vertex.normal[2] = ctx->normals[3*vn + 2];
+    }
+    else
+    {
+        vertex.normal[0] = vertex.normal[1] = vertex.normal[2] = 0.0f;
+    }
+    vertex.normal[3] = 0.0f;
+
+    if (has_texcoord)
+    {
+        vertex.texcoord[0] = ctx->texcoords[2*vt + 0];
+        vertex.texcoord[1] = ctx->texcoords[2*vt + 1];
+    }
+    else
+    {
+        vertex.texcoord[0] = vertex.texcoord[1] = 0.0f;
+    }
+
+    // Escrita sequencial em memória mapeada (nunca lemos desta memória)
+    ctx->vertices[ctx->num_written] = vertex;
+    ctx->indices[ctx->num_written] = (GLuint)ctx->num_written;
+
+    if (ctx->needs_normals)
+        ctx->corner_positions.push_back((GLuint)v);
+
+    ctx->num_written += 1;
+}
+
+// Chamada para cada linha "f". Polígonos são triangulados em leque.
+static void IndexCallback(void* user_data, tinyobj::index_t* indices, int num_indices)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    for (int i = 1; i + 1 < num_indices; ++i)
+    {
+        WriteCorner(ctx, indices[0]);
+        WriteCorner(ctx, indices[i]);
+        WriteCorner(ctx, indices[i + 1]);
+    }
+}
+
+static void GroupCallback(void* user_data, const char** names, int num_names)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    CloseCurrentShape(ctx);
+    ctx->current_name = num_names > 0 ? names[0] : "";
+}
+
+static void ObjectCallback(void* user_data, const char* name)
+{
+    ObjStreamLoad* ctx = (ObjStreamLoad*)user_data;
+    CloseCurrentShape(ctx);
+    ctx->current_name = name;
+}
+
+// Pré-leitura do arquivo: conta atributos e vértices finais (após
+// triangulação) para reservarmos a memória exata, tanto na CPU quanto na GPU.
+static void PrescanObj(std::istream& in, size_t* num_positions, size_t* num_normals, size_t* num_texcoords, size_t* num_corners)
+{
+    *num_positions = *num_normals = *num_texcoords = *num_corners = 0;
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        const char* token = line.c_str();
+        token += strspn(token, " \t");
+
+        if (token[0] == 'v' && (token[1] == ' ' || token[1] == '\t'))
+            *num_positions += 1;
+        else if (token[0] == 'v' && token[1] == 'n')
+            *num_normals += 1;
+        else if (token[0] == 'v' && token[1] == 't')
+            *num_texcoords += 1;
+        else if (token[0] == 'f' && (token[1] == ' ' || token[1] == '\t'))
+        {
+            size_t num_face_vertices = 0;
+            token += 1;
+            while (*token != '\0')
+            {
+                token += strspn(token, " \t\r");
+                if (*token == '\0')
+                    break;
+                num_face_vertices += 1;
+                token += strcspn(token, " \t\r");
+            }
+            if (num_face_vertices >= 3)
+                *num_corners += 3 * (num_face_vertices - 2);
+        }
+    }
+}
+
+// Computa as normais (veja "normals.cpp") e as grava diretamente na memória
+// mapeada, no campo "normal" de cada vértice.
+static void ComputeStreamedNormals(ObjStreamLoad* ctx)
+{
+    NormalsOptions options = Normals_DefaultOptions();
+    Normals_Compute(
+        ctx->positions.data(), ctx->positions.size() / 3,
+        ctx->corner_positions.data(), ctx->corner_positions.size() / 3,
+        options,
+        ctx->vertices[0].normal, sizeof(StreamedVertex)
+    );
+}
+
+ObjStreamLoad* ObjStream_Begin(const char* filename)
+{
+    ObjStreamLoad* load = new ObjStreamLoad();
+    load->filename      = filename;
+    load->ok            = true;
+    load->vertices      = NULL;
+    load->indices       = NULL;
+    load->capacity      = 0;
+    load->num_written   = 0;
+    load->needs_normals = false;
+    load->current_first = 0;
+    load->overflow      = false;
+    load->bad_index     = false;
+
+    if (!Asset_Load(filename, &load->file))
+    {
+        load->ok  = false;
+        load->err = "ERROR: Cannot open file \"" + load->filename + "\".";
+        return load;
+    }
+
+    AssetStream file(load->file);
+    PrescanObj(file, &load->num_positions, &load->num_normals, &load->num_texcoords, &load->num_corners);
+    load->capacity = load->num_corners;
+    return load;
+}
+
+void ObjStream_MapBuffers(ObjStreamLoad* load, StreamedMesh* mesh)
+{
+    size_t num_corners = load->ok ? load->num_corners : 0;
+
+    // Criamos os buffers já com o tamanho final e os mapeamos para escrita.
+    // GL_MAP_INVALIDATE_BUFFER_BIT informa ao driver que o conteúdo anterior
+    // pode ser descartado, evitando cópias. Os alvos GL_COPY_* não dependem
+    // de um VAO ligado.
+    mesh->vertex_array_object_id = 0;
+    mesh->base_vertex            = 0;
+
+    load->vertex_buffer.Create(load->filename.c_str());
+    glBindBuffer(GL_COPY_READ_BUFFER, load->vertex_buffer.Get());
+    glBufferData(GL_COPY_READ_BUFFER, num_corners * sizeof(StreamedVertex), NULL, GL_STREAM_DRAW);
+    load->vertex_buffer.SetSize(num_corners * sizeof(StreamedVertex));
+
+    load->index_buffer.Create(load->filename.c_str());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, load->index_buffer.Get());
+    glBufferData(GL_COPY_WRITE_BUFFER, num_corners * sizeof(GLuint), NULL, GL_STREAM_DRAW);
+    load->index_buffer.SetSize(num_corners * sizeof(GLuint));
+
+    if (num_corners > 0)
+    {
+        const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT;
+        load->vertices = (StreamedVertex*)glMapBufferRange(GL_COPY_READ_BUFFER, 0, num_corners * sizeof(StreamedVertex), access);
+        load->indices  = (GLuint*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, num_corners * sizeof(GLuint), access);
+
+        if (load->vertices == NULL || load->indices == NULL)
+        {
+            load->ok  = false;
+            load->err = "ERROR: glMapBufferRange() failed.";
+        }
+    }
+}
+
+void ObjStream_Parse(ObjStreamLoad* load)
+{
+    if (!load->ok || load->num_corners == 0)
+        return;
+
+    AssetStream file(load->file);
+
+    load->positions.reserve(3 * load->num_positions);
+    load->normals.reserve(3 * load->num_normals);
+    load->texcoords.reserve(2 * load->num_texcoords);
+    load->needs_normals = (load->num_normals == 0);
+    if (load->needs_normals)
+        load->corner_positions.reserve(load->num_corners);
+
+    tinyobj::callback_t callback;
+    callback.vertex_cb   = VertexCallback;
+    callback.normal_cb   = NormalCallback;
+    callback.texcoord_cb = TexcoordCallback;
+    callback.index_cb    = IndexCallback;
+    callback.group_cb    = GroupCallback;
+    callback.object_cb   = ObjectCallback;
+
+    load->ok = tinyobj::LoadObjWithCallback(file, callback, load, NULL, &load->err);
+    CloseCurrentShape(load);
+
+    if (load->bad_index)
+    {
+        load->err += "ERROR: face references a vertex, normal or texcoord that does not exist.";
+        load->ok = false;
+    }
+    else if (load->overflow || load->num_written != load->num_corners)
+    {
+        load->err += "ERROR: face count mismatch between prescan and parse.";
+        load->ok = false;
+    }
+    else if (load->needs_normals)
+    {
+        ComputeStreamedNormals(load);
+    }
+
+    // Os atributos indexados não são mais necessários
+    std::vector<float>().swap(load->positions);
+    std::vector<float>().swap(load->normals);
+    std::vector<float>().swap(load->texcoords);
+    std::vector<GLuint>().swap(load->corner_positions);
+    std::vector<char>().swap(load->file.storage);
+}
+
+void ObjStream_Finish(ObjStreamLoad* load, StreamedMesh* mesh)
+{
+    bool ok = load->ok;
+
+    // glUnmapBuffer() retorna GL_FALSE se o conteúdo foi corrompido
+    // (por exemplo, troca de modo de vídeo); neste caso o modelo é inválido.
+    glBindBuffer(GL_COPY_READ_BUFFER, load->vertex_buffer.Get());
+    if (load->vertices != NULL && glUnmapBuffer(GL_COPY_READ_BUFFER) == GL_FALSE)
+        ok = false;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, load->index_buffer.Get());
+    if (load->indices != NULL && glUnmapBuffer(GL_COPY_WRITE_BUFFER) == GL_FALSE)
+        ok = false;
+
+    // Os vértices e índices vão para os buffers compartilhados, e os
+    // temporários são liberados
+    if (ok)
+    {
+        MeshAllocation allocation = MeshPool_CopyFromBuffers(MESH_FORMAT_STREAMED, load->vertex_buffer.Get(), load->num_corners, load->index_buffer.Get(), load->num_corners);
+        mesh->vertex_array_object_id = allocation.vertex_array_object_id;
+        mesh->base_vertex            = allocation.base_vertex;
+        for (size_t i = 0; i < load->shapes.size(); ++i)
+            load->shapes[i].first_index += allocation.first_index;
+    }
+    load->vertex_buffer.Reset();
+    load->index_buffer.Reset();
+
+    mesh->shapes.swap(load->shapes);
+
+    std::string err      = load->err;
+    std::string filename = load->filename;
+    size_t num_corners   = load->num_corners;
+    delete load;
+
+    if (!err.empty())
+        fprintf(stderr, "\n%s\n", err.c_str());
+
+    if (!ok)
+        throw std::runtime_error("Erro ao carregar modelo.");
+
+    printf("Modelo \"%s\" carregado (%d vértices).\n", filename.c_str(), (int)num_corners);
+}
+
+void ObjStream_LoadToGpu(const char* filename, StreamedMesh* mesh)
+{
+    printf("Carregando modelo \"%s\"...\n", filename);
+
+    ObjStreamLoad* load = ObjStream_Begin(filename);
+    ObjStream_MapBuffers(load, mesh);
+    ObjStream_Parse(load);
+    ObjStream_Finish(load, mesh);
+}
@@ -0,0 +1,490 @@
+#include "../include/profiler.hpp"
+#include "../include/frametime.hpp"
+#include "../include/glstats.hpp"
+#include "../include/gpuresources.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../include/glad/glad.h"
+#include "../include/GLFW/glfw3.h"
+
+// Funções definidas em textrendering.cpp
+float TextRendering_LineHeight(GLFWwindow* window);
+float TextRendering_CharWidth(GLFWwindow* window);
+int  TextRendering_CreateText();
+void TextRendering_SetText(int text_id, const std::string &str, float x, float y, float scale = 1.0f);
+void TextRendering_DrawText(int text_id);
+
+// Trilha usada para os eventos de GPU no arquivo exportado
+#define PROFILER_GPU_THREAD 1000
+
+struct ProfilerEvent
+{
+    const char* name;
+    uint64_t    start_ns;
+    uint64_t    duration_ns;
+    uint32_t    thread;
+    uint32_t    frame;
+};
+
+// Eventos dos últimos quadros, em um anel. Protegido por g_EventsMutex, pois
+// as threads auxiliares também podem registrar zonas.
+static std::vector<ProfilerEvent> g_Events;
+static size_t                     g_EventsNext  = 0;
+static size_t                     g_EventsCount = 0;
+static std::mutex                 g_EventsMutex;
+
+struct OpenZone
+{
+    const char* name;
+    uint64_t    start_ns;
+};
+
+static thread_local std::vector<OpenZone> t_ZoneStack;
+static thread_local int                   t_ThreadIndex = -1;
+static std::atomic<int>                   g_NextThreadIndex(0);
+
+static const std::chrono::steady_clock::time_point g_Epoch = std::chrono::steady_clock::now();
+static std::atomic<uint32_t>                       g_Frame(0);
+
+// Médias de cada zona, para o overlay. Só a thread principal (índice 0)
+// altera g_Stats, então não há necessidade de sincronização; as zonas das
+// outras threads (simulação, auxiliares) passam por g_OtherThreadTimes.
+struct ZoneStats
+{
+    const char* name;
+    double      cpu_frame_ms; // Acumulado no quadro atual
+    double      cpu_avg_ms;
+    double      gpu_avg_ms;
+    bool        has_cpu;
+    bool        has_gpu;
+};
+
+static std::vector<ZoneStats> g_Stats;
+
+// Tempo das zonas terminadas em outras threads desde o último
+// Profiler_EndFrame(), que os soma ao quadro atual
+struct ZoneTime
+{
+    const char* name;
+    double      ms;
+};
+
+static std::vector<ZoneTime> g_OtherThreadTimes;
+static std::mutex            g_OtherThreadTimesMutex;
+
+// Anel de consultas GL_TIME_ELAPSED, um conjunto por quadro
+struct GpuFrame
+{
+    GpuQuery    queries[PROFILER_MAX_GPU_ZONES];
+    const char* names[PROFILER_MAX_GPU_ZONES];
+    uint64_t    cpu_start_ns[PROFILER_MAX_GPU_ZONES];
+    int         count;
+    uint32_t    frame;
+    bool        pending;
+};
+
+static GpuFrame g_GpuFrames[PROFILER_GPU_FRAMES];
+static bool     g_GpuEnabled       = false;
+static int      g_GpuActiveZone    = -1; // Índice da zona aberta no quadro atual
+static int      g_GpuIgnoredZones  = 0;  // Zonas aninhadas ou excedentes
+static unsigned g_GpuDroppedFrames = 0;
+
+static bool                     g_ShowOverlay       = false;
+static std::vector<int>         g_OverlayTexts;
+static std::vector<std::string> g_OverlayLines;
+static double                   g_OverlayLastUpdate = 0.0;
+
+static uint64_t NowNanoseconds()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_Epoch).count();
+}
+
+static int ThreadIndex()
+{
+    if (t_ThreadIndex < 0)
+        t_ThreadIndex = g_NextThreadIndex++;
+    return t_ThreadIndex;
+}
+
+static size_t FindStats(const char* name)
+{
+    for (size_t i = 0; i < g_Stats.size(); ++i)
+    {
+        if (g_Stats[i].name == name || strcmp(g_Stats[i].name, name) == 0)
+            return i;
+    }
+
+    ZoneStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.name = name;
+    g_Stats.push_back(stats);
+    return g_Stats.size() - 1;
+}
+
+static void RecordEvent(const char* name, uint64_t start_ns, uint64_t duration_ns, uint32_t thread, uint32_t frame)
+{
+    ProfilerEvent event = { name, start_ns, duration_ns, thread, frame };
+
+    std::lock_guard<std::mutex> lock(g_EventsMutex);
+    if (g_Events.empty())
+        g_Events.resize(PROFILER_MAX_EVENTS);
+    g_Events[g_EventsNext] = event;
+    g_EventsNext = (g_EventsNext + 1) % PROFILER_MAX_EVENTS;
+    if (g_EventsCount < PROFILER_MAX_EVENTS)
+        g_EventsCount++;
+}
+
+void Profiler_Init()
+{
+    // A thread que inicializa o profiler é a thread principal (índice 0)
+    if (t_ThreadIndex < 0)
+        t_ThreadIndex = g_NextThreadIndex++;
+
+    for (int i = 0; i < PROFILER_GPU_FRAMES; ++i)
+    {
+        for (int j = 0; j < PROFILER_MAX_GPU_ZONES; ++j)
+            g_GpuFrames[i].queries[j].Create("profiler");
+        g_GpuFrames[i].count   = 0;
+        g_GpuFrames[i].pending = false;
+    }
+    g_GpuEnabled = true;
+}
+
+void Profiler_Shutdown()
+{
+    if (!g_GpuEnabled)
+        return;
+
+    for (int i = 0; i < PROFILER_GPU_FRAMES; ++i)
+        for (int j = 0; j < PROFILER_MAX_GPU_ZONES; ++j)
+            g_GpuFrames[i].queries[j].Reset();
+    g_GpuEnabled = false;
+}
+
+void Profiler_BeginZone(const char* name)
+{
+    ThreadIndex();
+    OpenZone zone = { name, NowNanoseconds() };
+    t_ZoneStack.push_back(zone);
+}
+
+void Profiler_EndZone()
+{
+    if (t_ZoneStack.empty())
+        return;
+
+    OpenZone zone = t_ZoneStack.back();
+    t_ZoneStack.pop_back();
+    uint64_t duration_ns = NowNanoseconds() - zone.start_ns;
+
+    RecordEvent(zone.name, zone.start_ns, duration_ns, (uint32_t)t_ThreadIndex, g_Frame);
+
+    if (t_ThreadIndex == 0)
+    {
+        ZoneStats& stats = g_Stats[FindStats(zone.name)];
+        stats.cpu_frame_ms += duration_ns * 1e-6;
+        stats.has_cpu = true;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_OtherThreadTimesMutex);
+    for (size_t i = 0; i < g_OtherThreadTimes.size(); ++i)
+    {
+        if (g_OtherThreadTimes[i].name == zone.name || strcmp(g_OtherThreadTimes[i].name, zone.name) == 0)
+        {
+            g_OtherThreadTimes[i].ms += duration_ns * 1e-6;
+            return;
+        }
+    }
+    ZoneTime time = { zone.name, duration_ns * 1e-6 };
+    g_OtherThreadTimes.push_back(time);
+}
+
+// Lê os resultados de um quadro do anel, se a GPU já terminou todas as suas
+// consultas. Nunca bloqueia.
+static bool ResolveGpuFrame(GpuFrame& gpu_frame)
+{
+    // As consultas terminam em ordem: basta verificar a última
+    GLint available = 0;
+    glGetQueryObjectiv(gpu_frame.queries[gpu_frame.count - 1].Get(), GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return false;
+
+    // Somamos as zonas de mesmo nome antes de atualizar as médias
+    std::vector<size_t> frame_stats;
+    std::vector<double> frame_ms;
+    for (int i = 0; i < gpu_frame.count; ++i)
+    {
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(gpu_frame.queries[i].Get(), GL_QUERY_RESULT, &elapsed_ns);
+
+        // A GPU executa depois da CPU; posicionamos o evento no instante em
+        // que a zona foi submetida, apenas como referência.
+        RecordEvent(gpu_frame.names[i], gpu_frame.cpu_start_ns[i], elapsed_ns, PROFILER_GPU_THREAD, gpu_frame.frame);
+
+        size_t stats = FindStats(gpu_frame.names[i]);
+        size_t j = 0;
+        while (j < frame_stats.size() && frame_stats[j] != stats)
+            ++j;
+        if (j == frame_stats.size())
+        {
+            frame_stats.push_back(stats);
+            frame_ms.push_back(0.0);
+        }
+        frame_ms[j] += elapsed_ns * 1e-6;
+    }
+
+    double total_ms = 0.0;
+    for (size_t j = 0; j < frame_stats.size(); ++j)
+    {
+        total_ms += frame_ms[j];
+        ZoneStats& stats = g_Stats[frame_stats[j]];
+        stats.gpu_avg_ms = stats.has_gpu ? stats.gpu_avg_ms * 0.95 + frame_ms[j] * 0.05 : frame_ms[j];
+        stats.has_gpu = true;
+    }
+
+    // Tempo de GPU do quadro inteiro, para os percentis
+    FrameTime_Record(FRAME_TIME_GPU, total_ms);
+    return true;
+}
+
+void Profiler_BeginFrame()
+{
+    Profiler_BeginZone("frame");
+
+    if (!g_GpuEnabled)
+        return;
+
+    GpuFrame& gpu_frame = g_GpuFrames[g_Frame % PROFILER_GPU_FRAMES];
+    if (gpu_frame.pending && !ResolveGpuFrame(gpu_frame))
+    {
+        // A GPU está mais de PROFILER_GPU_FRAMES quadros atrasada. Em vez de
+        // esperar, descartamos os resultados e reutilizamos as consultas.
+        g_GpuDroppedFrames++;
+    }
+    gpu_frame.pending = false;
+    gpu_frame.count   = 0;
+    gpu_frame.frame   = g_Frame;
+    g_GpuActiveZone   = -1;
+    g_GpuIgnoredZones = 0;
+}
+
+void Profiler_EndFrame()
+{
+    if (g_GpuEnabled)
+    {
+        GpuFrame& current = g_GpuFrames[g_Frame % PROFILER_GPU_FRAMES];
+        if (g_GpuActiveZone >= 0)
+        {
+            glEndQuery(GL_TIME_ELAPSED);
+            g_GpuActiveZone = -1;
+        }
+        current.pending = current.count > 0;
+
+        // Recolhemos os quadros anteriores que já terminaram, do mais antigo
+        // para o mais recente
+        for (uint32_t age = PROFILER_GPU_FRAMES - 1; age >= 1; --age)
+        {
+            if (g_Frame < age)
+                continue;
+            GpuFrame& gpu_frame = g_GpuFrames[(g_Frame - age) % PROFILER_GPU_FRAMES];
+            if (gpu_frame.pending && ResolveGpuFrame(gpu_frame))
+                gpu_frame.pending = false;
+        }
+    }
+
+    Profiler_EndZone();
+
+    // Zonas das outras threads terminadas durante este quadro (por exemplo,
+    // "physics" e "collisions" na thread da simulação)
+    std::vector<ZoneTime> other_thread_times;
+    {
+        std::lock_guard<std::mutex> lock(g_OtherThreadTimesMutex);
+        other_thread_times.swap(g_OtherThreadTimes);
+    }
+    for (size_t i = 0; i < other_thread_times.size(); ++i)
+    {
+        ZoneStats& stats = g_Stats[FindStats(other_thread_times[i].name)];
+        stats.cpu_frame_ms += other_thread_times[i].ms;
+        stats.has_cpu = true;
+    }
+
+    // Média móvel exponencial dos tempos de CPU do quadro
+    for (size_t i = 0; i < g_Stats.size(); ++i)
+    {
+        ZoneStats& stats = g_Stats[i];
+        if (!stats.has_cpu)
+            continue;
+        stats.cpu_avg_ms   = stats.cpu_avg_ms * 0.95 + stats.cpu_frame_ms * 0.05;
+        stats.cpu_frame_ms = 0.0;
+    }
+
+    g_Frame++;
+}
+
+void Profiler_BeginGpuZone(const char* name)
+{
+    if (!g_GpuEnabled)
+        return;
+
+    GpuFrame& gpu_frame = g_GpuFrames[g_Frame % PROFILER_GPU_FRAMES];
+    if (g_GpuActiveZone >= 0 || gpu_frame.count == PROFILER_MAX_GPU_ZONES)
+    {
+        g_GpuIgnoredZones++;
+        return;
+    }
+
+    int zone = gpu_frame.count++;
+    gpu_frame.names[zone]        = name;
+    gpu_frame.cpu_start_ns[zone] = NowNanoseconds();
+    glBeginQuery(GL_TIME_ELAPSED, gpu_frame.queries[zone].Get());
+    g_GpuActiveZone = zone;
+}
+
+void Profiler_EndGpuZone()
+{
+    if (g_GpuIgnoredZones > 0)
+    {
+        g_GpuIgnoredZones--;
+        return;
+    }
+    if (g_GpuActiveZone < 0)
+        return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    g_GpuActiveZone = -1;
+}
+
+void Profiler_ToggleOverlay()
+{
+    g_ShowOverlay = !g_ShowOverlay;
+}
+
+void Profiler_DrawOverlay(GLFWwindow* window)
+{
+    if (!g_ShowOverlay)
+        return;
+
+    // O texto é refeito apenas algumas vezes por segundo, para ser legível e
+    // para não refazer o layout a cada quadro
+    double now = glfwGetTime();
+    if (g_OverlayLines.empty() || now - g_OverlayLastUpdate > 0.25)
+    {
+        g_OverlayLastUpdate = now;
+        g_OverlayLines.clear();
+        g_OverlayLines.push_back("zona               CPU ms   GPU ms");
+
+        char line[128];
+        for (size_t i = 0; i < g_Stats.size(); ++i)
+        {
+            const ZoneStats& stats = g_Stats[i];
+            char cpu[16] = "     -";
+            char gpu[16] = "     -";
+            if (stats.has_cpu)
+                snprintf(cpu, sizeof(cpu), "%6.2f", stats.cpu_avg_ms);
+            if (stats.has_gpu)
+                snprintf(gpu, sizeof(gpu), "%6.2f", stats.gpu_avg_ms);
+            snprintf(line, sizeof(line), "%-18.18s %s   %s", stats.name, cpu, gpu);
+            g_OverlayLines.push_back(line);
+        }
+
+        if (g_GpuDroppedFrames > 0)
+        {
+            snprintf(line, sizeof(line), "GPU: %u quadros descartados", g_GpuDroppedFrames);
+            g_OverlayLines.push_back(line);
+        }
+
+        // Chamadas OpenGL do último quadro, em builds com -DGLSTATS_ENABLED
+        GlStatsCounters gl;
+        if (GlStats_GetLastFrame(&gl))
+        {
+            snprintf(line, sizeof(line), "draws %u  estado %u  upload %.1f KB", gl.draw_calls, gl.state_changes, gl.upload_bytes / 1024.0);
+            g_OverlayLines.push_back(line);
+            snprintf(line, sizeof(line), "binds: prog %u  vao %u  tex %u  buf %u", gl.program_binds, gl.vertex_array_binds, gl.texture_binds, gl.buffer_binds);
+            g_OverlayLines.push_back(line);
+        }
+    }
+
+    float lineheight = TextRendering_LineHeight(window);
+    float charwidth  = TextRendering_CharWidth(window);
+
+    while (g_OverlayTexts.size() < g_OverlayLines.size())
+        g_OverlayTexts.push_back(TextRendering_CreateText());
+
+    for (size_t i = 0; i < g_OverlayLines.size(); ++i)
+    {
+        TextRendering_SetText(g_OverlayTexts[i], g_OverlayLines[i], -1.0f + charwidth, 1.0f - (i + 1) * lineheight, 1.0f);
+        TextRendering_DrawText(g_OverlayTexts[i]);
+    }
+}
+
+static const char* ThreadName(uint32_t thread, char* buffer, size_t size)
+{
+    if (thread == 0)
+        return "main";
+    if (thread == PROFILER_GPU_THREAD)
+        return "GPU";
+    snprintf(buffer, size, "worker %u", thread);
+    return buffer;
+}
+
+bool Profiler_ExportTrace(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_EventsMutex);
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    size_t first = (g_EventsNext + PROFILER_MAX_EVENTS - g_EventsCount) % PROFILER_MAX_EVENTS;
+    std::vector<uint32_t> threads;
+    for (size_t i = 0; i < g_EventsCount; ++i)
+    {
+        const ProfilerEvent& event = g_Events[(first + i) % PROFILER_MAX_EVENTS];
+        fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%u}}",
+                i > 0 ? ",\n" : "",
+                event.name,
+                event.thread == PROFILER_GPU_THREAD ? "gpu" : "cpu",
+                event.thread,
+                event.start_ns * 1e-3,
+                event.duration_ns * 1e-3,
+                event.frame);
+
+        if (std::find(threads.begin(), threads.end(), event.thread) == threads.end())
+            threads.push_back(event.thread);
+    }
+
+    // Nomes das trilhas
+    char name_buffer[32];
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                threads[i], ThreadName(threads[i], name_buffer, sizeof(name_buffer)));
+    }
+
+    fprintf(file, "\n]}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    if (!ok)
+    {
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", filename);
+        return false;
+    }
+
+    printf("Trace do profiler salvo em \"%s\" (%u eventos).\n", filename, (unsigned)g_EventsCount);
+    return true;
+}
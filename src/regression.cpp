@@ -0,0 +1,272 @@
+#include "../include/regression.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../include/glad/glad.h"
+#include "../include/GLFW/glfw3.h"
+
+#include "../include/constants.hpp"
+#include "../include/simulation.hpp"
+#include "../include/capture.hpp"
+#include "../include/jobs.hpp"
+#include "../include/textureloader.hpp"
+#include "../include/stb_image.h"
+
+// Linhas comparadas por tarefa (veja CompareImages())
+#define REGRESSION_ROWS_PER_JOB 64
+
+enum RegressionCamera
+{
+    CAMERA_CHASE,
+    CAMERA_LOOK_AT_BALL,
+    CAMERA_LOOK_BACK
+};
+
+struct RegressionScene
+{
+    const char*      name;
+    void           (*setup)();
+    RegressionCamera purple_camera;
+    RegressionCamera orange_camera;
+};
+
+enum RegressionStatus
+{
+    REGRESSION_PASSED,
+    REGRESSION_FAILED,
+    REGRESSION_MISSING, // Sem imagem de referência
+    REGRESSION_UPDATED
+};
+
+struct RegressionResult
+{
+    const char*      name;
+    RegressionStatus status;
+    double           frame_ms;
+    float            diff_fraction;
+};
+
+// Posições iniciais da partida
+static void SetupKickoff()
+{
+    Simulation_Reset();
+}
+
+// Bola entrando no gol do carro laranja, com o carro roxo logo atrás e o
+// laranja tentando defender
+static void SetupGoal()
+{
+    Simulation_Reset();
+
+    ball_position       = glm::vec4(3.0f, BALL_RADIUS + 1.0f, -FIELD_LENGTH / 2 + 2.0f, 1);
+    purple_car_position = glm::vec4(0.0f, CAR_HEIGHT / 2, -FIELD_LENGTH / 2 + 15.0f, 1);
+    orange_car_position = glm::vec4(-8.0f, CAR_HEIGHT / 2, -FIELD_LENGTH / 2 + 6.0f, 1);
+
+    purple_car_direction = NORTH;
+    orange_car_direction = EAST;
+    purple_car_direction_angle = atan2(-purple_car_direction.x, -purple_car_direction.z);
+    orange_car_direction_angle = atan2(-orange_car_direction.x, -orange_car_direction.z);
+}
+
+static const RegressionScene g_RegressionScenes[] = {
+    { "kickoff_chase",        SetupKickoff, CAMERA_CHASE,        CAMERA_CHASE        },
+    { "kickoff_look_at_ball", SetupKickoff, CAMERA_LOOK_AT_BALL, CAMERA_LOOK_AT_BALL },
+    { "kickoff_look_back",    SetupKickoff, CAMERA_LOOK_BACK,    CAMERA_LOOK_BACK    },
+    { "goal_chase",           SetupGoal,    CAMERA_CHASE,        CAMERA_LOOK_AT_BALL },
+    { "goal_look_back",       SetupGoal,    CAMERA_LOOK_BACK,    CAMERA_CHASE        },
+};
+static const int g_RegressionNumScenes = sizeof(g_RegressionScenes) / sizeof(g_RegressionScenes[0]);
+
+static bool        g_RegressionActive = false;
+static bool        g_RegressionUpdate = false;
+static std::string g_RegressionDirectory;
+static int         g_RegressionScene  = 0;
+static int         g_RegressionFrame  = 0; // Quadro dentro da cena atual
+static double      g_RegressionFrameStart = 0.0;
+static double      g_RegressionTime       = 0.0;
+static std::vector<RegressionResult> g_RegressionResults;
+
+void Regression_Start(const char* golden_directory, bool update)
+{
+    g_RegressionActive    = true;
+    g_RegressionUpdate    = update;
+    g_RegressionDirectory = golden_directory;
+    g_RegressionScene     = 0;
+    g_RegressionFrame     = 0;
+    g_RegressionResults.clear();
+
+    printf("Regressão: %d cenas, %s \"%s\".\n", g_RegressionNumScenes, update ? "atualizando" : "comparando com", golden_directory);
+}
+
+bool Regression_IsActive()
+{
+    return g_RegressionActive;
+}
+
+static void SetCamera(RegressionCamera camera, GLboolean* looking_at_ball, GLboolean* looking_back)
+{
+    *looking_at_ball = camera == CAMERA_LOOK_AT_BALL;
+    *looking_back    = camera == CAMERA_LOOK_BACK;
+}
+
+bool Regression_Update()
+{
+    if (!g_RegressionActive)
+        return true;
+    if (g_RegressionScene >= g_RegressionNumScenes)
+        return false;
+
+    const RegressionScene& scene = g_RegressionScenes[g_RegressionScene];
+    if (g_RegressionFrame == 0)
+    {
+        scene.setup();
+        g_RegressionTime = 0.0;
+    }
+    SetCamera(scene.purple_camera, &is_purple_car_looking_at_ball, &is_purple_camera_looking_back);
+    SetCamera(scene.orange_camera, &is_orange_car_looking_at_ball, &is_orange_camera_looking_back);
+
+    g_RegressionFrameStart = glfwGetTime();
+    return true;
+}
+
+// Diferença perceptual entre duas cores, no espaço YIQ, de 0 a 35215
+static float ColorDelta(const uint8_t* a, const uint8_t* b)
+{
+    float r1 = a[0], g1 = a[1], b1 = a[2];
+    float r2 = b[0], g2 = b[1], b2 = b[2];
+
+    float y = (r1 - r2) * 0.29889531f + (g1 - g2) * 0.58662247f + (b1 - b2) * 0.11448223f;
+    float i = (r1 - r2) * 0.59597799f - (g1 - g2) * 0.27417610f - (b1 - b2) * 0.32180189f;
+    float q = (r1 - r2) * 0.21147017f - (g1 - g2) * 0.52261711f + (b1 - b2) * 0.31114694f;
+    return 0.5053f * y * y + 0.299f * i * i + 0.1957f * q * q;
+}
+
+// Compara com a referência. A imagem de diferenças mostra a cena em tons
+// claros de cinza e os pixels diferentes em vermelho.
+static float CompareImages(const uint8_t* actual, const uint8_t* golden, int width, int height, std::vector<uint8_t>* diff)
+{
+    const float max_delta = 35215.0f * REGRESSION_PIXEL_THRESHOLD * REGRESSION_PIXEL_THRESHOLD;
+
+    size_t num_pixels = (size_t)width * height;
+    std::atomic<size_t> different(0);
+    diff->resize(num_pixels * 3);
+    uint8_t* diff_pixels = diff->data();
+
+    // Faixas de linhas independentes, comparadas em paralelo
+    Jobs_ParallelFor(height, REGRESSION_ROWS_PER_JOB, [=, &different](int begin, int end)
+    {
+        size_t band_different = 0;
+        for (size_t p = (size_t)begin * width; p < (size_t)end * width; ++p)
+        {
+            const uint8_t* a = actual + p * 3;
+            uint8_t*       d = diff_pixels + p * 3;
+            if (ColorDelta(a, golden + p * 3) > max_delta)
+            {
+                d[0] = 255; d[1] = 0; d[2] = 0;
+                band_different++;
+            }
+            else
+            {
+                uint8_t gray = (uint8_t)(255 - (255 - (a[0] * 77 + a[1] * 150 + a[2] * 29) / 256) / 10);
+                d[0] = d[1] = d[2] = gray;
+            }
+        }
+        different += band_different;
+    });
+    return (float)different / num_pixels;
+}
+
+static void CheckScene(const RegressionScene& scene, RegressionResult* result)
+{
+    std::vector<uint8_t> actual;
+    int width, height;
+    Capture_ReadPixels(&actual, &width, &height);
+    std::string path = g_RegressionDirectory + "/" + scene.name;
+
+    result->diff_fraction = 0.0f;
+    if (g_RegressionUpdate)
+    {
+        result->status = Capture_WritePng((path + ".png").c_str(), actual.data(), width, height) ? REGRESSION_UPDATED : REGRESSION_FAILED;
+        return;
+    }
+
+    int golden_width, golden_height, golden_channels;
+    uint8_t* golden = stbi_load((path + ".png").c_str(), &golden_width, &golden_height, &golden_channels, 3);
+    if (golden == NULL || golden_width != width || golden_height != height)
+    {
+        result->status = REGRESSION_MISSING;
+        Capture_WritePng((path + "_actual.png").c_str(), actual.data(), width, height);
+        stbi_image_free(golden);
+        return;
+    }
+
+    std::vector<uint8_t> diff;
+    result->diff_fraction = CompareImages(actual.data(), golden, width, height, &diff);
+    stbi_image_free(golden);
+
+    if (result->diff_fraction > REGRESSION_MAX_DIFF_FRACTION)
+    {
+        result->status = REGRESSION_FAILED;
+        Capture_WritePng((path + "_actual.png").c_str(), actual.data(), width, height);
+        Capture_WritePng((path + "_diff.png").c_str(), diff.data(), width, height);
+    }
+    else
+        result->status = REGRESSION_PASSED;
+}
+
+void Regression_EndFrame()
+{
+    if (!g_RegressionActive || g_RegressionScene >= g_RegressionNumScenes)
+        return;
+
+    // As texturas carregam em segundo plano: até que todas estejam prontas,
+    // a cena é desenhada com a textura provisória, e a contagem de quadros
+    // (aquecimento e medição) não começa. Assim a imagem capturada não
+    // depende da velocidade da máquina.
+    if (!TextureLoader_IsIdle())
+        return;
+
+    // Esperamos a GPU, para que o tempo medido inclua a renderização
+    glFinish();
+    if (g_RegressionFrame >= REGRESSION_WARMUP_FRAMES)
+        g_RegressionTime += glfwGetTime() - g_RegressionFrameStart;
+
+    g_RegressionFrame++;
+    if (g_RegressionFrame < REGRESSION_WARMUP_FRAMES + REGRESSION_TIMED_FRAMES)
+        return;
+
+    const RegressionScene& scene = g_RegressionScenes[g_RegressionScene];
+    RegressionResult result;
+    result.name     = scene.name;
+    result.frame_ms = g_RegressionTime * 1000.0 / REGRESSION_TIMED_FRAMES;
+    CheckScene(scene, &result);
+    g_RegressionResults.push_back(result);
+
+    g_RegressionScene++;
+    g_RegressionFrame = 0;
+}
+
+bool Regression_PrintReport()
+{
+    if (!g_RegressionActive)
+        return true;
+
+    static const char* const status_names[] = { "ok", "FALHOU", "SEM REFERÊNCIA", "atualizada" };
+
+    bool ok = (int)g_RegressionResults.size() == g_RegressionNumScenes;
+    printf("%-24s %10s %10s  %s\n", "Cena", "ms/quadro", "diferença", "resultado");
+    for (size_t i = 0; i < g_RegressionResults.size(); ++i)
+    {
+        const RegressionResult& result = g_RegressionResults[i];
+        printf("%-24s %10.2f %9.3f%%  %s\n", result.name, result.frame_ms, result.diff_fraction * 100.0f, status_names[result.status]);
+        if (result.status == REGRESSION_FAILED || result.status == REGRESSION_MISSING)
+            ok = false;
+    }
+    if (!ok)
+        fprintf(stderr, "ERROR: Rendering regression test failed.\n");
+    return ok;
+}
@@ -0,0 +1,148 @@
+#include "../include/simthread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "../include/inputreplay.hpp"
+
+// Buffer triplo: g_SnapshotLatest guarda o índice do SimulationSnapshot mais
+// recente e, em SNAPSHOT_NEW, se ele ainda não foi lido. Cada thread é dona
+// de um dos outros dois buffers.
+#define SNAPSHOT_INDEX_MASK 3u
+#define SNAPSHOT_NEW        4u
+
+static SimulationSnapshot    g_Snapshots[3];
+static std::atomic<uint32_t> g_SnapshotLatest(0);
+static uint32_t              g_SnapshotBack  = 0; // Escrito pela thread da simulação
+static uint32_t              g_SnapshotFront = 0; // Lido pela thread principal
+
+static std::thread           g_SimulationThread;
+static std::atomic<bool>     g_SimulationRunning(false);
+static std::atomic<bool>     g_ReplayFinished(false);
+
+// Comandos do teclado: roxo no byte baixo, laranja no alto
+static std::atomic<uint16_t> g_KeyboardInput(0);
+
+// Tempo real ainda não simulado por SimThread_Advance()
+static float g_TimeAccumulator = 0.0f;
+
+// Um passo da simulação. Os comandos vêm do teclado ou, se uma gravação
+// estiver sendo reproduzida, do arquivo.
+static bool Tick(SimulationInput input)
+{
+    if (!InputReplay_Tick(&input))
+        return false;
+    Simulation_SetInput(input);
+    Simulation_Step(SIMULATION_TICK);
+    return true;
+}
+
+static void PublishSnapshot()
+{
+    Simulation_GetSnapshot(&g_Snapshots[g_SnapshotBack]);
+    g_SnapshotBack = g_SnapshotLatest.exchange(g_SnapshotBack | SNAPSHOT_NEW, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+}
+
+static void SimulationLoop()
+{
+    typedef std::chrono::steady_clock clock;
+    const clock::duration tick = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(SIMULATION_TICK));
+
+    clock::time_point next_tick = clock::now();
+    while (g_SimulationRunning.load(std::memory_order_acquire))
+    {
+        uint16_t keyboard = g_KeyboardInput.load(std::memory_order_relaxed);
+        SimulationInput input = { (uint8_t)(keyboard & 0xFF), (uint8_t)(keyboard >> 8) };
+
+        int ticks = 0;
+        while (clock::now() >= next_tick && ticks < SIMULATION_MAX_TICKS_PER_FRAME)
+        {
+            if (!Tick(input))
+            {
+                g_ReplayFinished.store(true, std::memory_order_release);
+                return;
+            }
+            next_tick += tick;
+            ticks++;
+        }
+
+        // Se o computador não consegue acompanhar, descartamos o atraso em vez
+        // de acumulá-lo
+        if (ticks == SIMULATION_MAX_TICKS_PER_FRAME && clock::now() >= next_tick)
+            next_tick = clock::now();
+
+        if (ticks > 0)
+            PublishSnapshot();
+
+        std::this_thread::sleep_until(next_tick);
+    }
+}
+
+void SimThread_Start()
+{
+    if (g_SimulationRunning)
+        return;
+
+    // Os três buffers começam com o estado atual
+    for (int i = 0; i < 3; ++i)
+        Simulation_GetSnapshot(&g_Snapshots[i]);
+    g_SnapshotFront = 0;
+    g_SnapshotLatest.store(1);
+    g_SnapshotBack = 2;
+
+    g_ReplayFinished = false;
+    g_SimulationRunning = true;
+    g_SimulationThread = std::thread(SimulationLoop);
+}
+
+void SimThread_Stop()
+{
+    if (!g_SimulationThread.joinable())
+        return;
+
+    g_SimulationRunning = false;
+    g_SimulationThread.join();
+}
+
+bool SimThread_IsRunning()
+{
+    return g_SimulationThread.joinable();
+}
+
+void SimThread_SetInput(SimulationInput input)
+{
+    g_KeyboardInput.store((uint16_t)(input.purple | (input.orange << 8)), std::memory_order_relaxed);
+}
+
+void SimThread_GetSnapshot(SimulationSnapshot* snapshot)
+{
+    if (g_SnapshotLatest.load(std::memory_order_relaxed) & SNAPSHOT_NEW)
+        g_SnapshotFront = g_SnapshotLatest.exchange(g_SnapshotFront, std::memory_order_acq_rel) & SNAPSHOT_INDEX_MASK;
+    *snapshot = g_Snapshots[g_SnapshotFront];
+}
+
+bool SimThread_IsReplayFinished()
+{
+    return g_ReplayFinished.load(std::memory_order_acquire);
+}
+
+bool SimThread_Advance(float delta_time, SimulationInput input)
+{
+    g_TimeAccumulator += delta_time;
+    int ticks = 0;
+    while (g_TimeAccumulator >= SIMULATION_TICK && ticks < SIMULATION_MAX_TICKS_PER_FRAME)
+    {
+        if (!Tick(input))
+            return false;
+
+        g_TimeAccumulator -= SIMULATION_TICK;
+        ticks++;
+    }
+
+    // Se o computador não consegue acompanhar, descartamos o atraso em vez
+    // de acumulá-lo
+    if (ticks == SIMULATION_MAX_TICKS_PER_FRAME)
+        g_TimeAccumulator = 0.0f;
+    return true;
+}
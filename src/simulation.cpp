@@ -0,0 +1,307 @@
+#include "../include/simulation.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "../include/constants.hpp"
+#include "../include/collisions.hpp"
+#include "../include/matrices.h"
+#include "../include/profiler.hpp"
+
+// Variaveis de posição
+glm::vec4 purple_car_position;
+glm::vec4 orange_car_position;
+glm::vec4 ball_position;
+
+// Variaveis de velocidade
+glm::vec4 purple_car_speed = ZERO;
+glm::vec4 orange_car_speed = ZERO;
+glm::vec4 ball_speed = ZERO;
+
+// Inicialização da direção dos carros
+glm::vec4 purple_car_direction = NORTH;
+glm::vec4 orange_car_direction = SOUTH;
+
+GLfloat purple_car_direction_angle;
+GLfloat orange_car_direction_angle;
+
+GLboolean is_purple_car_looking_at_ball = false;
+GLboolean is_orange_car_looking_at_ball = false;
+
+GLboolean is_purple_car_moving_left = false;
+GLboolean is_purple_car_moving_right = false;
+GLboolean is_purple_car_moving_front = false;
+GLboolean is_purple_car_moving_back = false;
+GLboolean is_purple_camera_looking_back = false;
+
+GLboolean is_orange_car_moving_left = false;
+GLboolean is_orange_car_moving_right = false;
+GLboolean is_orange_car_moving_front = false;
+GLboolean is_orange_car_moving_back = false;
+GLboolean is_orange_camera_looking_back = false;
+
+// Comandos usados por Simulation_Step(), definidos por Simulation_SetInput().
+// Ficam separados dos globais acima, escritos por KeyCallback() na thread
+// principal, pois a simulação pode executar em outra thread (veja
+// "simthread.hpp").
+static SimulationInput g_StepInput = { 0, 0 };
+
+GLboolean is_ball_returning = false;
+GLfloat ball_returning_progress;
+glm::vec4 ball_returning_point_1;
+glm::vec4 ball_returning_point_2;
+glm::vec4 ball_returning_point_3;
+glm::vec4 ball_returning_point_4;
+
+void Simulation_Reset()
+{
+    // Inicialização da posição da bola e dos carros
+    ball_position = glm::vec4(0, BALL_RADIUS, 0, 1);
+    purple_car_position = glm::vec4(0, CAR_HEIGHT / 2, CAR_TO_BALL_INITIAL_DISTANCE, 1);
+    orange_car_position = glm::vec4(0, CAR_HEIGHT / 2, -CAR_TO_BALL_INITIAL_DISTANCE, 1);
+
+    purple_car_speed = ZERO;
+    orange_car_speed = ZERO;
+    ball_speed = ZERO;
+
+    purple_car_direction = NORTH;
+    orange_car_direction = SOUTH;
+    purple_car_direction_angle = atan2(-purple_car_direction.x, -purple_car_direction.z);
+    orange_car_direction_angle = atan2(-orange_car_direction.x, -orange_car_direction.z);
+
+    is_ball_returning = false;
+    ball_returning_progress = 0;
+}
+
+void Simulation_Step(float delta_time)
+{
+    Profiler_BeginZone("physics");
+
+    // Funções de atrito da bola e dos carros, se o carro estão de lado o atrito é maior 
+    if (norm(purple_car_speed) > 0)
+    {
+        purple_car_speed *= std::pow(0.6, delta_time);
+        purple_car_speed *= std::pow(0.02, delta_time * (1 - abs(purple_car_direction.x * purple_car_speed.x + purple_car_direction.z * purple_car_speed.z) / norm(purple_car_speed)));
+    }
+    if (norm(orange_car_speed) > 0)
+    {
+        orange_car_speed *= std::pow(0.6, delta_time);
+        orange_car_speed *= std::pow(0.02, delta_time * (1 - abs(orange_car_direction.x * orange_car_speed.x + orange_car_direction.z * orange_car_speed.z) / norm(orange_car_speed)));
+    }
+    ball_speed *= std::pow(0.8, delta_time);
+    
+    // Criação de variaveis temporarias para possivel novo valor da posição, velocidade e direção do carro
+    glm::vec4 purple_car_new_position = purple_car_position;
+    glm::vec4 purple_car_new_speed = purple_car_speed;
+    glm::vec4 purple_car_new_direction = purple_car_direction;
+
+
+    // Atualiza a velocidade do carro, usando o tempo entre os frames. Se o carro está dando ré, a aceleração é menor
+    if (g_StepInput.purple & INPUT_FRONT)
+    {
+        purple_car_new_speed += 30.0f * delta_time * purple_car_direction;
+    }
+    if (g_StepInput.purple & INPUT_BACK)
+    {
+        purple_car_new_speed -= 20.0f * delta_time * purple_car_direction;
+    }
+
+    // Atualiza a posição do carro 
+    purple_car_new_position += delta_time * purple_car_new_speed;
+
+    // Atualiza a direção do carro, quanto maior a velocidade do carro, mais rápido ele gira
+    if (g_StepInput.purple & INPUT_RIGHT)
+    {
+        purple_car_new_direction = Matrix_Rotate_Y(-norm(purple_car_speed) / 8 * delta_time) * purple_car_new_direction;
+    }
+    if (g_StepInput.purple & INPUT_LEFT)
+    {
+        purple_car_new_direction = Matrix_Rotate_Y(+norm(purple_car_speed) / 8 * delta_time) * purple_car_new_direction;
+    }
+
+    // Verifica se há colisão do carro com o cenário, se tiver a velocidade do carro é zerada, senão, a posição, velocidade e direção são definitivamente atualizadas
+    Profiler_BeginZone("collisions");
+    bool is_purple_car_colliding = is_colliding_car_to_scenario(purple_car_new_position, purple_car_new_direction);
+    Profiler_EndZone();
+
+    if (not is_purple_car_colliding)
+    {
+        purple_car_position = purple_car_new_position;
+        purple_car_speed = purple_car_new_speed;
+        purple_car_direction = purple_car_new_direction;
+    }
+    else
+    {
+        purple_car_speed = ZERO;
+    }
+    
+    // Aqui as mesmas funções são implementadas, porém para o carro laranja
+
+    glm::vec4 orange_car_new_position = orange_car_position;
+    glm::vec4 orange_car_new_speed = orange_car_speed;
+    glm::vec4 orange_car_new_direction = orange_car_direction;
+
+    if (g_StepInput.orange & INPUT_FRONT)
+    {
+        orange_car_new_speed += 30.0f * delta_time * orange_car_direction;
+    }
+    if (g_StepInput.orange & INPUT_BACK)
+    {
+        orange_car_new_speed -= 20.0f * delta_time * orange_car_direction;
+    }
+
+    orange_car_new_position += delta_time * orange_car_new_speed;
+
+    if (g_StepInput.orange & INPUT_RIGHT)
+    {
+        orange_car_new_direction = Matrix_Rotate_Y(-norm(orange_car_speed) / 8 * delta_time) * orange_car_new_direction;
+    }
+    if (g_StepInput.orange & INPUT_LEFT)
+    {
+        orange_car_new_direction = Matrix_Rotate_Y(+norm(orange_car_speed) / 8 * delta_time) * orange_car_new_direction;
+    }
+
+    Profiler_BeginZone("collisions");
+    bool is_orange_car_colliding = is_colliding_car_to_scenario(orange_car_new_position, orange_car_new_direction);
+    Profiler_EndZone();
+
+    if (not is_orange_car_colliding)
+    {
+        orange_car_position = orange_car_new_position;
+        orange_car_speed = orange_car_new_speed;
+        orange_car_direction = orange_car_new_direction;
+    }
+    else
+    {
+        orange_car_speed = ZERO;
+    }
+
+    // Define o angulo da direção
+    purple_car_direction_angle = atan2(-purple_car_direction.x, -purple_car_direction.z);
+    orange_car_direction_angle = atan2(-orange_car_direction.x, -orange_car_direction.z);
+
+    // Funções de movimentação da bola
+    // Se a bola está voltando do gol ou não
+    if (is_ball_returning)
+    {
+        //  Se a bola está voltando do gol, é usado curvas de Bezier para fazer a movimentação da bola de volta ao centro. 
+        ball_returning_progress += delta_time / 6;
+
+        if (ball_returning_progress >= 1)
+        {
+            ball_returning_progress = 1;
+            is_ball_returning = false;
+            ball_speed = ZERO;
+        }
+
+        float p = ball_returning_progress * ball_returning_progress * ball_returning_progress;
+        float q = 1 - p;
+
+        ball_position = 
+            1 * q*q*q * ball_returning_point_1 +
+            3 * p*q*q * ball_returning_point_2 +
+            3 * p*p*q * ball_returning_point_3 +
+            1 * p*p*p * ball_returning_point_4;
+        ball_position.w = 1;
+    }
+    else
+    {
+        // A possivel nova posição da bola é salva em uma variavel temporaria
+        glm::vec4 ball_new_position = ball_position;
+
+        ball_new_position += delta_time * ball_speed;
+
+        Profiler_BeginZone("collisions");
+
+        // Se a bola colide com algum dos carros, ela vai na direção contrária do carro, e ambos, a bola e o carro, perdem velocidade, mas a bola ganha velocidade do impacto (quanto mais velocidade o carro possuia, mais veloz é o "retorno" da bola)
+        if (is_colliding_ball_to_car(ball_new_position, purple_car_position, purple_car_direction))
+        {
+            ball_speed = (1.3f * norm(purple_car_speed) + norm(ball_speed) / 1.3f) * (ball_new_position - purple_car_position) / norm(ball_new_position - purple_car_position);
+            ball_speed.y = 0;
+            purple_car_speed /= 1.5f;
+        }
+        if (is_colliding_ball_to_car(ball_new_position, orange_car_position, orange_car_direction))
+        {
+            ball_speed = (1.3f * norm(orange_car_speed) + norm(ball_speed) / 1.3f) * (ball_new_position - orange_car_position) / norm(ball_new_position - orange_car_position);
+            ball_speed.y = 0;
+            orange_car_speed /= 1.5f;
+        }
+
+        // Se a bola colide com alguma parede, ela reflete 
+        if (is_colliding_ball_to_north_wall(ball_new_position) or is_colliding_ball_to_south_wall(ball_new_position))
+        {
+            ball_speed.z = -ball_speed.z;
+        }
+        if (is_colliding_ball_to_east_wall(ball_new_position) or is_colliding_ball_to_west_wall(ball_new_position))
+        {
+            ball_speed.x = -ball_speed.x;
+        }
+
+        Profiler_EndZone();
+
+        // Verica se a bola saiu do cenário, se sim, ela cai
+        if (abs(ball_new_position.z) > FIELD_LENGTH / 2)
+        {
+            ball_speed.y -= std::pow(9.8f, delta_time); 
+        }
+
+        ball_position = ball_new_position;
+
+        // Se a bola está abaixo de -5 metros, ela retorna ao centro
+        if (ball_position.y <= -5)
+        {
+            is_ball_returning = true;
+            ball_returning_progress = 0;
+
+            if (ball_position.z > 0)
+            {
+                ball_returning_point_1 = ball_position;
+                ball_returning_point_2 = glm::vec4(0, FIELD_HEIGHT + 5, FIELD_LENGTH / 2 + 10, 1);
+                ball_returning_point_3 = glm::vec4(0, FIELD_HEIGHT + 12, FIELD_LENGTH / 2, 1);
+                ball_returning_point_4 = glm::vec4(0, BALL_RADIUS, 0, 1);
+            }
+            else
+            {
+                ball_returning_point_1 = ball_position;
+                ball_returning_point_2 = glm::vec4(0, FIELD_HEIGHT + 5, -FIELD_LENGTH / 2 - 10, 1);
+                ball_returning_point_3 = glm::vec4(0, FIELD_HEIGHT + 12, -FIELD_LENGTH / 2, 1);
+                ball_returning_point_4 = glm::vec4(0, BALL_RADIUS, 0, 1);
+            }
+        }
+    }
+
+    Profiler_EndZone();
+}
+
+SimulationInput Simulation_GetInput()
+{
+    SimulationInput input;
+    input.purple = (is_purple_car_moving_front    ? INPUT_FRONT        : 0)
+                 | (is_purple_car_moving_back     ? INPUT_BACK         : 0)
+                 | (is_purple_car_moving_left     ? INPUT_LEFT         : 0)
+                 | (is_purple_car_moving_right    ? INPUT_RIGHT        : 0)
+                 | (is_purple_camera_looking_back ? INPUT_LOOK_BACK    : 0)
+                 | (is_purple_car_looking_at_ball ? INPUT_LOOK_AT_BALL : 0);
+    input.orange = (is_orange_car_moving_front    ? INPUT_FRONT        : 0)
+                 | (is_orange_car_moving_back     ? INPUT_BACK         : 0)
+                 | (is_orange_car_moving_left     ? INPUT_LEFT         : 0)
+                 | (is_orange_car_moving_right    ? INPUT_RIGHT        : 0)
+                 | (is_orange_camera_looking_back ? INPUT_LOOK_BACK    : 0)
+                 | (is_orange_car_looking_at_ball ? INPUT_LOOK_AT_BALL : 0);
+    return input;
+}
+
+void Simulation_SetInput(SimulationInput input)
+{
+    g_StepInput = input;
+}
+
+void Simulation_GetSnapshot(SimulationSnapshot* snapshot)
+{
+    snapshot->purple_car_position        = purple_car_position;
+    snapshot->orange_car_position        = orange_car_position;
+    snapshot->ball_position              = ball_position;
+    snapshot->purple_car_direction_angle = purple_car_direction_angle;
+    snapshot->orange_car_direction_angle = orange_car_direction_angle;
+    snapshot->input                      = g_StepInput;
+}
@@ -1,6 +1,7 @@
 // Based on http://hamelot.io/visualization/opengl-text-without-any-external-libraries/
 //   and on https://github.com/rougier/freetype-gl
 #include <string>
+#include <vector>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -9,18 +10,19 @@
 #include <glm/vec4.hpp>
 
 #include "utils.h"
-#include "dejavufont.h"
-
-GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Função definida em main.cpp
+#include "gpuprogram.hpp"
+#include "dejavufont_sdf.h" // Gerado por tools/sdfgen.cpp a partir de dejavufont.h
 
 const GLchar* const textvertexshader_source = ""
 "#version 330\n"
 "layout (location = 0) in vec4 position;\n"
+"layout (location = 1) in vec2 texcoords;\n"
+"uniform vec2 pixel_scale;\n"
 "out vec2 texCoords;\n"
 "void main()\n"
 "{\n"
-    "gl_Position = vec4(position.xy, 0, 1);\n"
-    "texCoords = position.zw;\n"
+    "gl_Position = vec4(position.xy + position.zw * pixel_scale, 0, 1);\n"
+    "texCoords = texcoords;\n"
 "}\n"
 "\0";
 
@@ -31,7 +33,12 @@ const GLchar* const textfragmentshader_source = ""
 "out vec4 fragColor;\n"
 "void main()\n"
 "{\n"
-    "fragColor = vec4(0, 0, 0, texture(tex, texCoords).r);\n"
+    // O atlas guarda distâncias com sinal: a borda do glifo é o valor 0.5.
+    // A largura da transição é de aproximadamente um pixel da tela, em
+    // qualquer escala.
+    "float distance = texture(tex, texCoords).r;\n"
+    "float width = max(fwidth(distance) * 0.75, 1e-4);\n"
+    "fragColor = vec4(0, 0, 0, smoothstep(0.5 - width, 0.5 + width, distance));\n"
 "}\n"
 "\0";
 
@@ -82,19 +89,59 @@ void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_i
     delete [] log;
 }
 
-GLuint textVAO;
-GLuint textVBO;
-GLuint textprogram_id;
-GLuint texttexture_id;
+// Objetos de GPU, registrados em "gpuresources.hpp" e liberados por
+// TextRendering_Shutdown()
+GpuVertexArray textVAO;
+GpuBuffer      textVBO;
+GpuVertexArray textretainedVAO;
+GpuBuffer      textretainedVBO;
+GpuProgram     textprogram;
+GpuTexture     texttexture;
+GpuSampler     textsampler;
+GLint          textpixelscale_uniform;
+
+// Vértice de texto. A posição é a âncora da string em NDC mais um
+// deslocamento em pixels, convertido no vertex shader; assim o tamanho da
+// janela só é necessário no momento de desenhar.
+struct TextVertex
+{
+    float x, y;   // Âncora (NDC)
+    float dx, dy; // Deslocamento (pixels)
+    float s, t;   // Coordenadas de textura
+};
+
+// Todos os caracteres impressos no quadro, desenhados de uma só vez por
+// TextRendering_Flush()
+static std::vector<TextVertex> g_TextBatch;
+static size_t                  g_TextBufferCapacity = 0;
+
+// Tabela de acesso direto: glifo de cada caractere (ou NULL)
+static const sdf_glyph_t* g_GlyphTable[256];
+
+// Textos retidos (veja TextRendering_CreateText()). Os vértices de todos eles
+// ficam juntos em textretainedVBO, que só é reenviado quando algum muda.
+struct RetainedText
+{
+    std::string str;
+    float       x, y, scale;
+    std::vector<TextVertex> vertices;
+    GLint       first; // Primeiro vértice dentro de textretainedVBO
+};
+static std::vector<RetainedText> g_RetainedTexts;
+static bool                      g_RetainedDirty = false;
+static std::vector<int>          g_RetainedDrawIds; // Textos a desenhar neste quadro
+static std::vector<GLint>        g_RetainedDrawFirst;
+static std::vector<GLsizei>      g_RetainedDrawCount;
 
 void TextRendering_Init()
 {
-    GLuint sampler;
-
-    glGenBuffers(1, &textVBO);
-    glGenVertexArrays(1, &textVAO);
-    glGenTextures(1, &texttexture_id);
-    glGenSamplers(1, &sampler);
+    textVBO.Create("text");
+    textVAO.Create("text");
+    textretainedVBO.Create("retained text");
+    textretainedVAO.Create("retained text");
+    texttexture.Create("text font");
+    textsampler.Create("text font");
+    GLuint sampler = textsampler.Get();
     glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -109,7 +156,8 @@ void TextRendering_Init()
     TextRendering_LoadShader(textfragmentshader_source, textfragmentshader_id);
     glCheckError();
 
-    textprogram_id = CreateGpuProgram(textvertexshader_id, textfragmentshader_id);
+    textprogram = CreateTrackedGpuProgram("text", textvertexshader_id, textfragmentshader_id);
+    GLuint textprogram_id = textprogram.Get();
     glLinkProgram(textprogram_id);
     glCheckError();
 
@@ -119,110 +167,245 @@ void TextRendering_Init()
 
     GLuint textureunit = 31;
     glActiveTexture(GL_TEXTURE0 + textureunit);
-    glBindTexture(GL_TEXTURE_2D, texttexture_id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, dejavufont.tex_width, dejavufont.tex_height, 0, GL_RED, GL_UNSIGNED_BYTE, dejavufont.tex_data);
+    glBindTexture(GL_TEXTURE_2D, texttexture.Get());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, dejavufont_sdf.tex_width, dejavufont_sdf.tex_height, 0, GL_RED, GL_UNSIGNED_BYTE, dejavufont_sdf.tex_data);
+    texttexture.SetSize((size_t)dejavufont_sdf.tex_width * dejavufont_sdf.tex_height);
     glBindSampler(textureunit, sampler);
     glCheckError();
 
-    glBindVertexArray(textVAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-    glBufferData(GL_ARRAY_BUFFER, 24 * sizeof(float), NULL, GL_DYNAMIC_DRAW);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(0);
+    // Mesmo layout de vértices para o lote do quadro e para os textos retidos
+    GLuint vaos[2] = { textVAO.Get(), textretainedVAO.Get() };
+    GLuint vbos[2] = { textVBO.Get(), textretainedVBO.Get() };
+    for (int i = 0; i < 2; ++i)
+    {
+        glBindVertexArray(vaos[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[i]);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    }
     glCheckError();
 
+    textpixelscale_uniform = glGetUniformLocation(textprogram_id, "pixel_scale");
+
     glUseProgram(textprogram_id);
     glUniform1i(texttex_uniform, textureunit);
     glUseProgram(0);
     glCheckError();
 
+    for (size_t i = 0; i < 256; ++i)
+        g_GlyphTable[i] = NULL;
+    for (size_t j = 0; j < dejavufont_sdf.glyphs_count; ++j)
+    {
+        if (dejavufont_sdf.glyphs[j].codepoint < 256)
+            g_GlyphTable[dejavufont_sdf.glyphs[j].codepoint] = &dejavufont_sdf.glyphs[j];
+    }
+
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
     glCheckError();
 }
 
+// Libera os objetos de GPU criados por TextRendering_Init()
+void TextRendering_Shutdown()
+{
+    textVAO.Reset();
+    textVBO.Reset();
+    textretainedVAO.Reset();
+    textretainedVBO.Reset();
+    textprogram.Reset();
+    texttexture.Reset();
+    textsampler.Reset();
+    g_TextBufferCapacity = 0;
+}
+
 float textscale = 1.5f;
 
-void TextRendering_PrintString(GLFWwindow* window, const std::string &str, float x, float y, float scale = 1.0f)
+// Gera os vértices (dois triângulos por glifo) de uma string, acrescentando-os
+// a "out"
+static void LayoutString(const std::string &str, float x, float y, float scale, std::vector<TextVertex>* out)
 {
     scale *= textscale;
-    int width, height;
-    glfwGetWindowSize(window, &width, &height);
-    float sx = scale / width;
-    float sy = scale / height;
+    float pen = 0.0f; // Posição horizontal, em pixels, a partir de x
 
     for (size_t i = 0; i < str.size(); i++)
     {
-        // Find the glyph for the character we are looking for
-        texture_glyph_t *glyph = 0;
-        for (size_t j = 0; j < dejavufont.glyphs_count; ++j)
-        {
-            if (dejavufont.glyphs[j].codepoint == (uint32_t)str[i])
-            {
-                glyph = &dejavufont.glyphs[j];
-                break;
-            }
-        }
+        const sdf_glyph_t *glyph = g_GlyphTable[(unsigned char)str[i]];
         if (!glyph) {
             continue;
         }
-        x += glyph->kerning[0].kerning;
-        float x0 = (float) (x + glyph->offset_x * sx);
-        float y0 = (float) (y + glyph->offset_y * sy);
-        float x1 = (float) (x0 + glyph->width * sx);
-        float y1 = (float) (y0 - glyph->height * sy);
-
-        float s0 = glyph->s0 - 0.5f/dejavufont.tex_width;
-        float t0 = glyph->t0 - 0.5f/dejavufont.tex_height;
-        float s1 = glyph->s1 - 0.5f/dejavufont.tex_width;
-        float t1 = glyph->t1 - 0.5f/dejavufont.tex_height;
-
-        struct {float x, y, s, t;} data[6] = {
-            { x0, y0, s0, t0 },
-            { x0, y1, s0, t1 },
-            { x1, y1, s1, t1 },
-            { x0, y0, s0, t0 },
-            { x1, y1, s1, t1 },
-            { x1, y0, s1, t0 }
+        pen += glyph->kerning[0].kerning * scale;
+        float x0 = pen + glyph->offset_x * scale;
+        float y0 = glyph->offset_y * scale;
+        float x1 = x0 + glyph->width * scale;
+        float y1 = y0 - glyph->height * scale;
+
+        // A margem de cada glifo no atlas SDF já evita amostrar os vizinhos
+        float s0 = glyph->s0;
+        float t0 = glyph->t0;
+        float s1 = glyph->s1;
+        float t1 = glyph->t1;
+
+        TextVertex quad[6] = {
+            { x, y, x0, y0, s0, t0 },
+            { x, y, x0, y1, s0, t1 },
+            { x, y, x1, y1, s1, t1 },
+            { x, y, x0, y0, s0, t0 },
+            { x, y, x1, y1, s1, t1 },
+            { x, y, x1, y0, s1, t0 }
         };
+        out->insert(out->end(), quad, quad + 6);
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        pen += glyph->advance_x * scale;
+    }
+}
 
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-        glDepthFunc(GL_ALWAYS);
-        glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, 24 * sizeof(float), data);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+// Acrescenta os glifos da string ao lote do quadro. Nada é desenhado até
+// TextRendering_Flush(). A janela só é necessária no Flush; o parâmetro é
+// mantido para não mudar a assinatura usada pelo restante do código.
+void TextRendering_PrintString(GLFWwindow* /*window*/, const std::string &str, float x, float y, float scale = 1.0f)
+{
+    LayoutString(str, x, y, scale, &g_TextBatch);
+}
 
-        glUseProgram(textprogram_id);
-        glBindVertexArray(textVAO);
+int TextRendering_CreateText()
+{
+    RetainedText text;
+    text.x = text.y = text.scale = 0.0f;
+    text.first = 0;
+    g_RetainedTexts.push_back(text);
+    return (int)g_RetainedTexts.size() - 1;
+}
 
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+void TextRendering_SetText(int text_id, const std::string &str, float x, float y, float scale = 1.0f)
+{
+    RetainedText& text = g_RetainedTexts[text_id];
+    if (text.str == str && text.x == x && text.y == y && text.scale == scale)
+        return;
+
+    text.str   = str;
+    text.x     = x;
+    text.y     = y;
+    text.scale = scale;
+    text.vertices.clear();
+    LayoutString(str, x, y, scale, &text.vertices);
+    g_RetainedDirty = true;
+}
 
-        glBindVertexArray(0);
-        glUseProgram(0);
-        glDepthFunc(GL_LESS);
+void TextRendering_DrawText(int text_id)
+{
+    // Só registramos o intervalo; o desenho é feito em TextRendering_Flush()
+    if (!g_RetainedTexts[text_id].vertices.empty())
+        g_RetainedDrawIds.push_back(text_id);
+}
 
-        glDisable(GL_BLEND);
+// Reenvia os vértices de todos os textos retidos, após alguma mudança
+static void UploadRetainedTexts()
+{
+    std::vector<TextVertex> vertices;
+    for (size_t i = 0; i < g_RetainedTexts.size(); ++i)
+    {
+        g_RetainedTexts[i].first = (GLint)vertices.size();
+        vertices.insert(vertices.end(), g_RetainedTexts[i].vertices.begin(), g_RetainedTexts[i].vertices.end());
+    }
 
-        x += (glyph->advance_x * sx);
+    glBindBuffer(GL_ARRAY_BUFFER, textretainedVBO.Get());
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TextVertex), vertices.data(), GL_DYNAMIC_DRAW);
+    textretainedVBO.SetSize(vertices.size() * sizeof(TextVertex));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    g_RetainedDirty = false;
+}
+
+static void FlushTextBatch();
+
+// Desenha todo o texto acumulado desde o último Flush: uma chamada de desenho
+// para os textos retidos e outra (com um único upload) para o lote imediato.
+void TextRendering_Flush(GLFWwindow* window)
+{
+    if (g_TextBatch.empty() && g_RetainedDrawIds.empty())
+        return;
+
+    int width, height;
+    glfwGetWindowSize(window, &width, &height);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glDepthFunc(GL_ALWAYS);
+
+    glUseProgram(textprogram.Get());
+    glUniform2f(textpixelscale_uniform, 1.0f / width, 1.0f / height);
+
+    // Textos retidos: nenhum trabalho de CPU, a menos que algum tenha mudado.
+    // Todos são desenhados com uma única chamada.
+    if (!g_RetainedDrawIds.empty())
+    {
+        if (g_RetainedDirty)
+            UploadRetainedTexts();
+
+        g_RetainedDrawFirst.clear();
+        g_RetainedDrawCount.clear();
+        for (size_t i = 0; i < g_RetainedDrawIds.size(); ++i)
+        {
+            const RetainedText& text = g_RetainedTexts[g_RetainedDrawIds[i]];
+            g_RetainedDrawFirst.push_back(text.first);
+            g_RetainedDrawCount.push_back((GLsizei)text.vertices.size());
+        }
+
+        glBindVertexArray(textretainedVAO.Get());
+        glMultiDrawArrays(GL_TRIANGLES, g_RetainedDrawFirst.data(), g_RetainedDrawCount.data(), (GLsizei)g_RetainedDrawFirst.size());
+
+        g_RetainedDrawIds.clear();
     }
+
+    if (!g_TextBatch.empty())
+        FlushTextBatch();
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glDepthFunc(GL_LESS);
+    glDisable(GL_BLEND);
+}
+
+// Envia e desenha o lote de texto imediato do quadro
+static void FlushTextBatch()
+{
+    glBindBuffer(GL_ARRAY_BUFFER, textVBO.Get());
+    size_t size = g_TextBatch.size() * sizeof(TextVertex);
+    if (size > g_TextBufferCapacity)
+    {
+        // Crescemos o buffer em potências de dois, para realocar raramente
+        g_TextBufferCapacity = 1024;
+        while (g_TextBufferCapacity < size)
+            g_TextBufferCapacity *= 2;
+    }
+    // Descartamos o conteúdo anterior ("orphaning"), evitando esperar que a
+    // GPU termine o desenho do quadro passado.
+    glBufferData(GL_ARRAY_BUFFER, g_TextBufferCapacity, NULL, GL_STREAM_DRAW);
+    textVBO.SetSize(g_TextBufferCapacity);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, g_TextBatch.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(textVAO.Get());
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)g_TextBatch.size());
+
+    g_TextBatch.clear();
 }
 
 float TextRendering_LineHeight(GLFWwindow* window)
 {
     int width, height;
     glfwGetWindowSize(window, &width, &height);
-    return dejavufont.height / height * textscale;
+    return dejavufont_sdf.height / height * textscale;
 }
 
 float TextRendering_CharWidth(GLFWwindow* window)
 {
     int width, height;
     glfwGetWindowSize(window, &width, &height);
-    return dejavufont.glyphs[32].advance_x / width * textscale;
+    return dejavufont_sdf.glyphs[32].advance_x / width * textscale;
 }
 
 void TextRendering_PrintMatrix(GLFWwindow* window, glm::mat4 M, float x, float y, float scale = 1.0f)
@@ -0,0 +1,436 @@
+#include "../include/textureloader.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include "../include/glad/glad.h"
+#include "../include/stb_image.h"
+#include "../include/archive.hpp"
+#include "../include/cookedformat.hpp"
+#include "../include/gpuresources.hpp"
+#include "../include/jobs.hpp"
+
+// Constantes de GL_EXT_texture_compression_s3tc + GL_EXT_texture_sRGB, que
+// não fazem parte do glad gerado para OpenGL 3.3 core.
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT 0x8C4C
+#endif
+
+// Um carregamento passa pelas etapas abaixo, alternando entre as threads
+// auxiliares (W) e a thread do contexto OpenGL (GL):
+//
+//   (W)  lê o arquivo e o cabeçalho da imagem
+//   (GL) cria e mapeia um PBO do tamanho da imagem
+//   (W)  decodifica a imagem para dentro do PBO
+//   (GL) faz o upload do PBO para a textura e gera os mipmaps
+//
+// Texturas pré-processadas por "tools/cooker.cpp" (".ctex") já trazem todos
+// os níveis de mipmap: o arquivo é copiado como está para o PBO, e cada nível
+// é enviado a partir do seu deslocamento, sem decodificação nem
+// glGenerateMipmap(). Níveis comprimidos em BC1 são enviados com
+// glCompressedTexImage2D(); se o driver não suporta S3TC, são descomprimidos
+// na CPU, dentro do PBO.
+//
+// Os objetos da GPU de um carregamento são liberados ou transferidos para a
+// unidade ainda na thread OpenGL, em UploadTexture(): a última referência a
+// um TextureJob pode ser solta por uma thread auxiliar.
+struct TextureJob
+{
+    std::string    filename;
+    GLuint         texture_unit;
+    GpuTexture     texture;
+    GpuBuffer      pbo;
+    void*          mapped;
+    int            width;
+    int            height;
+    GLsizeiptr     pbo_size;
+    AssetFile      file;
+
+    // Níveis de mipmap de uma textura pré-processada (vazio para imagens),
+    // com os deslocamentos dentro do PBO. Se "decompress" é verdadeiro, os
+    // blocos BC1 em "compressed_levels" são convertidos para RGB8 na CPU.
+    std::vector<CookedTextureLevel> cooked_levels;
+    std::vector<CookedTextureLevel> compressed_levels;
+    uint32_t       cooked_format;
+    bool           decompress;
+};
+
+typedef std::shared_ptr<TextureJob> TextureJobPtr;
+
+// Objetos associados a cada unidade de textura. A textura só é trocada quando
+// a nova imagem está pronta; ao recarregar, a anterior continua em uso até
+// lá.
+struct TextureSlot
+{
+    GpuTexture texture;
+    GpuSampler sampler;
+};
+
+static TextureSlot      g_TextureSlots[TEXTURELOADER_MAX_UNITS];
+static GpuTexture       g_PlaceholderTexture;
+static bool             g_SupportsBC1        = false;
+static std::atomic<int> g_PendingTextures(0);
+
+// Uma imagem com erro na recarga não encerra o programa: a unidade continua
+// com a textura anterior, e os objetos do carregamento são liberados. Sem uma
+// textura anterior (primeiro carregamento), não há como continuar.
+static void TextureFailed(const TextureJobPtr& job)
+{
+    Jobs_SubmitMainThread([job]
+    {
+        fprintf(stderr, "ERROR: Cannot open image file \"%s\".\n", job->filename.c_str());
+        if (!g_TextureSlots[job->texture_unit].texture.IsValid())
+            std::exit(EXIT_FAILURE);
+
+        if (job->mapped != NULL)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job->pbo.Get());
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            job->mapped = NULL;
+        }
+        job->pbo.Reset();
+        job->texture.Reset();
+
+        fprintf(stderr, "ERROR: Keeping the previous texture in unit %u.\n", job->texture_unit);
+        g_PendingTextures -= 1;
+    });
+}
+
+// (GL) Upload a partir do PBO: com um GL_PIXEL_UNPACK_BUFFER ligado, o último
+// argumento de glTexImage2D() é um deslocamento dentro do buffer, e a cópia é
+// feita pelo driver sem passar novamente pela CPU.
+static void UploadTexture(const TextureJobPtr& job)
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job->pbo.Get());
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+
+    glActiveTexture(GL_TEXTURE0 + job->texture_unit);
+    glBindTexture(GL_TEXTURE_2D, job->texture.Get());
+    if (job->cooked_levels.empty())
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8, job->width, job->height, 0, GL_RGB, GL_UNSIGNED_BYTE, (void*)0);
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        // Os mipmaps somam cerca de 1/3 do nível 0
+        job->texture.SetSize((size_t)job->width * job->height * 3 * 4 / 3);
+    }
+    else
+    {
+        size_t size = 0;
+        bool compressed = job->cooked_format == COOKED_FORMAT_BC1_SRGB && !job->decompress;
+        for (size_t i = 0; i < job->cooked_levels.size(); ++i)
+        {
+            const CookedTextureLevel& level = job->cooked_levels[i];
+            if (compressed)
+                glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, level.width, level.height, 0, level.size, (void*)(size_t)level.offset);
+            else
+                glTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_SRGB8, level.width, level.height, 0, GL_RGB, GL_UNSIGNED_BYTE, (void*)(size_t)level.offset);
+            size += level.size;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)job->cooked_levels.size() - 1);
+        job->texture.SetSize(size);
+    }
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    job->pbo.Reset();
+    job->mapped = NULL;
+
+    // A nova textura já está ligada à unidade; a anterior (provisória ou de
+    // um carregamento anterior) é liberada aqui
+    g_TextureSlots[job->texture_unit].texture = std::move(job->texture);
+
+    printf("Imagem \"%s\" carregada (%dx%d).\n", job->filename.c_str(), job->width, job->height);
+    g_PendingTextures -= 1;
+}
+
+// Descomprime um nível BC1 para RGB8. Usado somente quando o driver não
+// suporta S3TC.
+static void DecompressBC1(const unsigned char* blocks, int width, int height, unsigned char* out)
+{
+    int blocks_x = (width + 3) / 4;
+    int blocks_y = (height + 3) / 4;
+    for (int by = 0; by < blocks_y; ++by)
+    {
+        for (int bx = 0; bx < blocks_x; ++bx)
+        {
+            const unsigned char* block = blocks + 8*((size_t)by*blocks_x + bx);
+            unsigned int color0 = block[0] | (block[1] << 8);
+            unsigned int color1 = block[2] | (block[3] << 8);
+
+            int palette[4][3];
+            palette[0][0] = ((color0 >> 11) & 31) * 255 / 31;
+            palette[0][1] = ((color0 >> 5) & 63) * 255 / 63;
+            palette[0][2] = (color0 & 31) * 255 / 31;
+            palette[1][0] = ((color1 >> 11) & 31) * 255 / 31;
+            palette[1][1] = ((color1 >> 5) & 63) * 255 / 63;
+            palette[1][2] = (color1 & 31) * 255 / 31;
+            for (int c = 0; c < 3; ++c)
+            {
+                if (color0 > color1)
+                {
+                    palette[2][c] = (2*palette[0][c] + palette[1][c]) / 3;
+                    palette[3][c] = (palette[0][c] + 2*palette[1][c]) / 3;
+                }
+                else
+                {
+                    palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                    palette[3][c] = 0;
+                }
+            }
+
+            for (int i = 0; i < 16; ++i)
+            {
+                int x = 4*bx + (i % 4);
+                int y = 4*by + (i / 4);
+                if (x >= width || y >= height)
+                    continue;
+                int index = (block[4 + i/4] >> (2 * (i % 4))) & 3;
+                for (int c = 0; c < 3; ++c)
+                    out[3*((size_t)y*width + x) + c] = (unsigned char)palette[index][c];
+            }
+        }
+    }
+}
+
+// (W) Decodifica a imagem diretamente para a memória mapeada do PBO
+static void DecodeTexture(const TextureJobPtr& job)
+{
+    if (job->decompress)
+    {
+        for (size_t i = 0; i < job->cooked_levels.size(); ++i)
+        {
+            const CookedTextureLevel& src = job->compressed_levels[i];
+            const CookedTextureLevel& dst = job->cooked_levels[i];
+            DecompressBC1((const unsigned char*)job->file.data + src.offset, dst.width, dst.height, (unsigned char*)job->mapped + dst.offset);
+        }
+        std::vector<char>().swap(job->file.storage);
+        Jobs_SubmitMainThread([job] { UploadTexture(job); });
+        return;
+    }
+    if (!job->cooked_levels.empty())
+    {
+        memcpy(job->mapped, job->file.data, job->file.size);
+        std::vector<char>().swap(job->file.storage);
+        Jobs_SubmitMainThread([job] { UploadTexture(job); });
+        return;
+    }
+
+    int width, height, channels;
+    unsigned char* data = stbi_load_from_memory((const stbi_uc*)job->file.data, (int)job->file.size, &width, &height, &channels, 3);
+    std::vector<char>().swap(job->file.storage);
+
+    if (data == NULL || width != job->width || height != job->height)
+    {
+        stbi_image_free(data);
+        TextureFailed(job);
+        return;
+    }
+
+    memcpy(job->mapped, data, (size_t)width * height * 3);
+    stbi_image_free(data);
+
+    Jobs_SubmitMainThread([job] { UploadTexture(job); });
+}
+
+// (GL) Cria e mapeia um PBO do tamanho exato da imagem
+static void MapPixelBuffer(const TextureJobPtr& job)
+{
+    GLsizeiptr size = job->pbo_size;
+
+    job->pbo.Create(job->filename.c_str());
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, job->pbo.Get());
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+    job->pbo.SetSize(size);
+    job->mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if (job->mapped == NULL)
+    {
+        TextureFailed(job);
+        return;
+    }
+
+    Jobs_Submit([job] { DecodeTexture(job); });
+}
+
+// Se o arquivo é uma textura pré-processada válida, guarda a descrição dos
+// seus níveis. O PBO recebe o arquivo inteiro, e o deslocamento de cada nível
+// dentro do arquivo é também o seu deslocamento dentro do PBO.
+static bool ReadCookedHeader(const TextureJobPtr& job)
+{
+    const CookedTextureHeader* header = (const CookedTextureHeader*)job->file.data;
+    if (job->file.size < sizeof(CookedTextureHeader) || header->magic != COOKED_TEXTURE_MAGIC)
+        return false;
+
+    const CookedTextureLevel* levels = (const CookedTextureLevel*)(header + 1);
+    bool valid = header->version == COOKED_VERSION
+              && (header->format == COOKED_FORMAT_SRGB8 || header->format == COOKED_FORMAT_BC1_SRGB)
+              && header->num_levels > 0
+              && (job->file.size - sizeof(CookedTextureHeader)) / sizeof(CookedTextureLevel) >= header->num_levels;
+    for (uint32_t i = 0; valid && i < header->num_levels; ++i)
+        valid = levels[i].offset <= job->file.size && levels[i].size <= job->file.size - levels[i].offset;
+    if (!valid)
+        return false;
+
+    job->width         = (int)header->width;
+    job->height        = (int)header->height;
+    job->pbo_size      = (GLsizeiptr)job->file.size;
+    job->cooked_format = header->format;
+    job->cooked_levels.assign(levels, levels + header->num_levels);
+
+    // Sem suporte a S3TC: o PBO recebe os níveis já descomprimidos
+    if (header->format == COOKED_FORMAT_BC1_SRGB && !g_SupportsBC1)
+    {
+        job->decompress = true;
+        job->compressed_levels = job->cooked_levels;
+        uint32_t offset = 0;
+        for (size_t i = 0; i < job->cooked_levels.size(); ++i)
+        {
+            CookedTextureLevel& level = job->cooked_levels[i];
+            if (level.size < ((level.width + 3) / 4) * ((level.height + 3) / 4) * 8)
+                return false;
+            level.offset = offset;
+            level.size   = level.width * level.height * 3;
+            offset += level.size;
+        }
+        job->pbo_size = offset;
+    }
+    return true;
+}
+
+// (W) Obtém os bytes do arquivo uma única vez (do pacote de assets, sem
+// cópia, ou do disco); o cabeçalho nos dá o tamanho do PBO e os bytes ficam
+// guardados para a decodificação.
+static void ReadTextureFile(const TextureJobPtr& job)
+{
+    if (Asset_Load(job->filename.c_str(), &job->file))
+    {
+        if (ReadCookedHeader(job))
+        {
+            Jobs_SubmitMainThread([job] { MapPixelBuffer(job); });
+            return;
+        }
+
+        int channels;
+        if (stbi_info_from_memory((const stbi_uc*)job->file.data, (int)job->file.size, &job->width, &job->height, &channels))
+        {
+            job->pbo_size = (GLsizeiptr)job->width * job->height * 3;
+            Jobs_SubmitMainThread([job] { MapPixelBuffer(job); });
+            return;
+        }
+    }
+    TextureFailed(job);
+}
+
+void TextureLoader_Init()
+{
+    // A configuração abaixo é global na stb_image, então a fazemos antes de
+    // submeter qualquer decodificação.
+    stbi_set_flip_vertically_on_load(true);
+
+    // Texturas comprimidas em BC1 (veja "tools/cooker.cpp") exigem S3TC com
+    // sRGB, que não faz parte do OpenGL 3.3 core.
+    bool has_s3tc = false, has_srgb = false;
+    GLint num_extensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+    for (GLint i = 0; i < num_extensions; ++i)
+    {
+        const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (strcmp(name, "GL_EXT_texture_compression_s3tc") == 0)
+            has_s3tc = true;
+        else if (strcmp(name, "GL_EXT_texture_sRGB") == 0)
+            has_srgb = true;
+    }
+    g_SupportsBC1 = has_s3tc && has_srgb;
+    if (!g_SupportsBC1)
+        printf("S3TC não suportado; texturas BC1 serão descomprimidas na CPU.\n");
+
+    // Textura provisória: um único texel cinza
+    const unsigned char gray[3] = { 128, 128, 128 };
+    g_PlaceholderTexture.Create("placeholder");
+    glBindTexture(GL_TEXTURE_2D, g_PlaceholderTexture.Get());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, gray);
+    g_PlaceholderTexture.SetSize(sizeof(gray));
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void TextureLoader_Request(const char* filename, GLuint texture_unit)
+{
+    if (texture_unit >= TEXTURELOADER_MAX_UNITS)
+    {
+        fprintf(stderr, "ERROR: Texture unit %u is out of range.\n", texture_unit);
+        std::exit(EXIT_FAILURE);
+    }
+
+    printf("Carregando imagem \"%s\" em segundo plano...\n", filename);
+
+    TextureJobPtr job = std::make_shared<TextureJob>();
+    job->filename      = filename;
+    job->texture_unit  = texture_unit;
+    job->mapped        = NULL;
+    job->width         = 0;
+    job->height        = 0;
+    job->pbo_size      = 0;
+    job->cooked_format = 0;
+    job->decompress    = false;
+
+    job->texture.Create(filename);
+
+    // O sampler é criado no primeiro carregamento da unidade e mantido nos
+    // seguintes
+    TextureSlot& slot = g_TextureSlots[texture_unit];
+    if (!slot.sampler.IsValid())
+    {
+        slot.sampler.Create(filename);
+        GLuint sampler_id = slot.sampler.Get();
+
+        // Veja slides 95-96 do documento Aula_20_Mapeamento_de_Texturas.pdf
+        glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+        glSamplerParameteri(sampler_id, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+
+        // Parâmetros de amostragem da textura.
+        glSamplerParameteri(sampler_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glSamplerParameteri(sampler_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindSampler(texture_unit, sampler_id);
+    }
+
+    // Até que a imagem esteja pronta, a unidade usa a textura provisória, ou
+    // a textura anterior, se esta é uma recarga
+    if (!slot.texture.IsValid())
+    {
+        glActiveTexture(GL_TEXTURE0 + texture_unit);
+        glBindTexture(GL_TEXTURE_2D, g_PlaceholderTexture.Get());
+    }
+
+    g_PendingTextures += 1;
+    Jobs_Submit([job] { ReadTextureFile(job); });
+}
+
+bool TextureLoader_IsIdle()
+{
+    return g_PendingTextures == 0;
+}
+
+void TextureLoader_Shutdown()
+{
+    for (int i = 0; i < TEXTURELOADER_MAX_UNITS; ++i)
+    {
+        g_TextureSlots[i].texture.Reset();
+        g_TextureSlots[i].sampler.Reset();
+    }
+    g_PlaceholderTexture.Reset();
+}
@@ -0,0 +1,331 @@
+// Microbenchmarks das rotinas de colisão e do passo da simulação. Uso, a
+// partir da raiz do projeto:
+//
+//   benchmark.exe [--filter texto] [--json arquivo]
+//
+// Cada caso é repetido até ocupar BENCHMARK_MIN_TIME segundos. A saída JSON
+// segue o formato do Google Benchmark, então dois resultados podem ser
+// comparados com "compare.py" da mesma forma que entre commits.
+//
+// Compilado com -DPROFILER_DISABLED, para que as zonas do profiler em
+// simulation.cpp não entrem nas medidas.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/constants.hpp"
+#include "../include/collisions.hpp"
+#include "../include/simulation.hpp"
+
+#define BENCHMARK_MIN_TIME    0.5 // Segundos por caso
+#define BENCHMARK_REPETITIONS 3   // Reportamos a repetição mais rápida
+
+// Impede que o compilador descarte os resultados das rotinas medidas
+static volatile int g_Sink = 0;
+
+// Gerador pseudoaleatório fixo, para que as entradas sejam as mesmas em todas
+// as execuções. É reiniciado no começo de cada caso, de modo que as entradas
+// de um caso não dependem de quais casos rodaram antes (--filter).
+#define BENCHMARK_SEED 12345u
+static uint32_t g_RandomState = BENCHMARK_SEED;
+
+static float RandomFloat(float min, float max)
+{
+    g_RandomState = g_RandomState * 1664525u + 1013904223u;
+    return min + (max - min) * ((g_RandomState >> 8) / 16777216.0f);
+}
+
+// Posições espalhadas pelo campo (incluindo um pouco além das paredes), para
+// que parte dos testes colida e parte não
+static std::vector<glm::vec4> RandomPositions(int count, float height)
+{
+    std::vector<glm::vec4> positions(count);
+    for (int i = 0; i < count; ++i)
+        positions[i] = glm::vec4(RandomFloat(-FIELD_WIDTH / 2 - 5, FIELD_WIDTH / 2 + 5), height, RandomFloat(-FIELD_LENGTH / 2 - 5, FIELD_LENGTH / 2 + 5), 1);
+    return positions;
+}
+
+static std::vector<glm::vec4> RandomDirections(int count)
+{
+    std::vector<glm::vec4> directions(count);
+    for (int i = 0; i < count; ++i)
+    {
+        float angle = RandomFloat(0, 2 * PI);
+        directions[i] = glm::vec4(std::sin(angle), 0, std::cos(angle), 0);
+    }
+    return directions;
+}
+
+// Entradas de um caso, geradas por uma função "setup" antes da medida, para
+// que a geração não entre no tempo medido
+struct BenchmarkInput
+{
+    int                    count;
+    std::vector<glm::vec4> balls;
+    std::vector<glm::vec4> cars;
+    std::vector<glm::vec4> directions;
+};
+
+typedef void (*BenchmarkSetup)(int arg, BenchmarkInput* input);
+
+// Cada caso executa "iterations" vezes e retorna quantos itens (testes de
+// colisão, passos da simulação) foram processados
+typedef uint64_t (*BenchmarkFunction)(uint64_t iterations, const BenchmarkInput& input);
+
+static void SetupBallToCar(int count, BenchmarkInput* input)
+{
+    input->balls      = RandomPositions(count, BALL_RADIUS);
+    input->cars       = RandomPositions(count, CAR_HEIGHT / 2);
+    input->directions = RandomDirections(count);
+
+    // O carro fica sempre perto da bola, como no jogo
+    for (int i = 0; i < count; ++i)
+        input->cars[i] = input->balls[i] + glm::vec4(RandomFloat(-6, 6), CAR_HEIGHT / 2 - BALL_RADIUS, RandomFloat(-6, 6), 0);
+}
+
+static uint64_t BM_BallToCar(uint64_t iterations, const BenchmarkInput& input)
+{
+    int hits = 0;
+    for (uint64_t it = 0; it < iterations; ++it)
+        for (int i = 0; i < input.count; ++i)
+            hits += is_colliding_ball_to_car(input.balls[i], input.cars[i], input.directions[i]);
+    g_Sink += hits;
+    return iterations * input.count;
+}
+
+static void SetupBallToWalls(int count, BenchmarkInput* input)
+{
+    input->balls = RandomPositions(count, BALL_RADIUS);
+}
+
+static uint64_t BM_BallToWalls(uint64_t iterations, const BenchmarkInput& input)
+{
+    int hits = 0;
+    for (uint64_t it = 0; it < iterations; ++it)
+    {
+        for (int i = 0; i < input.count; ++i)
+        {
+            hits += is_colliding_ball_to_north_wall(input.balls[i]);
+            hits += is_colliding_ball_to_south_wall(input.balls[i]);
+            hits += is_colliding_ball_to_east_wall(input.balls[i]);
+            hits += is_colliding_ball_to_west_wall(input.balls[i]);
+        }
+    }
+    g_Sink += hits;
+    return iterations * input.count;
+}
+
+static void SetupCarToScenario(int count, BenchmarkInput* input)
+{
+    input->cars       = RandomPositions(count, CAR_HEIGHT / 2);
+    input->directions = RandomDirections(count);
+}
+
+static uint64_t BM_CarToScenario(uint64_t iterations, const BenchmarkInput& input)
+{
+    int hits = 0;
+    for (uint64_t it = 0; it < iterations; ++it)
+        for (int i = 0; i < input.count; ++i)
+            hits += is_colliding_car_to_scenario(input.cars[i], input.directions[i]);
+    g_Sink += hits;
+    return iterations * input.count;
+}
+
+// Passo completo da simulação (atrito, integração e colisões), com os dois
+// carros acelerando e fazendo curvas, de modo a colidir com a bola e com as
+// paredes. "ticks" (input.count) passos por iteração; a partida recomeça a
+// cada iteração. As entradas são determinísticas, então não há "setup".
+static uint64_t BM_SimulationStep(uint64_t iterations, const BenchmarkInput& input)
+{
+    int ticks = input.count;
+    for (uint64_t it = 0; it < iterations; ++it)
+    {
+        Simulation_Reset();
+        for (int tick = 0; tick < ticks; ++tick)
+        {
+            SimulationInput input;
+            input.purple = INPUT_FRONT | ((tick / 90) % 3 == 1 ? INPUT_LEFT : 0);
+            input.orange = INPUT_FRONT | ((tick / 70) % 4 == 2 ? INPUT_RIGHT : 0);
+            Simulation_SetInput(input);
+            Simulation_Step(SIMULATION_TICK);
+        }
+    }
+    g_Sink += (int)ball_position.x;
+    return iterations * ticks;
+}
+
+struct Benchmark
+{
+    const char*       name;
+    BenchmarkSetup    setup; // Pode ser NULL
+    BenchmarkFunction function;
+    std::vector<int>  args;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    uint64_t    iterations;
+    double      real_ns; // Por item
+    double      cpu_ns;  // Por item
+    double      items_per_second;
+};
+
+static BenchmarkResult RunBenchmark(const Benchmark& benchmark, int arg)
+{
+    BenchmarkResult result;
+    result.name = std::string(benchmark.name) + "/" + std::to_string(arg);
+
+    // As mesmas entradas são usadas na calibração e em todas as repetições
+    g_RandomState = BENCHMARK_SEED;
+    BenchmarkInput input;
+    input.count = arg;
+    if (benchmark.setup != NULL)
+        benchmark.setup(arg, &input);
+
+    // Dobramos as iterações até que uma execução dure ao menos 10% do tempo
+    // mínimo, e então estimamos quantas são necessárias
+    uint64_t iterations = 1;
+    for (;;)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        benchmark.function(iterations, input);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= BENCHMARK_MIN_TIME / 10)
+        {
+            iterations = (uint64_t)(iterations * BENCHMARK_MIN_TIME / elapsed) + 1;
+            break;
+        }
+        iterations *= 2;
+    }
+
+    result.iterations = iterations;
+    result.real_ns = result.cpu_ns = 1e300;
+    for (int repetition = 0; repetition < BENCHMARK_REPETITIONS; ++repetition)
+    {
+        std::clock_t cpu_start = std::clock();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        uint64_t items = benchmark.function(iterations, input);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double cpu_elapsed = (double)(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+        if (elapsed * 1e9 / items < result.real_ns)
+        {
+            result.real_ns = elapsed * 1e9 / items;
+            result.cpu_ns  = cpu_elapsed * 1e9 / items;
+            result.items_per_second = items / elapsed;
+        }
+    }
+    return result;
+}
+
+// Caminhos no Windows contêm barras invertidas, que precisam de escape em JSON
+static std::string JsonEscape(const char* str)
+{
+    std::string escaped;
+    for (; *str; ++str)
+    {
+        if (*str == '\\' || *str == '"')
+            escaped.push_back('\\');
+        escaped.push_back(*str);
+    }
+    return escaped;
+}
+
+static bool WriteJson(const char* filename, const char* executable, const std::vector<BenchmarkResult>& results)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", filename);
+        return false;
+    }
+
+    char date[64];
+    std::time_t now = std::time(NULL);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    fprintf(file, "{\n  \"context\": {\n");
+    fprintf(file, "    \"date\": \"%s\",\n", date);
+    fprintf(file, "    \"executable\": \"%s\",\n", JsonEscape(executable).c_str());
+    fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+    fprintf(file, "    \"library_build_type\": \"release\"\n  },\n");
+    fprintf(file, "  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchmarkResult& result = results[i];
+        fprintf(file, "    {\n");
+        fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+        fprintf(file, "      \"run_name\": \"%s\",\n", result.name.c_str());
+        fprintf(file, "      \"run_type\": \"iteration\",\n");
+        fprintf(file, "      \"iterations\": %llu,\n", (unsigned long long)result.iterations);
+        fprintf(file, "      \"real_time\": %.4f,\n", result.real_ns);
+        fprintf(file, "      \"cpu_time\": %.4f,\n", result.cpu_ns);
+        fprintf(file, "      \"time_unit\": \"ns\",\n");
+        fprintf(file, "      \"items_per_second\": %.1f\n", result.items_per_second);
+        fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+
+    bool ok = !ferror(file);
+    fclose(file);
+    if (!ok)
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", filename);
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* filter = NULL;
+    const char* json   = NULL;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            json = argv[++i];
+        else
+        {
+            fprintf(stderr, "Uso: %s [--filter texto] [--json arquivo]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // A simulação tem sempre dois carros e uma bola; as rotinas de colisão
+    // são medidas sobre lotes de tamanhos diferentes, para expor efeitos de
+    // cache, e o passo completo sobre partidas de durações diferentes.
+    std::vector<Benchmark> benchmarks;
+    benchmarks.push_back({ "collision/ball_to_car",     SetupBallToCar,     BM_BallToCar,      { 1, 64, 4096 } });
+    benchmarks.push_back({ "collision/ball_to_walls",   SetupBallToWalls,   BM_BallToWalls,    { 1, 64, 4096 } });
+    benchmarks.push_back({ "collision/car_to_scenario", SetupCarToScenario, BM_CarToScenario,  { 1, 64, 4096 } });
+    benchmarks.push_back({ "simulation/step",           NULL,               BM_SimulationStep, { 120, 1200, 12000 } });
+
+    printf("%-36s %14s %14s %16s\n", "Benchmark", "ns/item", "CPU ns/item", "Itens/s");
+    std::vector<BenchmarkResult> results;
+    for (size_t i = 0; i < benchmarks.size(); ++i)
+    {
+        for (size_t j = 0; j < benchmarks[i].args.size(); ++j)
+        {
+            std::string name = std::string(benchmarks[i].name) + "/" + std::to_string(benchmarks[i].args[j]);
+            if (filter != NULL && name.find(filter) == std::string::npos)
+                continue;
+
+            BenchmarkResult result = RunBenchmark(benchmarks[i], benchmarks[i].args[j]);
+            printf("%-36s %14.2f %14.2f %16.0f\n", result.name.c_str(), result.real_ns, result.cpu_ns, result.items_per_second);
+            fflush(stdout);
+            results.push_back(result);
+        }
+    }
+
+    if (json != NULL && !WriteJson(json, argv[0], results))
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
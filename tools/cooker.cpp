@@ -0,0 +1,852 @@
+// Ferramenta de linha de comando que pré-processa os assets do jogo, para que
+// a inicialização não precise fazer nenhum trabalho pesado de CPU. Uso:
+//
+//   cooker.exe data/sphere.obj data/cooked/sphere.cmsh
+//   cooker.exe data/grass.jpg  data/cooked/grass.ctex
+//   cooker.exe --bc1 data/grass.jpg data/cooked/grass.ctex
+//
+// Modelos (".obj" -> ".cmsh"):
+//   - normais computadas como em ComputeNormals() (veja "normals.cpp")
+//   - vértices iguais soldados, gerando uma malha indexada
+//   - triângulos reordenados para o cache de vértices (Forsyth) e, em
+//     seguida, agrupados e ordenados para reduzir overdraw
+//   - vértices na ordem do primeiro uso e quantizados (CookedVertex)
+//
+// Imagens (".jpg", ".png", ... -> ".ctex"):
+//   - cadeia completa de mipmaps, filtrada em espaço linear
+//   - com "--bc1", cada nível é comprimido em blocos BC1 (6:1 em relação a
+//     RGB8), enviados com glCompressedTexImage2D()
+//
+// Os formatos estão descritos em "include/cookedformat.hpp".
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "../include/tiny_obj_loader.h"
+#include "../include/stb_image.h"
+#include "../include/normals.hpp"
+#include "../include/cookedformat.hpp"
+
+// Número de vértices no cache simulado pelas otimizações abaixo
+#define VERTEX_CACHE_SIZE 32
+
+// ---------------------------------------------------------------------------
+// Quantização
+// ---------------------------------------------------------------------------
+
+static uint16_t FloatToHalf(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign     = (bits >> 16) & 0x8000;
+    int32_t  exponent = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (exponent <= 0)
+    {
+        // Muito pequeno: subnormal ou zero
+        if (exponent < -10)
+            return (uint16_t)sign;
+        mantissa |= 0x800000;
+        uint32_t shift = (uint32_t)(14 - exponent);
+        uint32_t half  = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1)
+            half += 1;
+        return (uint16_t)(sign | half);
+    }
+    if (exponent >= 31)
+        return (uint16_t)(sign | 0x7C00); // Infinito
+
+    uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000)
+        half += 1; // Arredondamento; pode propagar para o expoente
+    return (uint16_t)half;
+}
+
+static uint32_t PackSnorm10(float value)
+{
+    value = std::max(-1.0f, std::min(1.0f, value));
+    int32_t q = (int32_t)std::floor(value * 511.0f + 0.5f);
+    return (uint32_t)q & 0x3FF;
+}
+
+static uint32_t PackNormal(float x, float y, float z)
+{
+    float length = std::sqrt(x*x + y*y + z*z);
+    if (length > 0.0f)
+    {
+        x /= length;
+        y /= length;
+        z /= length;
+    }
+    return PackSnorm10(x) | (PackSnorm10(y) << 10) | (PackSnorm10(z) << 20);
+}
+
+// ---------------------------------------------------------------------------
+// Ordenação para o cache de vértices. Veja Tom Forsyth, "Linear-Speed Vertex
+// Cache Optimisation" (2006).
+// ---------------------------------------------------------------------------
+
+static float VertexScore(int cache_position, int remaining_triangles)
+{
+    if (remaining_triangles == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cache_position >= 0)
+    {
+        if (cache_position < 3)
+        {
+            // Os vértices do último triângulo recebem uma pontuação fixa, para
+            // não favorecer tiras longas e finas.
+            score = 0.75f;
+        }
+        else
+        {
+            float scaler = 1.0f / (VERTEX_CACHE_SIZE - 3);
+            score = std::pow(1.0f - (cache_position - 3) * scaler, 1.5f);
+        }
+    }
+
+    // Vértices com poucos triângulos restantes são priorizados, para que não
+    // fiquem isolados no final.
+    score += 2.0f / std::sqrt((float)remaining_triangles);
+    return score;
+}
+
+static void OptimizeVertexCache(uint32_t* indices, size_t num_indices, size_t num_vertices)
+{
+    size_t num_triangles = num_indices / 3;
+    if (num_triangles == 0)
+        return;
+
+    // Triângulos que usam cada vértice (CSR)
+    std::vector<uint32_t> offsets(num_vertices + 1, 0);
+    for (size_t i = 0; i < num_indices; ++i)
+        offsets[indices[i] + 1] += 1;
+    for (size_t v = 0; v < num_vertices; ++v)
+        offsets[v + 1] += offsets[v];
+
+    std::vector<uint32_t> adjacency(num_indices);
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < num_indices; ++i)
+        adjacency[fill[indices[i]]++] = (uint32_t)(i / 3);
+
+    std::vector<int>   remaining(num_vertices);
+    std::vector<int>   cache_position(num_vertices, -1);
+    std::vector<float> vertex_score(num_vertices);
+    for (size_t v = 0; v < num_vertices; ++v)
+    {
+        remaining[v]    = (int)(offsets[v + 1] - offsets[v]);
+        vertex_score[v] = VertexScore(-1, remaining[v]);
+    }
+
+    std::vector<float> triangle_score(num_triangles);
+    std::vector<bool>  emitted(num_triangles, false);
+    for (size_t t = 0; t < num_triangles; ++t)
+        triangle_score[t] = vertex_score[indices[3*t]] + vertex_score[indices[3*t+1]] + vertex_score[indices[3*t+2]];
+
+    std::vector<uint32_t> output;
+    output.reserve(num_indices);
+
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> new_cache;
+    size_t scan_position = 0;
+
+    while (output.size() < num_indices)
+    {
+        // Melhor triângulo entre os que tocam vértices no cache
+        long best = -1;
+        float best_score = -1.0f;
+        for (size_t c = 0; c < cache.size(); ++c)
+        {
+            uint32_t v = cache[c];
+            for (uint32_t a = offsets[v]; a < offsets[v + 1]; ++a)
+            {
+                uint32_t t = adjacency[a];
+                if (!emitted[t] && triangle_score[t] > best_score)
+                {
+                    best = t;
+                    best_score = triangle_score[t];
+                }
+            }
+        }
+
+        // Nenhum: recomeçamos pelo próximo triângulo ainda não emitido
+        if (best < 0)
+        {
+            while (emitted[scan_position])
+                scan_position += 1;
+            best = (long)scan_position;
+        }
+
+        emitted[best] = true;
+        const uint32_t* tri = &indices[3*best];
+        for (int k = 0; k < 3; ++k)
+        {
+            output.push_back(tri[k]);
+            remaining[tri[k]] -= 1;
+        }
+
+        // Atualizamos o cache LRU: os vértices do triângulo vão para o topo
+        new_cache.assign(tri, tri + 3);
+        for (size_t c = 0; c < cache.size(); ++c)
+        {
+            if (cache[c] != tri[0] && cache[c] != tri[1] && cache[c] != tri[2])
+                new_cache.push_back(cache[c]);
+        }
+        for (size_t c = VERTEX_CACHE_SIZE; c < new_cache.size(); ++c)
+        {
+            cache_position[new_cache[c]] = -1;
+            vertex_score[new_cache[c]]   = VertexScore(-1, remaining[new_cache[c]]);
+        }
+        if (new_cache.size() > VERTEX_CACHE_SIZE)
+            new_cache.resize(VERTEX_CACHE_SIZE);
+        cache.swap(new_cache);
+
+        // Recalculamos as pontuações dos vértices no cache e dos seus triângulos
+        for (size_t c = 0; c < cache.size(); ++c)
+        {
+            cache_position[cache[c]] = (int)c;
+            vertex_score[cache[c]]   = VertexScore((int)c, remaining[cache[c]]);
+        }
+        for (size_t c = 0; c < cache.size(); ++c)
+        {
+            uint32_t v = cache[c];
+            for (uint32_t a = offsets[v]; a < offsets[v + 1]; ++a)
+            {
+                uint32_t t = adjacency[a];
+                if (!emitted[t])
+                    triangle_score[t] = vertex_score[indices[3*t]] + vertex_score[indices[3*t+1]] + vertex_score[indices[3*t+2]];
+            }
+        }
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+// Número médio de vértices transformados por triângulo (ACMR) para um cache
+// FIFO, como o das GPUs. Apenas para o relatório.
+static float AverageCacheMissRatio(const uint32_t* indices, size_t num_indices, size_t num_vertices)
+{
+    if (num_indices == 0)
+        return 0.0f;
+
+    std::vector<size_t> timestamp(num_vertices, 0);
+    size_t time = VERTEX_CACHE_SIZE + 1;
+    size_t misses = 0;
+    for (size_t i = 0; i < num_indices; ++i)
+    {
+        if (time - timestamp[indices[i]] > VERTEX_CACHE_SIZE)
+        {
+            timestamp[indices[i]] = time++;
+            misses += 1;
+        }
+    }
+    return (float)misses / (num_indices / 3);
+}
+
+// ---------------------------------------------------------------------------
+// Redução de overdraw. A sequência otimizada para o cache é dividida em
+// grupos nos pontos onde o cache é esvaziado (triângulo com três faltas), e
+// os grupos são ordenados para que os voltados para fora do modelo sejam
+// desenhados primeiro e ocultem os demais no teste de profundidade. Veja
+// Sander, Nehab e Barczak, "Fast Triangle Reordering for Vertex Locality
+// and Reduced Overdraw" (2007).
+// ---------------------------------------------------------------------------
+
+static void OptimizeOverdraw(uint32_t* indices, size_t num_indices, const std::vector<CookedVertex>& vertices)
+{
+    size_t num_triangles = num_indices / 3;
+    if (num_triangles < 2)
+        return;
+
+    // Limites dos grupos
+    std::vector<size_t> clusters;
+    std::vector<size_t> timestamp(vertices.size(), 0);
+    size_t time = VERTEX_CACHE_SIZE + 1;
+    for (size_t t = 0; t < num_triangles; ++t)
+    {
+        int misses = 0;
+        for (int k = 0; k < 3; ++k)
+        {
+            uint32_t v = indices[3*t + k];
+            if (time - timestamp[v] > VERTEX_CACHE_SIZE)
+            {
+                timestamp[v] = time++;
+                misses += 1;
+            }
+        }
+        if (t == 0 || misses == 3)
+            clusters.push_back(t);
+    }
+    clusters.push_back(num_triangles);
+
+    // Centróide do modelo, ponderado por área
+    struct ClusterInfo { size_t begin, end; float sort_key; };
+    std::vector<ClusterInfo> infos;
+
+    double mesh_centroid[3] = { 0, 0, 0 };
+    double mesh_area = 0;
+    std::vector<float> areas(num_triangles), normals(3 * num_triangles), centroids(3 * num_triangles);
+    for (size_t t = 0; t < num_triangles; ++t)
+    {
+        const float* a = vertices[indices[3*t+0]].position;
+        const float* b = vertices[indices[3*t+1]].position;
+        const float* c = vertices[indices[3*t+2]].position;
+        float u[3] = { b[0]-a[0], b[1]-a[1], b[2]-a[2] };
+        float w[3] = { c[0]-a[0], c[1]-a[1], c[2]-a[2] };
+        float n[3] = { u[1]*w[2]-u[2]*w[1], u[2]*w[0]-u[0]*w[2], u[0]*w[1]-u[1]*w[0] };
+        float area = 0.5f * std::sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+
+        areas[t] = area;
+        for (int k = 0; k < 3; ++k)
+        {
+            normals[3*t+k]   = n[k];
+            centroids[3*t+k] = (a[k] + b[k] + c[k]) / 3.0f;
+            mesh_centroid[k] += centroids[3*t+k] * area;
+        }
+        mesh_area += area;
+    }
+    if (mesh_area > 0)
+        for (int k = 0; k < 3; ++k)
+            mesh_centroid[k] /= mesh_area;
+
+    for (size_t i = 0; i + 1 < clusters.size(); ++i)
+    {
+        ClusterInfo info;
+        info.begin = clusters[i];
+        info.end   = clusters[i + 1];
+
+        double centroid[3] = { 0, 0, 0 };
+        double normal[3]   = { 0, 0, 0 };
+        double area = 0;
+        for (size_t t = info.begin; t < info.end; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                centroid[k] += centroids[3*t+k] * areas[t];
+                normal[k]   += normals[3*t+k];
+            }
+            area += areas[t];
+        }
+
+        info.sort_key = 0.0f;
+        if (area > 0)
+        {
+            double length = std::sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+            if (length > 0)
+            {
+                for (int k = 0; k < 3; ++k)
+                    info.sort_key += (float)((centroid[k] / area - mesh_centroid[k]) * normal[k] / length);
+            }
+        }
+        infos.push_back(info);
+    }
+
+    std::stable_sort(infos.begin(), infos.end(),
+        [](const ClusterInfo& a, const ClusterInfo& b) { return a.sort_key > b.sort_key; });
+
+    std::vector<uint32_t> output;
+    output.reserve(num_indices);
+    for (size_t i = 0; i < infos.size(); ++i)
+        output.insert(output.end(), indices + 3*infos[i].begin, indices + 3*infos[i].end);
+    std::copy(output.begin(), output.end(), indices);
+}
+
+// ---------------------------------------------------------------------------
+// Modelos
+// ---------------------------------------------------------------------------
+
+struct CookedMesh
+{
+    std::vector<CookedShape>  shapes;
+    std::vector<CookedVertex> vertices;
+    std::vector<uint32_t>     indices;
+};
+
+static void CookMesh(const char* input, CookedMesh* mesh)
+{
+    tinyobj::attrib_t                attrib;
+    std::vector<tinyobj::shape_t>    shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string err;
+
+    bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &err, input, NULL, true);
+    if (!err.empty())
+        fprintf(stderr, "%s\n", err.c_str());
+    if (!ret)
+        throw std::runtime_error("Erro ao carregar modelo.");
+
+    // Mesmo cálculo de ComputeNormals() em "main.cpp": uma normal por canto
+    // de triângulo, caso o arquivo não as tenha.
+    std::vector<float> corner_normals;
+    if (attrib.normals.empty())
+    {
+        std::vector<GLuint> triangle_positions;
+        for (size_t s = 0; s < shapes.size(); ++s)
+            for (size_t i = 0; i < shapes[s].mesh.indices.size(); ++i)
+                triangle_positions.push_back(shapes[s].mesh.indices[i].vertex_index);
+
+        corner_normals.resize(3 * triangle_positions.size());
+        Normals_Compute(
+            attrib.vertices.data(), attrib.vertices.size() / 3,
+            triangle_positions.data(), triangle_positions.size() / 3,
+            Normals_DefaultOptions(),
+            corner_normals.data(), 3 * sizeof(float)
+        );
+    }
+
+    // Solda: cantos com o mesmo vértice quantizado compartilham um índice
+    std::unordered_map<std::string, uint32_t> welded;
+    size_t corner = 0;
+
+    for (size_t s = 0; s < shapes.size(); ++s)
+    {
+        CookedShape shape;
+        memset(&shape, 0, sizeof(shape));
+        strncpy(shape.name, shapes[s].name.c_str(), sizeof(shape.name) - 1);
+        shape.first_index = (uint32_t)mesh->indices.size();
+
+        const std::vector<tinyobj::index_t>& indices = shapes[s].mesh.indices;
+        for (size_t i = 0; i < indices.size(); ++i, ++corner)
+        {
+            const tinyobj::index_t& idx = indices[i];
+
+            CookedVertex vertex;
+            memset(&vertex, 0, sizeof(vertex));
+            for (int k = 0; k < 3; ++k)
+                vertex.position[k] = attrib.vertices[3*idx.vertex_index + k];
+
+            if (!corner_normals.empty())
+                vertex.normal = PackNormal(corner_normals[3*corner], corner_normals[3*corner+1], corner_normals[3*corner+2]);
+            else if (idx.normal_index >= 0)
+                vertex.normal = PackNormal(attrib.normals[3*idx.normal_index], attrib.normals[3*idx.normal_index+1], attrib.normals[3*idx.normal_index+2]);
+
+            if (idx.texcoord_index >= 0)
+            {
+                vertex.texcoord[0] = FloatToHalf(attrib.texcoords[2*idx.texcoord_index]);
+                vertex.texcoord[1] = FloatToHalf(attrib.texcoords[2*idx.texcoord_index+1]);
+            }
+
+            std::string key((const char*)&vertex, sizeof(vertex));
+            std::unordered_map<std::string, uint32_t>::iterator it = welded.find(key);
+            if (it == welded.end())
+            {
+                it = welded.insert(std::make_pair(key, (uint32_t)mesh->vertices.size())).first;
+                mesh->vertices.push_back(vertex);
+            }
+            mesh->indices.push_back(it->second);
+        }
+
+        shape.num_indices = (uint32_t)(mesh->indices.size() - shape.first_index);
+        mesh->shapes.push_back(shape);
+    }
+
+    float acmr_before = AverageCacheMissRatio(mesh->indices.data(), mesh->indices.size(), mesh->vertices.size());
+
+    // Cada shape é desenhado separadamente, então é otimizado separadamente
+    for (size_t s = 0; s < mesh->shapes.size(); ++s)
+    {
+        uint32_t* first = mesh->indices.data() + mesh->shapes[s].first_index;
+        OptimizeVertexCache(first, mesh->shapes[s].num_indices, mesh->vertices.size());
+        OptimizeOverdraw(first, mesh->shapes[s].num_indices, mesh->vertices);
+    }
+
+    float acmr_after = AverageCacheMissRatio(mesh->indices.data(), mesh->indices.size(), mesh->vertices.size());
+
+    // Vértices na ordem em que são usados, para leituras sequenciais
+    std::vector<uint32_t> remap(mesh->vertices.size(), UINT32_MAX);
+    std::vector<CookedVertex> ordered;
+    ordered.reserve(mesh->vertices.size());
+    for (size_t i = 0; i < mesh->indices.size(); ++i)
+    {
+        uint32_t& v = mesh->indices[i];
+        if (remap[v] == UINT32_MAX)
+        {
+            remap[v] = (uint32_t)ordered.size();
+            ordered.push_back(mesh->vertices[v]);
+        }
+        v = remap[v];
+    }
+    mesh->vertices.swap(ordered);
+
+    printf("  %d cantos -> %d vértices, %d índices, ACMR %.2f -> %.2f\n",
+        (int)corner, (int)mesh->vertices.size(), (int)mesh->indices.size(), acmr_before, acmr_after);
+}
+
+static bool WriteMesh(const char* output, const CookedMesh& mesh)
+{
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+
+    CookedMeshHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic        = COOKED_MESH_MAGIC;
+    header.version      = COOKED_VERSION;
+    header.num_vertices = (uint32_t)mesh.vertices.size();
+    header.num_indices  = (uint32_t)mesh.indices.size();
+    header.num_shapes   = (uint32_t)mesh.shapes.size();
+
+    out.write((const char*)&header, sizeof(header));
+    out.write((const char*)mesh.shapes.data(), mesh.shapes.size() * sizeof(CookedShape));
+    out.write((const char*)mesh.vertices.data(), mesh.vertices.size() * sizeof(CookedVertex));
+    out.write((const char*)mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+    return (bool)out;
+}
+
+// ---------------------------------------------------------------------------
+// Texturas
+// ---------------------------------------------------------------------------
+
+static float SrgbToLinear(float c)
+{
+    return (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+static float LinearToSrgb(float c)
+{
+    return (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+}
+
+struct CookedLevel
+{
+    int width;
+    int height;
+    std::vector<unsigned char> texels;
+};
+
+// Gera a cadeia de mipmaps com um filtro caixa 2x2, calculado em espaço
+// linear (as imagens são sRGB) para não escurecer os níveis menores.
+static void BuildMipChain(std::vector<CookedLevel>* levels)
+{
+    float to_linear[256];
+    for (int i = 0; i < 256; ++i)
+        to_linear[i] = SrgbToLinear(i / 255.0f);
+
+    while (levels->back().width > 1 || levels->back().height > 1)
+    {
+        const CookedLevel& src = levels->back();
+        CookedLevel dst;
+        dst.width  = std::max(1, src.width / 2);
+        dst.height = std::max(1, src.height / 2);
+        dst.texels.resize((size_t)dst.width * dst.height * 3);
+
+        for (int y = 0; y < dst.height; ++y)
+        {
+            int y0 = std::min(2*y, src.height - 1), y1 = std::min(2*y + 1, src.height - 1);
+            for (int x = 0; x < dst.width; ++x)
+            {
+                int x0 = std::min(2*x, src.width - 1), x1 = std::min(2*x + 1, src.width - 1);
+                for (int c = 0; c < 3; ++c)
+                {
+                    float sum = to_linear[src.texels[3*((size_t)y0*src.width + x0) + c]]
+                              + to_linear[src.texels[3*((size_t)y0*src.width + x1) + c]]
+                              + to_linear[src.texels[3*((size_t)y1*src.width + x0) + c]]
+                              + to_linear[src.texels[3*((size_t)y1*src.width + x1) + c]];
+                    float value = LinearToSrgb(0.25f * sum);
+                    dst.texels[3*((size_t)y*dst.width + x) + c] = (unsigned char)std::floor(value * 255.0f + 0.5f);
+                }
+            }
+        }
+        levels->push_back(dst);
+    }
+}
+
+static void CookTexture(const char* input, std::vector<CookedLevel>* levels)
+{
+    // Mesma orientação usada pelo carregador do jogo
+    stbi_set_flip_vertically_on_load(true);
+
+    CookedLevel base;
+    int channels;
+    unsigned char* data = stbi_load(input, &base.width, &base.height, &channels, 3);
+    if (data == NULL)
+        throw std::runtime_error("Erro ao carregar imagem.");
+
+    base.texels.assign(data, data + (size_t)base.width * base.height * 3);
+    stbi_image_free(data);
+
+    levels->push_back(base);
+    BuildMipChain(levels);
+
+    printf("  %dx%d, %d níveis\n", base.width, base.height, (int)levels->size());
+}
+
+// ---------------------------------------------------------------------------
+// Compressão BC1 (DXT1). Cada bloco de 4x4 texels é representado por duas
+// cores RGB565 e um índice de 2 bits por texel, escolhendo entre as duas
+// cores e duas interpolações entre elas. Os extremos são escolhidos ao longo
+// do eixo principal das cores do bloco.
+// ---------------------------------------------------------------------------
+
+static uint16_t PackRgb565(const float color[3])
+{
+    int r = (int)std::floor(std::max(0.0f, std::min(255.0f, color[0])) * 31.0f / 255.0f + 0.5f);
+    int g = (int)std::floor(std::max(0.0f, std::min(255.0f, color[1])) * 63.0f / 255.0f + 0.5f);
+    int b = (int)std::floor(std::max(0.0f, std::min(255.0f, color[2])) * 31.0f / 255.0f + 0.5f);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void UnpackRgb565(uint16_t packed, float color[3])
+{
+    color[0] = (float)((packed >> 11) & 31) * 255.0f / 31.0f;
+    color[1] = (float)((packed >> 5) & 63) * 255.0f / 63.0f;
+    color[2] = (float)(packed & 31) * 255.0f / 31.0f;
+}
+
+static void CompressBlockBC1(const unsigned char texels[16][3], unsigned char out[8])
+{
+    float mean[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < 3; ++c)
+            mean[c] += texels[i][c] / 16.0f;
+
+    // Matriz de covariância e eixo principal (iteração de potência)
+    float cov[6] = { 0, 0, 0, 0, 0, 0 };
+    for (int i = 0; i < 16; ++i)
+    {
+        float d[3] = { texels[i][0] - mean[0], texels[i][1] - mean[1], texels[i][2] - mean[2] };
+        cov[0] += d[0]*d[0]; cov[1] += d[0]*d[1]; cov[2] += d[0]*d[2];
+        cov[3] += d[1]*d[1]; cov[4] += d[1]*d[2]; cov[5] += d[2]*d[2];
+    }
+    float axis[3] = { 1, 1, 1 };
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        float x = cov[0]*axis[0] + cov[1]*axis[1] + cov[2]*axis[2];
+        float y = cov[1]*axis[0] + cov[3]*axis[1] + cov[4]*axis[2];
+        float z = cov[2]*axis[0] + cov[4]*axis[1] + cov[5]*axis[2];
+        float length = std::max(std::fabs(x), std::max(std::fabs(y), std::fabs(z)));
+        if (length < 1e-6f)
+            break;
+        axis[0] = x / length; axis[1] = y / length; axis[2] = z / length;
+    }
+
+    float min_t = 0.0f, max_t = 0.0f;
+    for (int i = 0; i < 16; ++i)
+    {
+        float t = (texels[i][0] - mean[0])*axis[0] + (texels[i][1] - mean[1])*axis[1] + (texels[i][2] - mean[2])*axis[2];
+        min_t = std::min(min_t, t);
+        max_t = std::max(max_t, t);
+    }
+
+    float end0[3], end1[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        end0[c] = mean[c] + axis[c] * max_t;
+        end1[c] = mean[c] + axis[c] * min_t;
+    }
+
+    // Duas passadas: a segunda refina os extremos por mínimos quadrados,
+    // dados os índices escolhidos na primeira.
+    uint16_t color0 = 0, color1 = 0;
+    uint32_t indices = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        color0 = PackRgb565(end0);
+        color1 = PackRgb565(end1);
+
+        // color0 > color1 seleciona o modo de quatro cores (sem transparência)
+        if (color0 < color1)
+            std::swap(color0, color1);
+
+        indices = 0;
+        if (color0 == color1)
+            break;
+
+        float palette[4][3];
+        UnpackRgb565(color0, palette[0]);
+        UnpackRgb565(color1, palette[1]);
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+            palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+        }
+
+        int selected[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            int best = 0;
+            float best_distance = 1e30f;
+            for (int p = 0; p < 4; ++p)
+            {
+                float dr = texels[i][0] - palette[p][0];
+                float dg = texels[i][1] - palette[p][1];
+                float db = texels[i][2] - palette[p][2];
+                float distance = dr*dr + dg*dg + db*db;
+                if (distance < best_distance)
+                {
+                    best = p;
+                    best_distance = distance;
+                }
+            }
+            selected[i] = best;
+            indices |= (uint32_t)best << (2 * i);
+        }
+
+        // Cada texel é a*color0 + b*color1, com (a, b) dados pelo índice
+        static const float weight0[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+        float aa = 0, ab = 0, bb = 0, ax[3] = { 0, 0, 0 }, bx[3] = { 0, 0, 0 };
+        for (int i = 0; i < 16; ++i)
+        {
+            float a = weight0[selected[i]], b = 1.0f - a;
+            aa += a*a; ab += a*b; bb += b*b;
+            for (int c = 0; c < 3; ++c)
+            {
+                ax[c] += a * texels[i][c];
+                bx[c] += b * texels[i][c];
+            }
+        }
+        float determinant = aa*bb - ab*ab;
+        if (std::fabs(determinant) < 1e-6f)
+            break;
+        for (int c = 0; c < 3; ++c)
+        {
+            end0[c] = (ax[c]*bb - bx[c]*ab) / determinant;
+            end1[c] = (bx[c]*aa - ax[c]*ab) / determinant;
+        }
+    }
+
+    out[0] = (unsigned char)(color0 & 0xFF);
+    out[1] = (unsigned char)(color0 >> 8);
+    out[2] = (unsigned char)(color1 & 0xFF);
+    out[3] = (unsigned char)(color1 >> 8);
+    for (int k = 0; k < 4; ++k)
+        out[4 + k] = (unsigned char)(indices >> (8 * k));
+}
+
+// Comprime um nível inteiro. Blocos nas bordas de níveis que não são
+// múltiplos de 4 repetem os últimos texels.
+static std::vector<unsigned char> CompressLevelBC1(const CookedLevel& level)
+{
+    int blocks_x = (level.width + 3) / 4;
+    int blocks_y = (level.height + 3) / 4;
+    std::vector<unsigned char> blocks((size_t)blocks_x * blocks_y * 8);
+
+    for (int by = 0; by < blocks_y; ++by)
+    {
+        for (int bx = 0; bx < blocks_x; ++bx)
+        {
+            unsigned char texels[16][3];
+            for (int i = 0; i < 16; ++i)
+            {
+                int x = std::min(4*bx + (i % 4), level.width - 1);
+                int y = std::min(4*by + (i / 4), level.height - 1);
+                memcpy(texels[i], &level.texels[3*((size_t)y*level.width + x)], 3);
+            }
+            CompressBlockBC1(texels, &blocks[8*((size_t)by*blocks_x + bx)]);
+        }
+    }
+    return blocks;
+}
+
+static bool WriteTexture(const char* output, const std::vector<CookedLevel>& levels, CookedTextureFormat format)
+{
+    // Dados de cada nível, já no formato final
+    std::vector< std::vector<unsigned char> > data(levels.size());
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        if (format == COOKED_FORMAT_BC1_SRGB)
+            data[i] = CompressLevelBC1(levels[i]);
+        else
+            data[i] = levels[i].texels;
+    }
+
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+
+    CookedTextureHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic      = COOKED_TEXTURE_MAGIC;
+    header.version    = COOKED_VERSION;
+    header.width      = (uint32_t)levels[0].width;
+    header.height     = (uint32_t)levels[0].height;
+    header.num_levels = (uint32_t)levels.size();
+    header.format     = format;
+    out.write((const char*)&header, sizeof(header));
+
+    uint32_t offset = (uint32_t)(sizeof(header) + levels.size() * sizeof(CookedTextureLevel));
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        CookedTextureLevel level;
+        level.width  = (uint32_t)levels[i].width;
+        level.height = (uint32_t)levels[i].height;
+        level.offset = offset;
+        level.size   = (uint32_t)data[i].size();
+        out.write((const char*)&level, sizeof(level));
+        offset += level.size;
+    }
+    for (size_t i = 0; i < levels.size(); ++i)
+        out.write((const char*)data[i].data(), data[i].size());
+    return (bool)out;
+}
+
+// ---------------------------------------------------------------------------
+
+static bool EndsWith(const std::string& str, const char* suffix)
+{
+    size_t n = strlen(suffix);
+    return str.size() >= n && str.compare(str.size() - n, n, suffix) == 0;
+}
+
+int main(int argc, char* argv[])
+{
+    CookedTextureFormat texture_format = COOKED_FORMAT_SRGB8;
+    if (argc == 4 && strcmp(argv[1], "--bc1") == 0)
+    {
+        texture_format = COOKED_FORMAT_BC1_SRGB;
+        argv += 1;
+        argc -= 1;
+    }
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "Uso: %s [--bc1] <entrada.obj|imagem> <saída.cmsh|saída.ctex>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* input  = argv[1];
+    const char* output = argv[2];
+    printf("Processando \"%s\" -> \"%s\"\n", input, output);
+
+    try
+    {
+        bool ok;
+        if (EndsWith(input, ".obj"))
+        {
+            CookedMesh mesh;
+            CookMesh(input, &mesh);
+            ok = WriteMesh(output, mesh);
+        }
+        else
+        {
+            std::vector<CookedLevel> levels;
+            CookTexture(input, &levels);
+            ok = WriteTexture(output, levels, texture_format);
+        }
+
+        if (!ok)
+        {
+            fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", output);
+            return EXIT_FAILURE;
+        }
+    }
+    catch (std::exception& e)
+    {
+        fprintf(stderr, "ERROR: %s (\"%s\")\n", e.what(), input);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// Ferramenta de linha de comando que gera o pacote de assets lido pelo jogo
+// (veja "include/archive.hpp"). Uso, a partir da raiz do projeto:
+//
+//   packer.exe assets.pak data/grass.jpg data/sphere.obj src/shader_vertex.glsl ...
+//
+// O pacote é escrito em um arquivo temporário, verificado e então renomeado,
+// de modo que um jogo em execução nunca encontra um pacote pela metade.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../include/archive.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+// Substitui "to" por "from" em uma única operação: não há um instante em que
+// "to" não existe. No POSIX, rename() já substitui o destino; no Windows,
+// rename() falha se o destino existe, então usamos MoveFileExA().
+static bool ReplacePackFile(const char* from, const char* to)
+{
+#if defined(_WIN32)
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from, to) == 0;
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Uso: %s <pacote> <arquivo> [arquivo ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string output    = argv[1];
+    std::string temporary = output + ".tmp";
+
+    std::vector<std::string> paths(argv + 2, argv + argc);
+
+    printf("Gerando \"%s\"...\n", output.c_str());
+    if (!Archive_Write(temporary.c_str(), paths))
+    {
+        std::remove(temporary.c_str());
+        return EXIT_FAILURE;
+    }
+
+    bool ok = Archive_Open(temporary.c_str()) && Archive_Verify();
+    Archive_Close();
+    if (!ok)
+    {
+        std::remove(temporary.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // O pacote anterior continua íntegro se a troca falhar (por exemplo, no
+    // Windows, enquanto o jogo o mantém mapeado)
+    if (!ReplacePackFile(temporary.c_str(), output.c_str()))
+    {
+        fprintf(stderr, "ERROR: Cannot rename \"%s\" to \"%s\".\n", temporary.c_str(), output.c_str());
+        std::remove(temporary.c_str());
+        return EXIT_FAILURE;
+    }
+
+    printf("OK.\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+// Ferramenta que gera, a partir do atlas de bitmaps em "include/dejavufont.h",
+// um atlas de campos de distância com sinal (SDF) usado por
+// "textrendering.cpp". Cada texel guarda a distância até a borda do glifo;
+// o fragment shader reconstrói a borda com suavização para qualquer escala,
+// então um único atlas pequeno serve todos os tamanhos de texto. Uso, a
+// partir da raiz do projeto:
+//
+//   sdfgen.exe include/dejavufont_sdf.h
+//
+// A borda de cada glifo é estimada com 4x4 amostras por texel (interpolação
+// bilinear da cobertura original), e as distâncias são calculadas com a
+// transformada de distância euclidiana exata de Felzenszwalb e Huttenlocher,
+// "Distance Transforms of Sampled Functions" (2012).
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "../include/dejavufont.h"
+
+#define SDF_ATLAS_SIZE 256 // Largura e altura do atlas gerado
+#define SDF_SPREAD     4   // Distância máxima representada, em texels
+#define SDF_SUPERSAMPLE 4  // Amostras por texel (em cada eixo)
+
+// Transformada de distância 1D: f contém 0 (dentro) ou um valor grande (fora);
+// d recebe a distância ao quadrado até o elemento mais próximo com f = 0.
+static void DistanceTransform1D(const float* f, float* d, int n, std::vector<int>& v, std::vector<float>& z)
+{
+    v.resize(n);
+    z.resize(n + 1);
+
+    int k = 0;
+    v[0] = 0;
+    z[0] = -1e20f;
+    z[1] = +1e20f;
+    for (int q = 1; q < n; ++q)
+    {
+        float s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2*q - 2*v[k]);
+        while (s <= z[k])
+        {
+            k -= 1;
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2*q - 2*v[k]);
+        }
+        k += 1;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = +1e20f;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; ++q)
+    {
+        while (z[k + 1] < q)
+            k += 1;
+        d[q] = (q - v[k])*(q - v[k]) + f[v[k]];
+    }
+}
+
+// Distância euclidiana ao quadrado, para cada amostra, até a amostra mais
+// próxima em que "target" é verdadeiro
+static void DistanceTransform2D(const std::vector<bool>& target, int width, int height, std::vector<float>* out)
+{
+    const float INF = 1e20f;
+    std::vector<float> grid(width * height);
+    for (int i = 0; i < width * height; ++i)
+        grid[i] = target[i] ? 0.0f : INF;
+
+    std::vector<int> v;
+    std::vector<float> z;
+    std::vector<float> f(std::max(width, height)), d(std::max(width, height));
+
+    for (int x = 0; x < width; ++x)
+    {
+        for (int y = 0; y < height; ++y)
+            f[y] = grid[y*width + x];
+        DistanceTransform1D(f.data(), d.data(), height, v, z);
+        for (int y = 0; y < height; ++y)
+            grid[y*width + x] = d[y];
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        DistanceTransform1D(&grid[y*width], d.data(), width, v, z);
+        std::copy(d.begin(), d.begin() + width, grid.begin() + y*width);
+    }
+
+    out->swap(grid);
+}
+
+// Cobertura do bitmap original no ponto (x, y) em texels, relativo ao canto
+// do glifo; zero fora do retângulo do glifo.
+static float SampleCoverage(const texture_glyph_t& glyph, float x, float y)
+{
+    int gx = (int)std::floor(glyph.s0 * dejavufont.tex_width + 0.5f);
+    int gy = (int)std::floor(glyph.t0 * dejavufont.tex_height + 0.5f);
+
+    x -= 0.5f;
+    y -= 0.5f;
+    int x0 = (int)std::floor(x), y0 = (int)std::floor(y);
+    float fx = x - x0, fy = y - y0;
+
+    float c[2][2];
+    for (int j = 0; j < 2; ++j)
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            int px = x0 + i, py = y0 + j;
+            if (px < 0 || py < 0 || px >= glyph.width || py >= glyph.height)
+                c[j][i] = 0.0f;
+            else
+                c[j][i] = dejavufont.tex_data[(gy + py) * dejavufont.tex_width + gx + px] / 255.0f;
+        }
+    }
+    return (c[0][0]*(1-fx) + c[0][1]*fx)*(1-fy) + (c[1][0]*(1-fx) + c[1][1]*fx)*fy;
+}
+
+// Gera o SDF de um glifo em uma célula de (largura + 2*SDF_SPREAD) x
+// (altura + 2*SDF_SPREAD) texels
+static void BuildGlyphSdf(const texture_glyph_t& glyph, int cell_width, int cell_height, std::vector<unsigned char>* out)
+{
+    const int n = SDF_SUPERSAMPLE;
+    int width = cell_width * n, height = cell_height * n;
+
+    std::vector<bool> inside(width * height), outside(width * height);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            float gx = (x + 0.5f) / n - SDF_SPREAD;
+            float gy = (y + 0.5f) / n - SDF_SPREAD;
+            bool in = SampleCoverage(glyph, gx, gy) >= 0.5f;
+            inside[y*width + x]  = in;
+            outside[y*width + x] = !in;
+        }
+    }
+
+    std::vector<float> to_inside, to_outside;
+    DistanceTransform2D(inside, width, height, &to_inside);
+    DistanceTransform2D(outside, width, height, &to_outside);
+
+    out->resize(cell_width * cell_height);
+    for (int y = 0; y < cell_height; ++y)
+    {
+        for (int x = 0; x < cell_width; ++x)
+        {
+            // Amostra mais próxima do centro do texel
+            int sx = x*n + n/2, sy = y*n + n/2;
+            int i = sy*width + sx;
+
+            // Distância com sinal, em texels: positiva dentro do glifo
+            float distance;
+            if (inside[i])
+                distance = (std::sqrt(to_outside[i]) - 0.5f) / n;
+            else
+                distance = -(std::sqrt(to_inside[i]) - 0.5f) / n;
+
+            float value = 0.5f + 0.5f * distance / SDF_SPREAD;
+            value = std::max(0.0f, std::min(1.0f, value));
+            (*out)[y*cell_width + x] = (unsigned char)std::floor(value * 255.0f + 0.5f);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Uso: %s <saída.h>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<unsigned char> atlas(SDF_ATLAS_SIZE * SDF_ATLAS_SIZE, 0);
+    std::vector<texture_glyph_t> glyphs(dejavufont.glyphs, dejavufont.glyphs + dejavufont.glyphs_count);
+
+    // Empacotamento em prateleiras, na ordem original dos glifos
+    int shelf_x = 0, shelf_y = 0, shelf_height = 0;
+    for (size_t g = 0; g < glyphs.size(); ++g)
+    {
+        const texture_glyph_t& source = dejavufont.glyphs[g];
+        int cell_width  = source.width  + 2*SDF_SPREAD;
+        int cell_height = source.height + 2*SDF_SPREAD;
+
+        if (shelf_x + cell_width > SDF_ATLAS_SIZE)
+        {
+            shelf_x = 0;
+            shelf_y += shelf_height;
+            shelf_height = 0;
+        }
+        if (shelf_y + cell_height > SDF_ATLAS_SIZE)
+        {
+            fprintf(stderr, "ERROR: SDF atlas is too small.\n");
+            return EXIT_FAILURE;
+        }
+
+        std::vector<unsigned char> cell;
+        BuildGlyphSdf(source, cell_width, cell_height, &cell);
+        for (int y = 0; y < cell_height; ++y)
+            memcpy(&atlas[(shelf_y + y)*SDF_ATLAS_SIZE + shelf_x], &cell[y*cell_width], cell_width);
+
+        texture_glyph_t& glyph = glyphs[g];
+        glyph.width    = cell_width;
+        glyph.height   = cell_height;
+        glyph.offset_x = source.offset_x - SDF_SPREAD;
+        glyph.offset_y = source.offset_y + SDF_SPREAD;
+        glyph.s0 = (float)shelf_x / SDF_ATLAS_SIZE;
+        glyph.t0 = (float)shelf_y / SDF_ATLAS_SIZE;
+        glyph.s1 = (float)(shelf_x + cell_width) / SDF_ATLAS_SIZE;
+        glyph.t1 = (float)(shelf_y + cell_height) / SDF_ATLAS_SIZE;
+
+        shelf_x += cell_width;
+        shelf_height = std::max(shelf_height, cell_height);
+    }
+
+    FILE* out = fopen(argv[1], "w");
+    if (out == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot create file \"%s\".\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(out, "// Arquivo gerado por \"tools/sdfgen.cpp\" a partir de \"dejavufont.h\".\n");
+    fprintf(out, "// Não edite manualmente; execute _build_fonts.bat.\n");
+    fprintf(out, "//\n");
+    fprintf(out, "// Atlas de campos de distância com sinal: 0.5 é a borda do glifo, e cada\n");
+    fprintf(out, "// unidade de 0.5 corresponde a %d texels. As métricas seguem o formato da\n", SDF_SPREAD);
+    fprintf(out, "// freetype-gl, como em \"dejavufont.h\", incluindo a margem de cada glifo.\n");
+    fprintf(out, "#ifndef _DEJAVUFONT_SDF_H\n#define _DEJAVUFONT_SDF_H\n\n");
+    fprintf(out, "#include <stddef.h>\n#include <stdint.h>\n\n");
+    fprintf(out, "#define DEJAVUFONT_SDF_SPREAD %d\n\n", SDF_SPREAD);
+    fprintf(out, "typedef struct\n{\n    uint32_t codepoint;\n    float kerning;\n} sdf_kerning_t;\n\n");
+    fprintf(out, "typedef struct\n{\n    uint32_t codepoint;\n    int width, height;\n    int offset_x, offset_y;\n"
+                 "    float advance_x, advance_y;\n    float s0, t0, s1, t1;\n    size_t kerning_count;\n"
+                 "    sdf_kerning_t kerning[1];\n} sdf_glyph_t;\n\n");
+    fprintf(out, "typedef struct\n{\n    size_t tex_width;\n    size_t tex_height;\n    unsigned char tex_data[%d];\n"
+                 "    float size;\n    float height;\n    float linegap;\n    float ascender;\n    float descender;\n"
+                 "    size_t glyphs_count;\n    sdf_glyph_t glyphs[%d];\n} sdf_font_t;\n\n",
+                 SDF_ATLAS_SIZE * SDF_ATLAS_SIZE, (int)glyphs.size());
+
+    fprintf(out, "static const sdf_font_t dejavufont_sdf = {\n %d, %d,\n {", SDF_ATLAS_SIZE, SDF_ATLAS_SIZE);
+    for (size_t i = 0; i < atlas.size(); ++i)
+        fprintf(out, "%s%d%s", (i % 32 == 0) ? "\n  " : "", atlas[i], (i + 1 < atlas.size()) ? "," : "");
+    fprintf(out, "},\n %ff, %ff, %ff, %ff, %ff, %d,\n {\n",
+        dejavufont.size, dejavufont.height, dejavufont.linegap, dejavufont.ascender, dejavufont.descender, (int)glyphs.size());
+    for (size_t g = 0; g < glyphs.size(); ++g)
+    {
+        const texture_glyph_t& glyph = glyphs[g];
+        fprintf(out, "  {%u, %d, %d, %d, %d, %ff, %ff, %ff, %ff, %ff, %ff, 0, { {0, %ff} } }%s\n",
+            glyph.codepoint, glyph.width, glyph.height, glyph.offset_x, glyph.offset_y,
+            glyph.advance_x, glyph.advance_y, glyph.s0, glyph.t0, glyph.s1, glyph.t1,
+            glyph.kerning[0].kerning, (g + 1 < glyphs.size()) ? "," : "");
+    }
+    fprintf(out, " }\n};\n\n#endif // _DEJAVUFONT_SDF_H\n");
+    fclose(out);
+
+    printf("Atlas SDF gerado: %d glifos, %dx%d texels.\n", (int)glyphs.size(), SDF_ATLAS_SIZE, SDF_ATLAS_SIZE);
+    return EXIT_SUCCESS;
+}